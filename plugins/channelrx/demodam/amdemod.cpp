@@ -88,6 +88,12 @@ void AMDemod::feed(const SampleVector::const_iterator& begin, const SampleVector
     m_basebandSink->feed(begin, end);
 }
 
+void AMDemod::feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool firstOfBurst)
+{
+    (void) firstOfBurst;
+    m_basebandSink->feedF(begin, end);
+}
+
 void AMDemod::start()
 {
 	qDebug("AMDemod::start");
@@ -66,9 +66,14 @@ public:
 	virtual void destroy() { delete this; }
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool po);
+	virtual void feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool po);
+	virtual bool isFloatNative() const { return true; }
 	virtual void start();
 	virtual void stop();
 	virtual bool handleMessage(const Message& cmd);
+	virtual bool setSharedFifo(SampleSinkSharedFifo *sharedFifo) { return m_basebandSink->setSharedFifo(sharedFifo); }
+	virtual bool getFifoStats(SampleFifoStats& stats) const { return m_basebandSink->getFifoStats(stats); }
+	virtual bool getSquelchState(bool& open) const { open = getSquelchOpen(); return true; }
 
     virtual void getIdentifier(QString& id) { id = m_channelId; }
     virtual const QString& getURI() const { return m_channelIdURI; }
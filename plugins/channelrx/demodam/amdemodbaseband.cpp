@@ -26,12 +26,17 @@
 MESSAGE_CLASS_DEFINITION(AMDemodBaseband::MsgConfigureAMDemodBaseband, Message)
 
 AMDemodBaseband::AMDemodBaseband() :
+    m_sharedFifo(nullptr),
+    m_sharedFifoReaderIndex(-1),
     m_running(false),
     m_mutex(QMutex::Recursive)
 {
     qDebug("AMDemodBaseband::AMDemodBaseband");
 
+    m_sampleFifo.setLockFree(true); // written by the device engine thread only and read by the baseband thread only
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_sampleFifoF.setLockFree(true);
+    m_sampleFifoF.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
@@ -50,6 +55,7 @@ void AMDemodBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_inputMessageQueue.clear();
     m_sampleFifo.reset();
+    m_sampleFifoF.reset();
 }
 
 void AMDemodBaseband::startWork()
@@ -62,6 +68,25 @@ void AMDemodBaseband::startWork()
         &AMDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleFifoF,
+        &SampleSinkFifoF::dataReady,
+        this,
+        &AMDemodBaseband::handleDataF,
+        Qt::QueuedConnection
+    );
+
+    if (m_sharedFifo)
+    {
+        QObject::connect(
+            m_sharedFifo,
+            &SampleSinkSharedFifo::dataReady,
+            this,
+            &AMDemodBaseband::handleSharedData,
+            Qt::QueuedConnection
+        );
+    }
+
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     m_running = true;
 }
@@ -76,6 +101,17 @@ void AMDemodBaseband::stopWork()
         this,
         &AMDemodBaseband::handleData
     );
+    QObject::disconnect(
+        &m_sampleFifoF,
+        &SampleSinkFifoF::dataReady,
+        this,
+        &AMDemodBaseband::handleDataF
+    );
+
+    if (m_sharedFifo) {
+        QObject::disconnect(m_sharedFifo, &SampleSinkSharedFifo::dataReady, this, &AMDemodBaseband::handleSharedData);
+    }
+
     m_running = false;
 }
 
@@ -84,6 +120,11 @@ void AMDemodBaseband::feed(const SampleVector::const_iterator& begin, const Samp
     m_sampleFifo.write(begin, end);
 }
 
+void AMDemodBaseband::feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end)
+{
+    m_sampleFifoF.write(begin, end);
+}
+
 void AMDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
@@ -111,6 +152,108 @@ void AMDemodBaseband::handleData()
     }
 }
 
+void AMDemodBaseband::handleDataF()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    while ((m_sampleFifoF.fill() > 0) && (m_inputMessageQueue.size() == 0))
+    {
+		FSampleVector::iterator part1begin;
+		FSampleVector::iterator part1end;
+		FSampleVector::iterator part2begin;
+		FSampleVector::iterator part2end;
+
+        std::size_t count = m_sampleFifoF.readBegin(m_sampleFifoF.fill(), &part1begin, &part1end, &part2begin, &part2end);
+
+		// first part of FIFO data
+        if (part1begin != part1end) {
+            m_channelizer->feedF(part1begin, part1end);
+        }
+
+		// second part of FIFO data (used when block wraps around)
+		if(part2begin != part2end) {
+            m_channelizer->feedF(part2begin, part2end);
+        }
+
+		m_sampleFifoF.readCommit((unsigned int) count);
+    }
+}
+
+bool AMDemodBaseband::setSharedFifo(SampleSinkSharedFifo *sharedFifo)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    // connection to the data ready signal is done when work starts
+    if (m_sharedFifo)
+    {
+        m_sharedFifo->unregisterReader(m_sharedFifoReaderIndex);
+        m_sharedFifo = nullptr;
+        m_sharedFifoReaderIndex = -1;
+    }
+
+    if (sharedFifo)
+    {
+        m_sharedFifoReaderIndex = sharedFifo->registerReader();
+
+        if (m_sharedFifoReaderIndex < 0) {
+            return false;
+        }
+
+        m_sharedFifo = sharedFifo;
+    }
+
+    return true;
+}
+
+bool AMDemodBaseband::getFifoStats(SampleFifoStats& stats) const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_sharedFifo) {
+        m_sharedFifo->getStats(m_sharedFifoReaderIndex, stats);
+    } else {
+        m_sampleFifo.getStats(stats);
+
+        if (stats.m_nbWritten == 0) { // float pipeline input
+            m_sampleFifoF.getStats(stats);
+        }
+    }
+
+    return true;
+}
+
+void AMDemodBaseband::handleSharedData()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_sharedFifo) {
+        return;
+    }
+
+    while ((m_sharedFifo->fill(m_sharedFifoReaderIndex) > 0) && (m_inputMessageQueue.size() == 0))
+    {
+		SampleVector::iterator part1begin;
+		SampleVector::iterator part1end;
+		SampleVector::iterator part2begin;
+		SampleVector::iterator part2end;
+
+        std::size_t count = m_sharedFifo->readBegin(m_sharedFifoReaderIndex, m_sharedFifo->fill(m_sharedFifoReaderIndex),
+            &part1begin, &part1end, &part2begin, &part2end);
+
+		// first part of FIFO data
+        if (part1begin != part1end) {
+            m_channelizer->feed(part1begin, part1end);
+        }
+
+		// second part of FIFO data (used when block wraps around)
+		if(part2begin != part2end) {
+            m_channelizer->feed(part2begin, part2end);
+        }
+
+		m_sharedFifo->readCommit(m_sharedFifoReaderIndex, (unsigned int) count);
+    }
+}
+
 void AMDemodBaseband::handleInputMessages()
 {
 	Message* message;
@@ -141,6 +284,7 @@ bool AMDemodBaseband::handleMessage(const Message& cmd)
         DSPSignalNotification& notif = (DSPSignalNotification&) cmd;
         qDebug() << "AMDemodBaseband::handleMessage: DSPSignalNotification: basebandSampleRate: " << notif.getSampleRate();
         m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(notif.getSampleRate()));
+        m_sampleFifoF.setSize(SampleSinkFifo::getSizePolicy(notif.getSampleRate()));
         m_channelizer->setBasebandSampleRate(notif.getSampleRate());
         m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
         m_sink.applyAudioSampleRate(m_sink.getAudioSampleRate()); // reapply in case of channel sample rate change
@@ -22,6 +22,8 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkfifof.h"
+#include "dsp/samplesinksharedfifo.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -62,6 +64,9 @@ public:
     void startWork();
     void stopWork();
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    void feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end); //!< float pipeline input
+    bool setSharedFifo(SampleSinkSharedFifo *sharedFifo);
+    bool getFifoStats(SampleFifoStats& stats) const;
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
     int getChannelSampleRate() const;
     void getMagSqLevels(double& avg, double& peak, int& nbSamples) { m_sink.getMagSqLevels(avg, peak, nbSamples); }
@@ -75,12 +80,15 @@ public:
 
 private:
     SampleSinkFifo m_sampleFifo;
+    SampleSinkFifoF m_sampleFifoF; //!< float pipeline input FIFO
+    SampleSinkSharedFifo *m_sharedFifo; //!< device engine FIFO read in place of m_sampleFifo when set
+    int m_sharedFifoReaderIndex;
     DownChannelizer *m_channelizer;
     AMDemodSink m_sink;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     AMDemodSettings m_settings;
     bool m_running;
-    QMutex m_mutex;
+    mutable QMutex m_mutex;
 
     bool handleMessage(const Message& cmd);
     void applySettings(const AMDemodSettings& settings, bool force = false);
@@ -88,6 +96,8 @@ private:
 private slots:
     void handleInputMessages();
     void handleData(); //!< Handle data when samples have to be processed
+    void handleDataF(); //!< Handle data when float pipeline samples have to be processed
+    void handleSharedData(); //!< Handle data when samples from the shared FIFO have to be processed
 };
 
 #endif // INCLUDE_AMDEMODBASEBAND_H
\ No newline at end of file
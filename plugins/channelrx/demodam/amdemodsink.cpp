@@ -66,48 +66,53 @@ AMDemodSink::~AMDemodSink()
 
 void AMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
-	Complex ci;
+    m_channelSamples.clear();
+    shiftAndResample(begin, end, m_nco, m_interpolator, m_interpolatorDistance, m_interpolatorDistanceRemain, m_channelSamples);
+    feedChannel(m_channelSamples.data(), m_channelSamples.size());
+}
 
-	for (SampleVector::const_iterator it = begin; it != end; ++it)
-	{
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
+void AMDemodSink::feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end)
+{
+    m_channelSamples.clear();
+    shiftAndResample(begin, end, m_nco, m_interpolator, m_interpolatorDistance, m_interpolatorDistanceRemain, m_channelSamples);
+    feedChannel(m_channelSamples.data(), m_channelSamples.size());
+}
 
-		if (m_interpolatorDistance < 1.0f) // interpolate
-		{
-		    while (!m_interpolator.interpolate(&m_interpolatorDistanceRemain, c, &ci))
-            {
-                processOneSample(ci);
-                m_interpolatorDistanceRemain += m_interpolatorDistance;
-            }
-		}
-		else // decimate
-		{
-	        if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
-	        {
-	            processOneSample(ci);
-	            m_interpolatorDistanceRemain += m_interpolatorDistance;
-	        }
-		}
-	}
+void AMDemodSink::feedChannel(const Complex *samples, unsigned int nbSamples)
+{
+    if (m_magsqBuffer.size() < nbSamples) {
+        m_magsqBuffer.resize(nbSamples);
+    }
+
+    // magnitudes of the whole block first
+    for (unsigned int i = 0; i < nbSamples; i++)
+    {
+        Real re = samples[i].real() / SDR_RX_SCALEF;
+        Real im = samples[i].imag() / SDR_RX_SCALEF;
+        m_magsqBuffer[i] = re*re + im*im;
+    }
+
+    // then squelch, AGC and audio filtering
+    for (unsigned int i = 0; i < nbSamples; i++) {
+        processOneSample(samples[i], m_magsqBuffer[i]);
+    }
 
 	if (m_audioBufferFill > 0)
 	{
 		uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
 
 		if (res != m_audioBufferFill) {
-			qDebug("AMDemodSink::feed: %u/%u tail samples written", res, m_audioBufferFill);
+			qDebug("AMDemodSink::feedChannel: %u/%u tail samples written", res, m_audioBufferFill);
 		}
 
 		m_audioBufferFill = 0;
 	}
 }
 
-void AMDemodSink::processOneSample(Complex &ci)
+void AMDemodSink::processOneSample(const Complex &ci, Real magsq)
 {
     Real re = ci.real() / SDR_RX_SCALEF;
     Real im = ci.imag() / SDR_RX_SCALEF;
-    Real magsq = re*re + im*im;
     m_movingAverage(magsq);
     m_magsq = m_movingAverage.asDouble();
     m_magsqSum += magsq;
@@ -18,6 +18,8 @@
 #ifndef INCLUDE_AMDEMODSINK_H
 #define INCLUDE_AMDEMODSINK_H
 
+#include <vector>
+
 #include "dsp/channelsamplesink.h"
 #include "dsp/nco.h"
 #include "dsp/interpolator.h"
@@ -39,6 +41,8 @@ public:
 	~AMDemodSink();
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+	virtual void feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end);
+    virtual void feedChannel(const Complex *samples, unsigned int nbSamples);
 
 	void applyChannelSettings(int channelSampleRate, int channelFrequencyOffset, bool force = false);
     void applySettings(const AMDemodSettings& settings, bool force = false);
@@ -94,6 +98,8 @@ private:
 	Interpolator m_interpolator;
 	Real m_interpolatorDistance;
 	Real m_interpolatorDistanceRemain;
+    ComplexVector m_channelSamples; //!< channel rate samples of the current block
+    std::vector<Real> m_magsqBuffer;
 
 	Real m_squelchLevel;
 	uint32_t m_squelchCount;
@@ -121,7 +127,7 @@ private:
 	AudioFifo m_audioFifo;
 	uint32_t m_audioBufferFill;
 
-    void processOneSample(Complex &ci);
+    void processOneSample(const Complex &ci, Real magsq);
 };
 
 #endif // INCLUDE_AMDEMODSINK_H
\ No newline at end of file
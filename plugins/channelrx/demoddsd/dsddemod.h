@@ -70,6 +70,8 @@ public:
 	virtual void start();
 	virtual void stop();
 	virtual bool handleMessage(const Message& cmd);
+	virtual bool getFifoStats(SampleFifoStats& stats) const { return m_basebandSink->getFifoStats(stats); }
+	virtual bool getSquelchState(bool& open) const { open = getSquelchOpen(); return true; }
 
     virtual void getIdentifier(QString& id) { id = m_channelId; }
     virtual const QString& getURI() const { return m_channelIdURI; }
@@ -88,6 +88,12 @@ void NFMDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
     m_basebandSink->feed(begin, end);
 }
 
+void NFMDemod::feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool firstOfBurst)
+{
+    (void) firstOfBurst;
+    m_basebandSink->feedF(begin, end);
+}
+
 void NFMDemod::start()
 {
     qDebug() << "NFMDemod::start";
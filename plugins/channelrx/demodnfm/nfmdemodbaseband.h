@@ -22,6 +22,8 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkfifof.h"
+#include "dsp/samplesinksharedfifo.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -60,6 +62,9 @@ public:
     ~NFMDemodBaseband();
     void reset();
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    void feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end); //!< float pipeline input
+    bool setSharedFifo(SampleSinkSharedFifo *sharedFifo);
+    bool getFifoStats(SampleFifoStats& stats) const;
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
     int getChannelSampleRate() const;
     void getMagSqLevels(double& avg, double& peak, int& nbSamples) { m_sink.getMagSqLevels(avg, peak, nbSamples); }
@@ -72,11 +77,14 @@ public:
 
 private:
     SampleSinkFifo m_sampleFifo;
+    SampleSinkFifoF m_sampleFifoF; //!< float pipeline input FIFO
+    SampleSinkSharedFifo *m_sharedFifo; //!< device engine FIFO read in place of m_sampleFifo when set
+    int m_sharedFifoReaderIndex;
     DownChannelizer *m_channelizer;
     NFMDemodSink m_sink;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     NFMDemodSettings m_settings;
-    QMutex m_mutex;
+    mutable QMutex m_mutex;
 
     bool handleMessage(const Message& cmd);
     void applySettings(const NFMDemodSettings& settings, bool force = false);
@@ -84,6 +92,8 @@ private:
 private slots:
     void handleInputMessages();
     void handleData(); //!< Handle data when samples have to be processed
+    void handleDataF(); //!< Handle data when float pipeline samples have to be processed
+    void handleSharedData(); //!< Handle data when samples from the shared FIFO have to be processed
 };
 
 #endif // INCLUDE_NFMDEMODBASEBAND_H
\ No newline at end of file
@@ -69,43 +69,45 @@ NFMDemodSink::~NFMDemodSink()
 
 void NFMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
-	Complex ci;
+    m_channelSamples.clear();
+    shiftAndResample(begin, end, m_nco, m_interpolator, m_interpolatorDistance, m_interpolatorDistanceRemain, m_channelSamples);
+    feedChannel(m_channelSamples.data(), m_channelSamples.size());
+}
 
-	for (SampleVector::const_iterator it = begin; it != end; ++it)
-	{
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
+void NFMDemodSink::feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end)
+{
+    m_channelSamples.clear();
+    shiftAndResample(begin, end, m_nco, m_interpolator, m_interpolatorDistance, m_interpolatorDistanceRemain, m_channelSamples);
+    feedChannel(m_channelSamples.data(), m_channelSamples.size());
+}
 
-        if (m_interpolatorDistance < 1.0f) // interpolate
-        {
-            while (!m_interpolator.interpolate(&m_interpolatorDistanceRemain, c, &ci))
-            {
-                processOneSample(ci);
-                m_interpolatorDistanceRemain += m_interpolatorDistance;
-            }
-        }
-        else // decimate
-        {
-            if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
-            {
-                processOneSample(ci);
-                m_interpolatorDistanceRemain += m_interpolatorDistance;
-            }
-        }
+void NFMDemodSink::feedChannel(const Complex *samples, unsigned int nbSamples)
+{
+    if (m_demodBuffer.size() < nbSamples)
+    {
+        m_demodBuffer.resize(nbSamples);
+        m_magsqBuffer.resize(nbSamples);
     }
 
+    // discriminate the whole block first
+    for (unsigned int i = 0; i < nbSamples; i++)
+    {
+        double magsqRaw;
+        Real deviation;
+        m_demodBuffer[i] = m_phaseDiscri.phaseDiscriminatorDelta(samples[i], magsqRaw, deviation);
+        m_magsqBuffer[i] = magsqRaw / (SDR_RX_SCALED*SDR_RX_SCALED);
+    }
+
+    // then squelch, CTCSS and audio filtering
+    for (unsigned int i = 0; i < nbSamples; i++) {
+        processOneSample(m_demodBuffer[i], m_magsqBuffer[i]);
+    }
 }
 
-void NFMDemodSink::processOneSample(Complex &ci)
+void NFMDemodSink::processOneSample(Real demod, Real magsq)
 {
     qint16 sample;
 
-    double magsqRaw; // = ci.real()*ci.real() + c.imag()*c.imag();
-    Real deviation;
-
-    Real demod = m_phaseDiscri.phaseDiscriminatorDelta(ci, magsqRaw, deviation);
-
-    Real magsq = magsqRaw / (SDR_RX_SCALED*SDR_RX_SCALED);
     m_movingAverage(magsq);
     m_magsqSum += magsq;
 
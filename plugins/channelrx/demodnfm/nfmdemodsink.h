@@ -41,6 +41,8 @@ public:
 	~NFMDemodSink();
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+	virtual void feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end);
+    virtual void feedChannel(const Complex *samples, unsigned int nbSamples);
 
 	const Real *getCtcssToneSet(int& nbTones) const {
 		nbTones = m_ctcssDetector.getNTones();
@@ -108,6 +110,9 @@ private:
 	Interpolator m_interpolator;
 	Real m_interpolatorDistance;
 	Real m_interpolatorDistanceRemain;
+    ComplexVector m_channelSamples; //!< channel rate samples of the current block
+    std::vector<Real> m_demodBuffer;
+    std::vector<Real> m_magsqBuffer;
 	Lowpass<Real> m_ctcssLowpass;
 	Bandpass<Real> m_bandpass;
     Lowpass<Real> m_lowpass;
@@ -138,7 +143,7 @@ private:
     static const double afSqTones[];
     static const double afSqTones_lowrate[];
 
-    void processOneSample(Complex &ci);
+    void processOneSample(Real demod, Real magsq);
     MessageQueue *getMessageQueueToGUI() { return m_messageQueueToGUI; }
 
     inline float arctan2(Real y, Real x)
@@ -88,6 +88,12 @@ void SSBDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
     m_basebandSink->feed(begin, end);
 }
 
+void SSBDemod::feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly)
+{
+    (void) positiveOnly;
+    m_basebandSink->feedF(begin, end);
+}
+
 void SSBDemod::start()
 {
     qDebug() << "SSBDemod::start";
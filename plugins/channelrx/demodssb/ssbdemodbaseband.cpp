@@ -26,10 +26,15 @@
 MESSAGE_CLASS_DEFINITION(SSBDemodBaseband::MsgConfigureSSBDemodBaseband, Message)
 
 SSBDemodBaseband::SSBDemodBaseband() :
+    m_sharedFifo(nullptr),
+    m_sharedFifoReaderIndex(-1),
     m_messageQueueToGUI(nullptr),
     m_mutex(QMutex::Recursive)
 {
+    m_sampleFifo.setLockFree(true); // written by the device engine thread only and read by the baseband thread only
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_sampleFifoF.setLockFree(true);
+    m_sampleFifoF.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
 
     qDebug("SSBDemodBaseband::SSBDemodBaseband");
@@ -40,6 +45,13 @@ SSBDemodBaseband::SSBDemodBaseband() :
         &SSBDemodBaseband::handleData,
         Qt::QueuedConnection
     );
+    QObject::connect(
+        &m_sampleFifoF,
+        &SampleSinkFifoF::dataReady,
+        this,
+        &SSBDemodBaseband::handleDataF,
+        Qt::QueuedConnection
+    );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
     m_audioSampleRate = DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate();
@@ -59,6 +71,7 @@ void SSBDemodBaseband::reset()
     QMutexLocker mutexLocker(&m_mutex);
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
     m_sampleFifo.reset();
+    m_sampleFifoF.reset();
 }
 
 void SSBDemodBaseband::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
@@ -66,6 +79,11 @@ void SSBDemodBaseband::feed(const SampleVector::const_iterator& begin, const Sam
     m_sampleFifo.write(begin, end);
 }
 
+void SSBDemodBaseband::feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end)
+{
+    m_sampleFifoF.write(begin, end);
+}
+
 void SSBDemodBaseband::handleData()
 {
     QMutexLocker mutexLocker(&m_mutex);
@@ -93,6 +111,115 @@ void SSBDemodBaseband::handleData()
     }
 }
 
+void SSBDemodBaseband::handleDataF()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    while ((m_sampleFifoF.fill() > 0) && (m_inputMessageQueue.size() == 0))
+    {
+		FSampleVector::iterator part1begin;
+		FSampleVector::iterator part1end;
+		FSampleVector::iterator part2begin;
+		FSampleVector::iterator part2end;
+
+        std::size_t count = m_sampleFifoF.readBegin(m_sampleFifoF.fill(), &part1begin, &part1end, &part2begin, &part2end);
+
+		// first part of FIFO data
+        if (part1begin != part1end) {
+            m_channelizer->feedF(part1begin, part1end);
+        }
+
+		// second part of FIFO data (used when block wraps around)
+		if(part2begin != part2end) {
+            m_channelizer->feedF(part2begin, part2end);
+        }
+
+		m_sampleFifoF.readCommit((unsigned int) count);
+    }
+}
+
+bool SSBDemodBaseband::setSharedFifo(SampleSinkSharedFifo *sharedFifo)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_sharedFifo)
+    {
+        QObject::disconnect(m_sharedFifo, &SampleSinkSharedFifo::dataReady, this, &SSBDemodBaseband::handleSharedData);
+        m_sharedFifo->unregisterReader(m_sharedFifoReaderIndex);
+        m_sharedFifo = nullptr;
+        m_sharedFifoReaderIndex = -1;
+    }
+
+    if (sharedFifo)
+    {
+        m_sharedFifoReaderIndex = sharedFifo->registerReader();
+
+        if (m_sharedFifoReaderIndex < 0) {
+            return false;
+        }
+
+        m_sharedFifo = sharedFifo;
+        QObject::connect(
+            m_sharedFifo,
+            &SampleSinkSharedFifo::dataReady,
+            this,
+            &SSBDemodBaseband::handleSharedData,
+            Qt::QueuedConnection
+        );
+    }
+
+    return true;
+}
+
+bool SSBDemodBaseband::getFifoStats(SampleFifoStats& stats) const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_sharedFifo) {
+        m_sharedFifo->getStats(m_sharedFifoReaderIndex, stats);
+    } else {
+        m_sampleFifo.getStats(stats);
+
+        if (stats.m_nbWritten == 0) { // float pipeline input
+            m_sampleFifoF.getStats(stats);
+        }
+    }
+
+    return true;
+}
+
+void SSBDemodBaseband::handleSharedData()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_sharedFifo) {
+        return;
+    }
+
+    while ((m_sharedFifo->fill(m_sharedFifoReaderIndex) > 0) && (m_inputMessageQueue.size() == 0))
+    {
+		SampleVector::iterator part1begin;
+		SampleVector::iterator part1end;
+		SampleVector::iterator part2begin;
+		SampleVector::iterator part2end;
+
+        std::size_t count = m_sharedFifo->readBegin(m_sharedFifoReaderIndex, m_sharedFifo->fill(m_sharedFifoReaderIndex),
+            &part1begin, &part1end, &part2begin, &part2end);
+
+		// first part of FIFO data
+        if (part1begin != part1end) {
+            m_channelizer->feed(part1begin, part1end);
+        }
+
+		// second part of FIFO data (used when block wraps around)
+		if(part2begin != part2end) {
+            m_channelizer->feed(part2begin, part2end);
+        }
+
+		m_sharedFifo->readCommit(m_sharedFifoReaderIndex, (unsigned int) count);
+    }
+}
+
 void SSBDemodBaseband::handleInputMessages()
 {
 	Message* message;
@@ -123,6 +250,7 @@ bool SSBDemodBaseband::handleMessage(const Message& cmd)
         DSPSignalNotification& notif = (DSPSignalNotification&) cmd;
         qDebug() << "SSBDemodBaseband::handleMessage: DSPSignalNotification: basebandSampleRate: " << notif.getSampleRate();
         m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(notif.getSampleRate()));
+        m_sampleFifoF.setSize(SampleSinkFifo::getSizePolicy(notif.getSampleRate()));
         m_channelizer->setBasebandSampleRate(notif.getSampleRate());
         m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
         m_sink.applyAudioSampleRate(m_audioSampleRate); // reapply in case of channel sample rate change
@@ -86,33 +86,41 @@ SSBDemodSink::~SSBDemodSink()
 
 void SSBDemodSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
-    Complex ci;
+    m_channelSamples.clear();
+    shiftAndResample(begin, end, m_nco, m_interpolator, m_interpolatorDistance, m_interpolatorDistanceRemain, m_channelSamples);
+    feedChannel(m_channelSamples.data(), m_channelSamples.size());
+}
 
-	for(SampleVector::const_iterator it = begin; it < end; ++it)
-	{
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
+void SSBDemodSink::feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end)
+{
+    m_channelSamples.clear();
+    shiftAndResample(begin, end, m_nco, m_interpolator, m_interpolatorDistance, m_interpolatorDistanceRemain, m_channelSamples);
+    feedChannel(m_channelSamples.data(), m_channelSamples.size());
+}
 
-        if (m_interpolatorDistance < 1.0f) // interpolate
-        {
-            while (!m_interpolator.interpolate(&m_interpolatorDistanceRemain, c, &ci))
-            {
-                processOneSample(ci);
-                m_interpolatorDistanceRemain += m_interpolatorDistance;
-            }
-        }
-        else
-        {
-            if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
-            {
-                processOneSample(ci);
-                m_interpolatorDistanceRemain += m_interpolatorDistance;
-            }
-        }
+void SSBDemodSink::feedChannel(const Complex *samples, unsigned int nbSamples)
+{
+    for (unsigned int i = 0; i < nbSamples; i++) {
+        processOneSample(samples[i]);
     }
+
+    // audio and spectrum are flushed once per block
+	uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
+
+	if (res != m_audioBufferFill) {
+        qDebug("SSBDemodSink::feedChannel: %u/%u tail samples written", res, m_audioBufferFill);
+	}
+
+	m_audioBufferFill = 0;
+
+	if (m_spectrumSink != 0) {
+		m_spectrumSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end(), !m_dsb);
+	}
+
+	m_sampleBuffer.clear();
 }
 
-void SSBDemodSink::processOneSample(Complex &ci)
+void SSBDemodSink::processOneSample(const Complex &ci)
 {
 	fftfilt::cmplx *sideband;
 	int n_out = 0;
@@ -209,20 +217,6 @@ void SSBDemodSink::processOneSample(Complex &ci)
             m_audioBufferFill = 0;
         }
     }
-
-	uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
-
-	if (res != m_audioBufferFill) {
-        qDebug("SSBDemodSink::feed: %u/%u tail samples written", res, m_audioBufferFill);
-	}
-
-	m_audioBufferFill = 0;
-
-	if (m_spectrumSink != 0) {
-		m_spectrumSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end(), !m_dsb);
-	}
-
-	m_sampleBuffer.clear();
 }
 
 void SSBDemodSink::applyChannelSettings(int channelSampleRate, int channelFrequencyOffset, bool force)
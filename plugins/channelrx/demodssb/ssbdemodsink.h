@@ -38,6 +38,8 @@ public:
 	~SSBDemodSink();
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+	virtual void feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end);
+    virtual void feedChannel(const Complex *samples, unsigned int nbSamples);
 
 	void setSpectrumSink(BasebandSampleSink* spectrumSink) { m_spectrumSink = spectrumSink; }
 	void applyChannelSettings(int inputSampleRate, int inputFrequencyOffset, bool force = false);
@@ -110,6 +112,7 @@ private:
     Interpolator m_interpolator;
     Real m_interpolatorDistance;
     Real m_interpolatorDistanceRemain;
+    ComplexVector m_channelSamples; //!< channel rate samples of the current block
 	fftfilt* SSBFilter;
 	fftfilt* DSBFilter;
 
@@ -124,7 +127,7 @@ private:
 	static const int m_ssbFftLen;
 	static const int m_agcTarget;
 
-    void processOneSample(Complex &ci);
+    void processOneSample(const Complex &ci);
 };
 
 #endif // INCLUDE_SSBDEMODSINK_H
\ No newline at end of file
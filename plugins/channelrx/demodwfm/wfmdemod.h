@@ -68,6 +68,9 @@ public:
 	virtual void start();
 	virtual void stop();
 	virtual bool handleMessage(const Message& cmd);
+	virtual bool setSharedFifo(SampleSinkSharedFifo *sharedFifo) { return m_basebandSink->setSharedFifo(sharedFifo); }
+	virtual bool getFifoStats(SampleFifoStats& stats) const { return m_basebandSink->getFifoStats(stats); }
+	virtual bool getSquelchState(bool& open) const { open = getSquelchOpen(); return true; }
 
     virtual void getIdentifier(QString& id) { id = m_channelId; }
     virtual const QString& getURI() const { return m_channelIdURI; }
@@ -26,8 +26,11 @@
 MESSAGE_CLASS_DEFINITION(WFMDemodBaseband::MsgConfigureWFMDemodBaseband, Message)
 
 WFMDemodBaseband::WFMDemodBaseband() :
+    m_sharedFifo(nullptr),
+    m_sharedFifoReaderIndex(-1),
     m_mutex(QMutex::Recursive)
 {
+    m_sampleFifo.setLockFree(true); // written by the device engine thread only and read by the baseband thread only
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
 
@@ -90,6 +93,84 @@ void WFMDemodBaseband::handleData()
     }
 }
 
+bool WFMDemodBaseband::setSharedFifo(SampleSinkSharedFifo *sharedFifo)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_sharedFifo)
+    {
+        QObject::disconnect(m_sharedFifo, &SampleSinkSharedFifo::dataReady, this, &WFMDemodBaseband::handleSharedData);
+        m_sharedFifo->unregisterReader(m_sharedFifoReaderIndex);
+        m_sharedFifo = nullptr;
+        m_sharedFifoReaderIndex = -1;
+    }
+
+    if (sharedFifo)
+    {
+        m_sharedFifoReaderIndex = sharedFifo->registerReader();
+
+        if (m_sharedFifoReaderIndex < 0) {
+            return false;
+        }
+
+        m_sharedFifo = sharedFifo;
+        QObject::connect(
+            m_sharedFifo,
+            &SampleSinkSharedFifo::dataReady,
+            this,
+            &WFMDemodBaseband::handleSharedData,
+            Qt::QueuedConnection
+        );
+    }
+
+    return true;
+}
+
+bool WFMDemodBaseband::getFifoStats(SampleFifoStats& stats) const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_sharedFifo) {
+        m_sharedFifo->getStats(m_sharedFifoReaderIndex, stats);
+    } else {
+        m_sampleFifo.getStats(stats);
+    }
+
+    return true;
+}
+
+void WFMDemodBaseband::handleSharedData()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_sharedFifo) {
+        return;
+    }
+
+    while ((m_sharedFifo->fill(m_sharedFifoReaderIndex) > 0) && (m_inputMessageQueue.size() == 0))
+    {
+		SampleVector::iterator part1begin;
+		SampleVector::iterator part1end;
+		SampleVector::iterator part2begin;
+		SampleVector::iterator part2end;
+
+        std::size_t count = m_sharedFifo->readBegin(m_sharedFifoReaderIndex, m_sharedFifo->fill(m_sharedFifoReaderIndex),
+            &part1begin, &part1end, &part2begin, &part2end);
+
+		// first part of FIFO data
+        if (part1begin != part1end) {
+            m_channelizer->feed(part1begin, part1end);
+        }
+
+		// second part of FIFO data (used when block wraps around)
+		if(part2begin != part2end) {
+            m_channelizer->feed(part2begin, part2end);
+        }
+
+		m_sharedFifo->readCommit(m_sharedFifoReaderIndex, (unsigned int) count);
+    }
+}
+
 void WFMDemodBaseband::handleInputMessages()
 {
 	Message* message;
@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinksharedfifo.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -60,6 +61,8 @@ public:
     ~WFMDemodBaseband();
     void reset();
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    bool setSharedFifo(SampleSinkSharedFifo *sharedFifo);
+    bool getFifoStats(SampleFifoStats& stats) const;
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
     int getChannelSampleRate() const;
     void setBasebandSampleRate(int sampleRate);
@@ -72,11 +75,13 @@ public:
 
 private:
     SampleSinkFifo m_sampleFifo;
+    SampleSinkSharedFifo *m_sharedFifo; //!< device engine FIFO read in place of m_sampleFifo when set
+    int m_sharedFifoReaderIndex;
     DownChannelizer *m_channelizer;
     WFMDemodSink m_sink;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     WFMDemodSettings m_settings;
-    QMutex m_mutex;
+    mutable QMutex m_mutex;
 
     bool handleMessage(const Message& cmd);
     void applySettings(const WFMDemodSettings& settings, bool force = false);
@@ -84,6 +89,7 @@ private:
 private slots:
     void handleInputMessages();
     void handleData(); //!< Handle data when samples have to be processed
+    void handleSharedData(); //!< Handle data when samples from the shared FIFO have to be processed
 };
 
 #endif // INCLUDE_WFMDEMODBASEBAND_H
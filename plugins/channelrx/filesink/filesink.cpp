@@ -100,6 +100,7 @@ void FileSink::start()
     m_basebandSink->setMessageQueueToGUI(getMessageQueueToGUI());
     m_basebandSink->setDeviceHwId(m_deviceAPI->getHardwareId());
     m_basebandSink->setDeviceUId(m_deviceAPI->getDeviceUID());
+    m_basebandSink->setDeviceAPI(m_deviceAPI);
     m_basebandSink->startWork();
     m_thread.start();
 
@@ -266,6 +267,27 @@ void FileSink::applySettings(const FileSinkSettings& settings, bool force)
     if ((settings.m_squelchRecordingEnable != m_settings.m_squelchRecordingEnable) || force) {
         reverseAPIKeys.append("squelchRecordingEnable");
     }
+    if ((settings.m_squelchChannelIndex != m_settings.m_squelchChannelIndex) || force) {
+        reverseAPIKeys.append("squelchChannelIndex");
+    }
+    if ((settings.m_directIO != m_settings.m_directIO) || force) {
+        reverseAPIKeys.append("directIO");
+    }
+    if ((settings.m_preallocation != m_settings.m_preallocation) || force) {
+        reverseAPIKeys.append("preallocation");
+    }
+    if ((settings.m_chunkedFormat != m_settings.m_chunkedFormat) || force) {
+        reverseAPIKeys.append("chunkedFormat");
+    }
+    if ((settings.m_compressedFormat != m_settings.m_compressedFormat) || force) {
+        reverseAPIKeys.append("compressedFormat");
+    }
+    if ((settings.m_compressionBits != m_settings.m_compressionBits) || force) {
+        reverseAPIKeys.append("compressionBits");
+    }
+    if ((settings.m_subBands != m_settings.m_subBands) || force) {
+        reverseAPIKeys.append("subBands");
+    }
 
     if (m_settings.m_streamIndex != settings.m_streamIndex)
     {
@@ -329,6 +351,15 @@ unsigned int FileSink::getNbTracks() const
     }
 }
 
+unsigned int FileSink::getNbDroppedBuffers() const
+{
+    if (m_basebandSink) {
+        return m_basebandSink->getNbDroppedBuffers();
+    } else {
+        return 0;
+    }
+}
+
 int FileSink::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
@@ -402,6 +433,12 @@ int FileSink::webapiActionsPost(
             }
         }
 
+        if (channelActionsKeys.contains("trigger") && (swgFileSinkActions->getTrigger() != 0))
+        {
+            FileSinkBaseband::MsgTriggerFileSinkRecording *msg = FileSinkBaseband::MsgTriggerFileSinkRecording::create();
+            m_basebandSink->getInputMessageQueue()->push(msg);
+        }
+
         return 202;
     }
     else
@@ -446,6 +483,41 @@ void FileSink::webapiUpdateChannelSettings(
     if (channelSettingsKeys.contains("squelchRecordingEnable")) {
         settings.m_squelchRecordingEnable = response.getFileSinkSettings()->getSquelchRecordingEnable() != 0;
     }
+    if (channelSettingsKeys.contains("squelchChannelIndex")) {
+        settings.m_squelchChannelIndex = response.getFileSinkSettings()->getSquelchChannelIndex();
+    }
+    if (channelSettingsKeys.contains("directIO")) {
+        settings.m_directIO = response.getFileSinkSettings()->getDirectIo() != 0;
+    }
+    if (channelSettingsKeys.contains("preallocation")) {
+        settings.m_preallocation = response.getFileSinkSettings()->getPreallocation();
+    }
+    if (channelSettingsKeys.contains("chunkedFormat")) {
+        settings.m_chunkedFormat = response.getFileSinkSettings()->getChunkedFormat() != 0;
+    }
+    if (channelSettingsKeys.contains("compressedFormat")) {
+        settings.m_compressedFormat = response.getFileSinkSettings()->getCompressedFormat() != 0;
+    }
+    if (channelSettingsKeys.contains("compressionBits")) {
+        settings.m_compressionBits = response.getFileSinkSettings()->getCompressionBits();
+    }
+    if (channelSettingsKeys.contains("subBands"))
+    {
+        QList<SWGSDRangel::SWGFileSinkSubBand*> *subBands = response.getFileSinkSettings()->getSubBands();
+        settings.m_subBands.clear();
+
+        for (const auto& itSubBand : *subBands)
+        {
+            if (settings.m_subBands.size() == FileSinkSettings::m_maxSubBands) {
+                break;
+            }
+
+            FileSinkSettings::SubBand subBand;
+            subBand.m_inputFrequencyOffset = itSubBand->getInputFrequencyOffset();
+            subBand.m_log2Decim = itSubBand->getLog2Decim() < 0 ? 0 : itSubBand->getLog2Decim() > 6 ? 6 : itSubBand->getLog2Decim();
+            settings.m_subBands.append(subBand);
+        }
+    }
     if (channelSettingsKeys.contains("streamIndex")) {
         settings.m_streamIndex = response.getFileSinkSettings()->getStreamIndex();
     }
@@ -493,6 +565,13 @@ void FileSink::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& resp
     response.getFileSinkSettings()->setPreRecordTime(settings.m_preRecordTime);
     response.getFileSinkSettings()->setSquelchPostRecordTime(settings.m_squelchPostRecordTime);
     response.getFileSinkSettings()->setSquelchRecordingEnable(settings.m_squelchRecordingEnable ? 1 : 0);
+    response.getFileSinkSettings()->setSquelchChannelIndex(settings.m_squelchChannelIndex);
+    response.getFileSinkSettings()->setDirectIo(settings.m_directIO ? 1 : 0);
+    response.getFileSinkSettings()->setPreallocation(settings.m_preallocation);
+    response.getFileSinkSettings()->setChunkedFormat(settings.m_chunkedFormat ? 1 : 0);
+    response.getFileSinkSettings()->setCompressedFormat(settings.m_compressedFormat ? 1 : 0);
+    response.getFileSinkSettings()->setCompressionBits(settings.m_compressionBits);
+    webapiFormatSubBands(response.getFileSinkSettings(), settings);
     response.getFileSinkSettings()->setStreamIndex(settings.m_streamIndex);
     response.getFileSinkSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
@@ -507,6 +586,26 @@ void FileSink::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& resp
     response.getFileSinkSettings()->setReverseApiChannelIndex(settings.m_reverseAPIChannelIndex);
 }
 
+void FileSink::webapiFormatSubBands(SWGSDRangel::SWGFileSinkSettings *swgFileSinkSettings, const FileSinkSettings& settings)
+{
+    if (swgFileSinkSettings->getSubBands())
+    {
+        qDeleteAll(*swgFileSinkSettings->getSubBands());
+        swgFileSinkSettings->getSubBands()->clear();
+    }
+    else
+    {
+        swgFileSinkSettings->setSubBands(new QList<SWGSDRangel::SWGFileSinkSubBand*>);
+    }
+
+    for (const auto& subBand : settings.m_subBands)
+    {
+        swgFileSinkSettings->getSubBands()->append(new SWGSDRangel::SWGFileSinkSubBand);
+        swgFileSinkSettings->getSubBands()->back()->setInputFrequencyOffset(subBand.m_inputFrequencyOffset);
+        swgFileSinkSettings->getSubBands()->back()->setLog2Decim(subBand.m_log2Decim);
+    }
+}
+
 void FileSink::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response)
 {
     response.getFileSinkReport()->setSpectrumSquelch(m_basebandSink->isSquelchOpen() ? 1 : 0);
@@ -516,6 +615,7 @@ void FileSink::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response
     response.getFileSinkReport()->setRecordSize(getByteCount());
     response.getFileSinkReport()->setRecording(m_basebandSink->isRecording() ? 1 : 0);
     response.getFileSinkReport()->setRecordCaptures(getNbTracks());
+    response.getFileSinkReport()->setDroppedBuffers(getNbDroppedBuffers());
     response.getFileSinkReport()->setChannelSampleRate(m_basebandSink->getChannelSampleRate());
 }
 
@@ -561,6 +661,27 @@ void FileSink::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, co
     if (channelSettingsKeys.contains("squelchRecordingEnable")) {
         swgFileSinkSettings->setSquelchRecordingEnable(settings.m_squelchRecordingEnable ? 1 : 0);
     }
+    if (channelSettingsKeys.contains("squelchChannelIndex")) {
+        swgFileSinkSettings->setSquelchChannelIndex(settings.m_squelchChannelIndex);
+    }
+    if (channelSettingsKeys.contains("directIO")) {
+        swgFileSinkSettings->setDirectIo(settings.m_directIO ? 1 : 0);
+    }
+    if (channelSettingsKeys.contains("preallocation")) {
+        swgFileSinkSettings->setPreallocation(settings.m_preallocation);
+    }
+    if (channelSettingsKeys.contains("chunkedFormat")) {
+        swgFileSinkSettings->setChunkedFormat(settings.m_chunkedFormat ? 1 : 0);
+    }
+    if (channelSettingsKeys.contains("compressedFormat")) {
+        swgFileSinkSettings->setCompressedFormat(settings.m_compressedFormat ? 1 : 0);
+    }
+    if (channelSettingsKeys.contains("compressionBits")) {
+        swgFileSinkSettings->setCompressionBits(settings.m_compressionBits);
+    }
+    if (channelSettingsKeys.contains("subBands")) {
+        webapiFormatSubBands(swgFileSinkSettings, settings);
+    }
     if (channelSettingsKeys.contains("streamIndex")) {
         swgFileSinkSettings->setStreamIndex(settings.m_streamIndex);
     }
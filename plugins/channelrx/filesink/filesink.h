@@ -36,6 +36,10 @@ class DeviceAPI;
 class DeviceSampleSource;
 class FileSinkBaseband;
 
+namespace SWGSDRangel {
+    class SWGFileSinkSettings;
+}
+
 class FileSink : public BasebandSampleSink, public ChannelAPI {
     Q_OBJECT
 public:
@@ -124,6 +128,7 @@ public:
     uint64_t getMsCount() const;
     uint64_t getByteCount() const;
     unsigned int getNbTracks() const;
+    unsigned int getNbDroppedBuffers() const;
 
     static const QString m_channelIdURI;
     static const QString m_channelId;
@@ -147,6 +152,7 @@ private:
     DeviceSampleSource *getLocalDevice(uint32_t index);
 
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
+    static void webapiFormatSubBands(SWGSDRangel::SWGFileSinkSettings *swgFileSinkSettings, const FileSinkSettings& settings);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const FileSinkSettings& settings, bool force);
 
 private slots:
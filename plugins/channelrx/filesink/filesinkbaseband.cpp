@@ -21,6 +21,8 @@
 #include "dsp/dspengine.h"
 #include "dsp/dspcommands.h"
 #include "dsp/spectrumvis.h"
+#include "dsp/filerecordinterface.h"
+#include "device/deviceapi.h"
 #include "util/db.h"
 
 #include "filesinkmessages.h"
@@ -28,8 +30,10 @@
 
 MESSAGE_CLASS_DEFINITION(FileSinkBaseband::MsgConfigureFileSinkBaseband, Message)
 MESSAGE_CLASS_DEFINITION(FileSinkBaseband::MsgConfigureFileSinkWork, Message)
+MESSAGE_CLASS_DEFINITION(FileSinkBaseband::MsgTriggerFileSinkRecording, Message)
 
 FileSinkBaseband::FileSinkBaseband() :
+    m_deviceAPI(nullptr),
     m_running(false),
     m_specMax(0),
     m_squelchLevel(0),
@@ -47,6 +51,7 @@ FileSinkBaseband::FileSinkBaseband() :
 FileSinkBaseband::~FileSinkBaseband()
 {
     m_inputMessageQueue.clear();
+    destroySubBands();
     delete m_channelizer;
 }
 
@@ -103,13 +108,23 @@ void FileSinkBaseband::handleData()
         std::size_t count = m_sampleFifo.readBegin(m_sampleFifo.fill(), &part1begin, &part1end, &part2begin, &part2end);
 
 		// first part of FIFO data
-        if (part1begin != part1end) {
+        if (part1begin != part1end)
+        {
             m_channelizer->feed(part1begin, part1end);
+
+            for (auto& subBand : m_subBands) {
+                subBand.m_channelizer->feed(part1begin, part1end);
+            }
         }
 
 		// second part of FIFO data (used when block wraps around)
-		if(part2begin != part2end) {
+		if(part2begin != part2end)
+        {
             m_channelizer->feed(part2begin, part2end);
+
+            for (auto& subBand : m_subBands) {
+                subBand.m_channelizer->feed(part2begin, part2end);
+            }
         }
 
 		m_sampleFifo.readCommit((unsigned int) count);
@@ -158,6 +173,10 @@ bool FileSinkBaseband::handleMessage(const Message& cmd)
             m_channelizer->getChannelFrequencyOffset(),
             m_centerFrequency + m_settings.m_inputFrequencyOffset);
 
+        for (unsigned int i = 0; i < m_subBands.size(); i++) {
+            applySubBandChannelization(m_subBands[i], m_settings.m_subBands[i]);
+        }
+
 		return true;
     }
     else if (MsgConfigureFileSinkWork::match(cmd))
@@ -173,6 +192,27 @@ bool FileSinkBaseband::handleMessage(const Message& cmd)
             } else {
                 m_sink.stopRecording();
             }
+
+            for (auto& subBand : m_subBands)
+            {
+                if (conf.isWorking()) {
+                    subBand.m_sink->startRecording();
+                } else {
+                    subBand.m_sink->stopRecording();
+                }
+            }
+        }
+
+		return true;
+    }
+    else if (MsgTriggerFileSinkRecording::match(cmd))
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        qDebug() << "FileSinkBaseband::handleMessage: MsgTriggerFileSinkRecording";
+        m_sink.triggerRecording();
+
+        for (auto& subBand : m_subBands) {
+            subBand.m_sink->triggerRecording();
         }
 
 		return true;
@@ -215,34 +255,136 @@ void FileSinkBaseband::applySettings(const FileSinkSettings& settings, bool forc
     }
 
     m_sink.applySettings(settings, force);
+
+    if ((settings.m_subBands != m_settings.m_subBands) || force)
+    {
+        // sub-bands are recreated with new files and join a recording in progress
+        createSubBands(settings);
+
+        if (m_sink.isRecording() && !settings.m_squelchRecordingEnable)
+        {
+            for (auto& subBand : m_subBands) {
+                subBand.m_sink->startRecording();
+            }
+        }
+    }
+    else
+    {
+        for (unsigned int i = 0; i < m_subBands.size(); i++) {
+            m_subBands[i].m_sink->applySettings(getSubBandSettings(settings, i), force);
+        }
+    }
+
     m_settings = settings;
 }
 
+void FileSinkBaseband::createSubBands(const FileSinkSettings& settings)
+{
+    destroySubBands();
+
+    for (int i = 0; i < settings.m_subBands.size(); i++)
+    {
+        SubBand subBand;
+        subBand.m_sink = new FileSinkSink();
+        subBand.m_sink->setWriterRingMs(1000); // the default 64 MB per file would add up over the sub-bands
+        subBand.m_channelizer = new DownChannelizer(subBand.m_sink);
+        applySubBandChannelization(subBand, settings.m_subBands[i]);
+        subBand.m_sink->applySettings(getSubBandSettings(settings, i), true);
+        m_subBands.push_back(subBand);
+    }
+
+    qDebug("FileSinkBaseband::createSubBands: %u sub-bands", (unsigned int) m_subBands.size());
+}
+
+void FileSinkBaseband::destroySubBands()
+{
+    for (auto& subBand : m_subBands)
+    {
+        subBand.m_sink->stopRecording();
+        delete subBand.m_channelizer;
+        delete subBand.m_sink;
+    }
+
+    m_subBands.clear();
+}
+
+void FileSinkBaseband::applySubBandChannelization(SubBand& subBand, const FileSinkSettings::SubBand& subBandSettings)
+{
+    subBand.m_channelizer->setBasebandSampleRate(m_channelizer->getBasebandSampleRate());
+    int desiredSampleRate = m_channelizer->getBasebandSampleRate() / (1<<subBandSettings.m_log2Decim);
+    subBand.m_channelizer->setChannelization(desiredSampleRate, subBandSettings.m_inputFrequencyOffset);
+    subBand.m_sink->applyChannelSettings(
+        subBand.m_channelizer->getChannelSampleRate(),
+        desiredSampleRate,
+        subBand.m_channelizer->getChannelFrequencyOffset(),
+        m_centerFrequency + subBandSettings.m_inputFrequencyOffset,
+        true);
+}
+
+FileSinkSettings FileSinkBaseband::getSubBandSettings(const FileSinkSettings& settings, int index)
+{
+    // same recording options as the channel in a file named after the channel file
+    FileSinkSettings subBandSettings(settings);
+    subBandSettings.m_inputFrequencyOffset = settings.m_subBands[index].m_inputFrequencyOffset;
+    subBandSettings.m_log2Decim = settings.m_subBands[index].m_log2Decim;
+    subBandSettings.m_subBands.clear();
+    QString fileBase;
+
+    if (FileRecordInterface::guessTypeFromFileName(settings.m_fileRecordName, fileBase) == FileRecordInterface::RecordTypeSdrIQ) {
+        subBandSettings.m_fileRecordName = QString("%1_sb%2.sdriq").arg(fileBase).arg(index + 1);
+    }
+
+    return subBandSettings;
+}
+
 int FileSinkBaseband::getChannelSampleRate() const
 {
     return m_channelizer->getChannelSampleRate();
 }
 
+bool FileSinkBaseband::getChannelSquelchState(int channelIndex, bool& open) const
+{
+    return m_deviceAPI && m_deviceAPI->getChannelSinkSquelchState(channelIndex, open);
+}
+
 void FileSinkBaseband::tick()
 {
-    if (m_spectrumSink && m_settings.m_spectrumSquelchMode)
+    QMutexLocker mutexLocker(&m_mutex); // the sub-bands may be recreated
+    bool squelchOpen;
+
+    if (m_settings.m_squelchChannelIndex >= 0) // squelch of a demodulator of the same device set
+    {
+        if (!getChannelSquelchState(m_settings.m_squelchChannelIndex, squelchOpen)) { // no such channel or no squelch
+            squelchOpen = false;
+        }
+    }
+    else if (m_spectrumSink && m_settings.m_spectrumSquelchMode)
     {
         m_specMax = m_spectrumSink->getSpecMax();
-        bool squelchOpen = m_specMax > m_squelchLevel;
+        squelchOpen = m_specMax > m_squelchLevel;
+    }
+    else
+    {
+        return;
+    }
 
-        if (squelchOpen != m_squelchOpen)
+    if (squelchOpen != m_squelchOpen)
+    {
+        if (m_messageQueueToGUI)
         {
-            if (m_messageQueueToGUI)
-            {
-                FileSinkMessages::MsgReportSquelch *msg = FileSinkMessages::MsgReportSquelch::create(squelchOpen);
-                m_messageQueueToGUI->push(msg);
-            }
+            FileSinkMessages::MsgReportSquelch *msg = FileSinkMessages::MsgReportSquelch::create(squelchOpen);
+            m_messageQueueToGUI->push(msg);
+        }
 
-            if (m_settings.m_squelchRecordingEnable) {
-                m_sink.squelchRecording(squelchOpen);
+        if (m_settings.m_squelchRecordingEnable)
+        {
+            m_sink.squelchRecording(squelchOpen);
+
+            for (auto& subBand : m_subBands) {
+                subBand.m_sink->squelchRecording(squelchOpen);
             }
         }
-
-        m_squelchOpen = squelchOpen;
     }
+
+    m_squelchOpen = squelchOpen;
 }
@@ -22,6 +22,8 @@
 #include <QMutex>
 #include <QTimer>
 
+#include <vector>
+
 #include "dsp/samplesinkfifo.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
@@ -31,6 +33,7 @@
 
 class DownChannelizer;
 class SpectrumVis;
+class DeviceAPI;
 
 class FileSinkBaseband : public QObject
 {
@@ -79,6 +82,21 @@ public:
 		{ }
 	};
 
+	class MsgTriggerFileSinkRecording : public Message {
+		MESSAGE_CLASS_DECLARATION
+
+	public:
+		static MsgTriggerFileSinkRecording* create()
+		{
+			return new MsgTriggerFileSinkRecording();
+		}
+
+	private:
+		MsgTriggerFileSinkRecording() :
+			Message()
+		{ }
+	};
+
     FileSinkBaseband();
     ~FileSinkBaseband();
 
@@ -94,19 +112,29 @@ public:
     uint64_t getMsCount() const { return m_sink.getMsCount(); }
     uint64_t getByteCount() const { return m_sink.getByteCount(); }
     unsigned int getNbTracks() const { return m_sink.getNbTracks(); }
+    unsigned int getNbDroppedBuffers() const { return m_sink.getNbDroppedBuffers(); }
     void setMessageQueueToGUI(MessageQueue *messageQueue) { m_messageQueueToGUI = messageQueue; m_sink.setMessageQueueToGUI(messageQueue); }
     void setDeviceHwId(const QString& hwId) { m_sink.setDeviceHwId(hwId); }
     void setDeviceUId(int uid) { m_sink.setDeviceUId(uid); }
+    void setDeviceAPI(DeviceAPI *deviceAPI) { m_deviceAPI = deviceAPI; } //!< to get the squelch of the other channels
     bool isSquelchOpen() const { return m_squelchOpen; }
     bool isRecording() const { return m_sink.isRecording(); }
     float getSpecMax() const { return m_specMax; }
     int getSinkSampleRate() const { return m_sink.getSampleRate(); }
 
 private:
+    struct SubBand //!< additional sub-band recorded from the same baseband samples
+    {
+        DownChannelizer *m_channelizer;
+        FileSinkSink *m_sink;
+    };
+
     SampleSinkFifo m_sampleFifo;
     DownChannelizer *m_channelizer;
     FileSinkSink m_sink;
+    std::vector<SubBand> m_subBands;
     SpectrumVis *m_spectrumSink;
+    DeviceAPI *m_deviceAPI;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     MessageQueue *m_messageQueueToGUI;
     FileSinkSettings m_settings;
@@ -120,6 +148,11 @@ private:
 
     bool handleMessage(const Message& cmd);
     void applySettings(const FileSinkSettings& settings, bool force = false);
+    void createSubBands(const FileSinkSettings& settings);
+    void destroySubBands();
+    void applySubBandChannelization(SubBand& subBand, const FileSinkSettings::SubBand& subBandSettings);
+    static FileSinkSettings getSubBandSettings(const FileSinkSettings& settings, int index);
+    bool getChannelSquelchState(int channelIndex, bool& open) const;
 
 private slots:
     void handleInputMessages();
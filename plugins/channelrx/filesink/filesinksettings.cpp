@@ -16,6 +16,7 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <QColor>
+#include <QDataStream>
 
 #include "util/simpleserializer.h"
 #include "settings/serializable.h"
@@ -41,6 +42,13 @@ void FileSinkSettings::resetToDefaults()
     m_preRecordTime = 0;
     m_squelchPostRecordTime = 0;
     m_squelchRecordingEnable = false;
+    m_directIO = false;
+    m_preallocation = 0;
+    m_chunkedFormat = false;
+    m_compressedFormat = false;
+    m_compressionBits = 0;
+    m_squelchChannelIndex = -1;
+    m_subBands.clear();
     m_streamIndex = 0;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
@@ -74,6 +82,13 @@ QByteArray FileSinkSettings::serialize() const
     s.writeS32(16, m_preRecordTime);
     s.writeS32(17, m_squelchPostRecordTime);
     s.writeBool(18, m_squelchRecordingEnable);
+    s.writeBool(19, m_directIO);
+    s.writeS32(20, m_preallocation);
+    s.writeBool(21, m_chunkedFormat);
+    s.writeBool(22, m_compressedFormat);
+    s.writeS32(23, m_compressionBits);
+    s.writeBlob(24, serializeSubBands(m_subBands));
+    s.writeS32(25, m_squelchChannelIndex);
 
     return s.final();
 }
@@ -130,6 +145,14 @@ bool FileSinkSettings::deserialize(const QByteArray& data)
         d.readS32(16, &m_preRecordTime, 0);
         d.readS32(17, &m_squelchPostRecordTime, 0);
         d.readBool(18, &m_squelchRecordingEnable, false);
+        d.readBool(19, &m_directIO, false);
+        d.readS32(20, &m_preallocation, 0);
+        d.readBool(21, &m_chunkedFormat, false);
+        d.readBool(22, &m_compressedFormat, false);
+        d.readS32(23, &m_compressionBits, 0);
+        d.readBlob(24, &bytetmp);
+        deserializeSubBands(bytetmp, m_subBands);
+        d.readS32(25, &m_squelchChannelIndex, -1);
 
         return true;
     }
@@ -140,6 +163,44 @@ bool FileSinkSettings::deserialize(const QByteArray& data)
     }
 }
 
+QByteArray FileSinkSettings::serializeSubBands(const QList<SubBand>& subBands)
+{
+    QByteArray data;
+    QDataStream *stream = new QDataStream(&data, QIODevice::WriteOnly);
+    (*stream) << (qint32) subBands.size();
+
+    for (const auto& subBand : subBands) {
+        (*stream) << subBand.m_inputFrequencyOffset << subBand.m_log2Decim;
+    }
+
+    delete stream;
+
+    return data;
+}
+
+void FileSinkSettings::deserializeSubBands(const QByteArray& data, QList<SubBand>& subBands)
+{
+    subBands.clear();
+
+    if (data.isEmpty()) {
+        return;
+    }
+
+    QDataStream *stream = new QDataStream(data);
+    qint32 nbSubBands;
+    (*stream) >> nbSubBands;
+
+    for (int i = 0; (i < nbSubBands) && (i < m_maxSubBands) && (stream->status() == QDataStream::Ok); i++)
+    {
+        SubBand subBand;
+        (*stream) >> subBand.m_inputFrequencyOffset >> subBand.m_log2Decim;
+        subBand.m_log2Decim = subBand.m_log2Decim > 6 ? 6 : subBand.m_log2Decim;
+        subBands.append(subBand);
+    }
+
+    delete stream;
+}
+
 unsigned int FileSinkSettings::getNbFixedShiftIndexes(int log2Decim)
 {
     int decim = (1<<log2Decim);
@@ -20,11 +20,25 @@
 
 #include <QByteArray>
 #include <QString>
+#include <QList>
 
 class Serializable;
 
 struct FileSinkSettings
 {
+    struct SubBand //!< recorded in its own file at its own rate together with the channel
+    {
+        qint32 m_inputFrequencyOffset;
+        uint32_t m_log2Decim;
+
+        SubBand() : m_inputFrequencyOffset(0), m_log2Decim(0) {}
+        bool operator==(const SubBand& other) const {
+            return (m_inputFrequencyOffset == other.m_inputFrequencyOffset) && (m_log2Decim == other.m_log2Decim);
+        }
+    };
+
+    static const int m_maxSubBands = 8;
+
     bool m_ncoMode;
     qint32 m_inputFrequencyOffset;
     QString m_fileRecordName;
@@ -36,6 +50,13 @@ struct FileSinkSettings
     int m_preRecordTime;
     int m_squelchPostRecordTime;
     bool m_squelchRecordingEnable;
+    int m_squelchChannelIndex; //!< channel of the device set which squelch triggers the recording. -1 for the spectrum squelch.
+    bool m_directIO;          //!< bypass the system cache when writing the file (Linux only)
+    int m_preallocation;      //!< disk space in MB reserved when the file is created (Linux only)
+    bool m_chunkedFormat;     //!< record in the chunked .sdriq format with a seek index
+    bool m_compressedFormat;  //!< record in the compressed .sdriq format
+    int m_compressionBits;    //!< most significant bits kept by the compression. 0 for lossless.
+    QList<SubBand> m_subBands; //!< at most m_maxSubBands
     int m_streamIndex; //!< MIMO channel. Not relevant when connected to SI (single Rx).
     bool m_useReverseAPI;
     QString m_reverseAPIAddress;
@@ -51,6 +72,8 @@ struct FileSinkSettings
     QByteArray serialize() const;
     bool deserialize(const QByteArray& data);
 
+    static QByteArray serializeSubBands(const QList<SubBand>& subBands);
+    static void deserializeSubBands(const QByteArray& data, QList<SubBand>& subBands);
     static unsigned int getNbFixedShiftIndexes(int log2Decim);
     static int getHalfBand(int sampleRate, int log2Decim);
     static unsigned int getFixedShiftIndexFromOffset(int sampleRate, int log2Decim, int frequencyOffset);
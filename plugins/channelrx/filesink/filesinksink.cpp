@@ -33,8 +33,10 @@ FileSinkSink::FileSinkSink() :
     m_record(false),
     m_squelchOpen(false),
     m_postSquelchCounter(0),
+    m_triggered(false),
     m_msCount(0),
-    m_byteCount(0)
+    m_byteCount(0),
+    m_writerRingMs(0)
 {}
 
 FileSinkSink::~FileSinkSink()
@@ -48,6 +50,10 @@ void FileSinkSink::startRecording()
         qint64 mSShift = (m_preRecordFill * 1000) / m_sinkSampleRate;
         m_fileSink.setMsShift(-mSShift);
 
+        if (m_writerRingMs != 0) {
+            m_fileSink.setWriterRingSize(((quint64) m_sinkSampleRate * sizeof(Sample) * m_writerRingMs) / 1000);
+        }
+
         // notify capture start
         m_fileSink.startRecording();
         m_record = true;
@@ -86,6 +92,7 @@ void FileSinkSink::stopRecording()
         m_preRecordBuffer.reset();
         m_fileSink.stopRecording();
         m_record = false;
+        m_triggered = false;
     }
 }
 
@@ -116,7 +123,7 @@ void FileSinkSink::feed(const SampleVector::const_iterator& begin, const SampleV
         m_preRecordFill = m_preRecordBuffer.write(beginw, endw);
     }
 
-    if (m_settings.m_squelchRecordingEnable)
+    if (m_settings.m_squelchRecordingEnable || m_triggered)
     {
         int nbToWrite = endw - beginw;
 
@@ -133,13 +140,13 @@ void FileSinkSink::feed(const SampleVector::const_iterator& begin, const SampleV
             }
             else
             {
-                if (m_msgQueueToGUI)
+                if (m_record && m_msgQueueToGUI)
                 {
                     FileSinkMessages::MsgReportRecording *msg = FileSinkMessages::MsgReportRecording::create(false);
                     m_msgQueueToGUI->push(msg);
                 }
 
-                m_fileSink.feed(beginw, endw + m_postSquelchCounter, true);
+                m_fileSink.feed(beginw, beginw + m_postSquelchCounter, true);
                 nbToWrite = m_postSquelchCounter;
                 m_postSquelchCounter = 0;
 
@@ -216,9 +223,13 @@ void FileSinkSink::applyChannelSettings(
      || (m_sinkSampleRate != sinkSampleRate) || force)
     {
         DSPSignalNotification *notif = new DSPSignalNotification(sinkSampleRate, centerFrequency);
-        DSPSignalNotification *notifToSpectrum = new DSPSignalNotification(*notif);
         m_fileSink.getInputMessageQueue()->push(notif);
-        m_spectrumSink->getInputMessageQueue()->push(notifToSpectrum);
+
+        if (m_spectrumSink)
+        {
+            DSPSignalNotification *notifToSpectrum = new DSPSignalNotification(*notif);
+            m_spectrumSink->getInputMessageQueue()->push(notifToSpectrum);
+        }
 
         if (m_msgQueueToGUI)
         {
@@ -264,6 +275,23 @@ void FileSinkSink::applySettings(const FileSinkSettings& settings, bool force)
         }
     }
 
+    if ((settings.m_directIO != m_settings.m_directIO) || force) {
+        m_fileSink.setDirectIO(settings.m_directIO);
+    }
+
+    if ((settings.m_preallocation != m_settings.m_preallocation) || force) {
+        m_fileSink.setPreallocation(settings.m_preallocation * 1024ULL * 1024ULL);
+    }
+
+    if ((settings.m_chunkedFormat != m_settings.m_chunkedFormat) || force) {
+        m_fileSink.setChunked(settings.m_chunkedFormat);
+    }
+
+    if ((settings.m_compressedFormat != m_settings.m_compressedFormat)
+     || (settings.m_compressionBits != m_settings.m_compressionBits) || force) {
+        m_fileSink.setCompression(settings.m_compressedFormat, settings.m_compressionBits);
+    }
+
     if ((settings.m_preRecordTime != m_settings.m_squelchPostRecordTime) || force)
     {
         m_preRecordBuffer.setSize(settings.m_preRecordTime * m_sinkSampleRate);
@@ -301,4 +329,32 @@ void FileSinkSink::squelchRecording(bool squelchOpen)
     }
 
     m_squelchOpen = squelchOpen;
+}
+
+void FileSinkSink::triggerRecording()
+{
+    if (!m_recordEnabled) {
+        return;
+    }
+
+    bool startedByTrigger = !m_record;
+
+    if (startedByTrigger)
+    {
+        startRecording();
+
+        if (m_msgQueueToGUI)
+        {
+            FileSinkMessages::MsgReportRecording *msg = FileSinkMessages::MsgReportRecording::create(true);
+            m_msgQueueToGUI->push(msg);
+        }
+    }
+
+    // a new trigger extends a triggered or squelch capture but leaves a manual recording alone.
+    // An open squelch keeps recording anyway.
+    if ((startedByTrigger || m_triggered || m_settings.m_squelchRecordingEnable) && !m_squelchOpen)
+    {
+        m_postSquelchCounter = m_settings.m_squelchPostRecordTime * m_sinkSampleRate;
+        m_triggered = true;
+    }
 }
\ No newline at end of file
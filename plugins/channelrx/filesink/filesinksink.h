@@ -52,10 +52,13 @@ public:
     uint64_t getMsCount() const { return m_msCount; }
     uint64_t getByteCount() const { return m_byteCount; }
     unsigned int getNbTracks() const { return m_nbCaptures; }
+    unsigned int getNbDroppedBuffers() const { return m_fileSink.getNbDroppedBuffers(); }
     void setMessageQueueToGUI(MessageQueue *messageQueue) { m_msgQueueToGUI = messageQueue; }
     void squelchRecording(bool squelchOpen);
+    void triggerRecording(); //!< records the pre-record time and the post record time then stops
     int getSampleRate() const { return m_sinkSampleRate; }
     bool isRecording() const { return m_record; }
+    void setWriterRingMs(unsigned int writerRingMs) { m_writerRingMs = writerRingMs; } //!< storage buffers sized for this time at the sink sample rate. 0 for the default size.
 
 private:
     int m_channelSampleRate;
@@ -77,10 +80,12 @@ private:
     bool m_record;
     bool m_squelchOpen;
     int m_postSquelchCounter;
+    bool m_triggered;        //!< event capture in progress
     QString m_deviceHwId;
     int m_deviceUId;
     uint64_t m_msCount;
     uint64_t m_byteCount;
+    unsigned int m_writerRingMs;
 };
 
 #endif // INCLUDE_FILESINKSINK_H_
@@ -187,6 +187,13 @@ void FileSourceSource::openFileStream(const QString& fileName)
 	    if (crcOK)
 	    {
 	        qDebug("FileSourceSource::openFileStream: CRC32 OK for header: %s", qPrintable(crcHex));
+
+	        if (FileRecord::isChunked(header)) {
+	            qWarning("FileSourceSource::openFileStream: chunked format is not supported: chunk headers are played as samples");
+	        } else if (FileRecord::isCompressed(header)) {
+	            qWarning("FileSourceSource::openFileStream: compressed format is not supported: coded data is played as samples");
+	        }
+
 	        m_recordLengthMuSec = ((fileSize - sizeof(FileRecord::Header)) * 1000000UL) / ((m_sampleSize == 24 ? 8 : 4) * m_fileSampleRate);
 	    }
 	    else
@@ -76,6 +76,7 @@ void FileOutput::openFileStream()
     m_startingTimeStamp = time(0);
     header.startTimeStamp = m_startingTimeStamp;
     header.sampleSize = SDR_RX_SAMP_SZ;
+    header.filler = 0;
 
     FileRecord::writeHeader(m_ofstream, header);
 
@@ -18,6 +18,10 @@
 #include <string.h>
 #include <errno.h>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#endif
+
 #include <QDebug>
 #include <QNetworkReply>
 #include <QBuffer>
@@ -52,6 +56,8 @@ MESSAGE_CLASS_DEFINITION(FileInput::MsgReportHeaderCRC, Message)
 FileInput::FileInput(DeviceAPI *deviceAPI) :
     m_deviceAPI(deviceAPI),
 	m_settings(),
+	m_mappedData(nullptr),
+	m_mappedSize(0),
 	m_fileInputWorker(nullptr),
 	m_deviceDescription(),
 	m_fileName("..."),
@@ -59,6 +65,7 @@ FileInput::FileInput(DeviceAPI *deviceAPI) :
 	m_sampleSize(0),
 	m_centerFrequency(435000000),
 	m_recordLengthMuSec(0),
+	m_compressed(false),
     m_startingTimeStamp(0)
 {
     m_deviceAPI->setNbSourceStreams(1);
@@ -78,6 +85,7 @@ FileInput::~FileInput()
     delete m_networkManager;
 
 	stop();
+	unmapFile();
 }
 
 void FileInput::destroy()
@@ -93,6 +101,8 @@ void FileInput::openFileStream()
 		m_ifstream.close();
 	}
 
+	unmapFile();
+
 #ifdef Q_OS_WIN
 	m_ifstream.open(m_fileName.toStdWString().c_str(), std::ios::binary | std::ios::ate);
 #else
@@ -114,11 +124,26 @@ void FileInput::openFileStream()
 	    if (crcOK)
 	    {
 	        qDebug("FileInput::openFileStream: CRC32 OK for header: %s", qPrintable(crcHex));
-	        m_recordLengthMuSec = ((fileSize - sizeof(FileRecord::Header)) * 1000000UL) / ((m_sampleSize == 24 ? 8 : 4) * m_sampleRate);
+
+	        if (FileRecord::readChunkIndex(m_ifstream, fileSize, header, m_chunkIndex))
+	        {
+	            m_recordLengthMuSec = FileRecord::getRecordLengthMuSec(m_chunkIndex);
+	            m_sampleRate = m_chunkIndex.front().sampleRate;
+	            m_centerFrequency = m_chunkIndex.front().centerFrequency;
+	            m_compressed = FileRecord::isCompressed(header);
+	            qDebug("FileInput::openFileStream: %s format: %u chunks",
+	                m_compressed ? "compressed" : FileRecord::isChunked(header) ? "chunked" : "original",
+	                (unsigned int) m_chunkIndex.size());
+	        }
+	        else
+	        {
+	            m_recordLengthMuSec = 0;
+	        }
 	    }
 	    else
 	    {
 	        qCritical("FileInput::openFileStream: bad CRC32 for header: %s", qPrintable(crcHex));
+	        m_chunkIndex.clear();
 	        m_recordLengthMuSec = 0;
 	    }
 
@@ -130,6 +155,7 @@ void FileInput::openFileStream()
 	}
 	else
 	{
+		m_chunkIndex.clear();
 		m_recordLengthMuSec = 0;
 	}
 
@@ -154,6 +180,45 @@ void FileInput::openFileStream()
 
 	if (m_recordLengthMuSec == 0) {
 	    m_ifstream.close();
+	} else {
+	    mapFile(fileSize);
+	}
+}
+
+void FileInput::mapFile(quint64 fileSize)
+{
+	m_mappedFile.setFileName(m_fileName);
+
+	if (m_mappedFile.open(QIODevice::ReadOnly)) {
+		m_mappedData = m_mappedFile.map(0, fileSize);
+	}
+
+	if (m_mappedData)
+	{
+		m_mappedSize = fileSize;
+#if defined(__unix__) || defined(__APPLE__)
+		posix_madvise(m_mappedData, m_mappedSize, POSIX_MADV_SEQUENTIAL); // aggressive read ahead and early page release
+#endif
+		qDebug("FileInput::mapFile: %s mapped", qPrintable(m_fileName));
+	}
+	else // ex: not enough address space on 32 bit systems
+	{
+		m_mappedFile.close();
+		qWarning("FileInput::mapFile: cannot map %s: read it as a stream", qPrintable(m_fileName));
+	}
+}
+
+void FileInput::unmapFile()
+{
+	if (m_mappedData)
+	{
+		m_mappedFile.unmap(m_mappedData);
+		m_mappedData = nullptr;
+		m_mappedSize = 0;
+	}
+
+	if (m_mappedFile.isOpen()) {
+		m_mappedFile.close();
 	}
 }
 
@@ -163,12 +228,9 @@ void FileInput::seekFileStream(int seekMillis)
 
 	if ((m_ifstream.is_open()) && m_fileInputWorker && !m_fileInputWorker->isRunning())
 	{
-        quint64 seekPoint = ((m_recordLengthMuSec * seekMillis) / 1000) * m_sampleRate;
-        seekPoint /= 1000000UL;
-		m_fileInputWorker->setSamplesCount(seekPoint);
-        seekPoint *= (m_sampleSize == 24 ? 8 : 4); // + sizeof(FileRecord::Header)
-		m_ifstream.clear();
-		m_ifstream.seekg(seekPoint + sizeof(FileRecord::Header), std::ios::beg);
+        // binary search of the chunk at the seek time then position in chunk
+        quint64 seekTimeStampUs = m_chunkIndex.front().timeStampUs + (m_recordLengthMuSec * seekMillis) / 1000;
+        m_fileInputWorker->setSamplesCount(FileRecord::getSampleIndex(m_chunkIndex, seekTimeStampUs)); // the worker reads at this position
 	}
 }
 
@@ -202,6 +264,11 @@ bool FileInput::start()
 	}
 
 	m_fileInputWorker = new FileInputWorker(&m_ifstream, &m_sampleFifo, m_masterTimer, &m_inputMessageQueue);
+	m_fileInputWorker->setMappedFile(m_mappedData, m_mappedSize);
+	m_fileInputWorker->setChunkIndex(&m_chunkIndex);
+	m_fileInputWorker->setCompressed(m_compressed);
+	m_fileInputWorker->setAsFastAsPossible(m_settings.m_asFastAsPossible);
+	m_fileInputWorker->setDeviceSourceEngine(m_deviceAPI->getDeviceSourceEngine());
 	m_fileInputWorker->moveToThread(&m_fileInputWorkerThread);
 	m_fileInputWorker->setSampleRateAndSize(m_settings.m_accelerationFactor * m_sampleRate, m_sampleSize); // Fast Forward: 1 corresponds to live. 1/2 is half speed, 2 is double speed
 	startWorker();
@@ -394,10 +461,31 @@ bool FileInput::handleMessage(const Message& message)
 
         return true;
     }
+    else if (FileInputWorker::MsgReportChunkChange::match(message))
+    {
+        FileInputWorker::MsgReportChunkChange& report = (FileInputWorker::MsgReportChunkChange&) message;
+        m_sampleRate = report.getSampleRate();
+        m_centerFrequency = report.getCenterFrequency();
+        qDebug("FileInput::handleMessage: MsgReportChunkChange: sample rate: %d center frequency: %llu",
+            m_sampleRate, m_centerFrequency);
+
+        DSPSignalNotification *notif = new DSPSignalNotification(m_sampleRate, m_centerFrequency);
+        m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
+
+        if (getMessageQueueToGUI())
+        {
+            DSPSignalNotification *notifToGUI = new DSPSignalNotification(m_sampleRate, m_centerFrequency);
+            getMessageQueueToGUI()->push(notifToGUI);
+        }
+
+        return true;
+    }
     else if (FileInputWorker::MsgReportEOF::match(message))
     {
         qDebug() << "FileInput::handleMessage: MsgReportEOF";
 		stopWorker();
+        qInfo("FileInput::handleMessage: end of %s: %llu samples played at %.2f times real time",
+            qPrintable(m_fileName), m_fileInputWorker->getRunSamplesCount(), getSpeedFactor());
 
         if (getMessageQueueToGUI())
         {
@@ -446,6 +534,15 @@ bool FileInput::applySettings(const FileInputSettings& settings, bool force)
         }
     }
 
+    if ((m_settings.m_asFastAsPossible != settings.m_asFastAsPossible) || force)
+    {
+        reverseAPIKeys.append("asFastAsPossible");
+
+        if (m_fileInputWorker) {
+            m_fileInputWorker->setAsFastAsPossible(settings.m_asFastAsPossible);
+        }
+    }
+
     if ((m_settings.m_loop != settings.m_loop)) {
         reverseAPIKeys.append("loop");
     }
@@ -514,6 +611,9 @@ void FileInput::webapiUpdateDeviceSettings(
     if (deviceSettingsKeys.contains("loop")) {
         settings.m_loop = response.getFileInputSettings()->getLoop() != 0;
     }
+    if (deviceSettingsKeys.contains("asFastAsPossible")) {
+        settings.m_asFastAsPossible = response.getFileInputSettings()->getAsFastAsPossible() != 0;
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getFileInputSettings()->getUseReverseApi() != 0;
     }
@@ -572,6 +672,7 @@ void FileInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& respo
     response.getFileInputSettings()->setFileName(new QString(settings.m_fileName));
     response.getFileInputSettings()->setAccelerationFactor(settings.m_accelerationFactor);
     response.getFileInputSettings()->setLoop(settings.m_loop ? 1 : 0);
+    response.getFileInputSettings()->setAsFastAsPossible(settings.m_asFastAsPossible ? 1 : 0);
 
     response.getFileInputSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
@@ -619,6 +720,22 @@ void FileInput::webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response)
     response.getFileInputReport()->setFileName(new QString(m_fileName));
     response.getFileInputReport()->setSampleRate(m_sampleRate);
     response.getFileInputReport()->setSampleSize(m_sampleSize);
+    response.getFileInputReport()->setSpeedFactor(getSpeedFactor());
+}
+
+float FileInput::getSpeedFactor() const
+{
+    if (!m_fileInputWorker || (m_sampleRate == 0)) {
+        return 0.0f;
+    }
+
+    qint64 nsecs = m_fileInputWorker->getRunNsecs();
+
+    if (nsecs == 0) {
+        return 0.0f;
+    }
+
+    return (m_fileInputWorker->getRunSamplesCount() * 1e9) / ((double) nsecs * m_sampleRate);
 }
 
 void FileInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const FileInputSettings& settings, bool force)
@@ -638,6 +755,9 @@ void FileInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, co
     if (deviceSettingsKeys.contains("loop") || force) {
         swgFileInputSettings->setLoop(settings.m_loop);
     }
+    if (deviceSettingsKeys.contains("asFastAsPossible") || force) {
+        swgFileInputSettings->setAsFastAsPossible(settings.m_asFastAsPossible ? 1 : 0);
+    }
     if (deviceSettingsKeys.contains("fileName") || force) {
         swgFileInputSettings->setFileName(new QString(settings.m_fileName));
     }
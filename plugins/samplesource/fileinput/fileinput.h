@@ -27,9 +27,11 @@
 #include <QTimer>
 #include <QThread>
 #include <QMutex>
+#include <QFile>
 #include <QNetworkRequest>
 
 #include "dsp/devicesamplesource.h"
+#include "dsp/filerecord.h"
 #include "fileinputsettings.h"
 
 class QNetworkAccessManager;
@@ -333,6 +335,9 @@ public:
 	QMutex m_mutex;
 	FileInputSettings m_settings;
 	std::ifstream m_ifstream;
+	QFile m_mappedFile;      //!< same file memory mapped for playback
+	uchar *m_mappedData;     //!< nullptr if the file could not be mapped then playback reads the stream
+	quint64 m_mappedSize;
 	FileInputWorker* m_fileInputWorker;
 	QThread m_fileInputWorkerThread;
 	QString m_deviceDescription;
@@ -341,6 +346,8 @@ public:
 	quint32 m_sampleSize;
 	quint64 m_centerFrequency;
     quint64 m_recordLengthMuSec; //!< record length in microseconds computed from file size
+    FileRecord::ChunkIndex m_chunkIndex; //!< samples location in the file
+    bool m_compressed;                   //!< file in the compressed format
     quint64 m_startingTimeStamp;
 	QTimer m_masterTimer;
     QNetworkAccessManager *m_networkManager;
@@ -348,6 +355,9 @@ public:
 
 	void startWorker();
 	void stopWorker();
+	float getSpeedFactor() const; //!< samples played over real time since the last start
+	void mapFile(quint64 fileSize);
+	void unmapFile();
 	void openFileStream();
 	void seekFileStream(int seekMillis);
 	bool applySettings(const FileInputSettings& settings, bool force = false);
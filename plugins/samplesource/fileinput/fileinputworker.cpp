@@ -17,15 +17,27 @@
 
 #include <stdio.h>
 #include <errno.h>
+#include <string.h>
 #include <assert.h>
+#include <algorithm>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include <QDebug>
+#include <QThread>
 
 #include "dsp/filerecord.h"
+#include "dsp/iqcodec.h"
 #include "fileinputworker.h"
 #include "dsp/samplesinkfifo.h"
+#include "dsp/dspdevicesourceengine.h"
 #include "util/messagequeue.h"
 
 MESSAGE_CLASS_DEFINITION(FileInputWorker::MsgReportEOF, Message)
+MESSAGE_CLASS_DEFINITION(FileInputWorker::MsgReportChunkChange, Message)
 
 FileInputWorker::FileInputWorker(std::ifstream *samplesStream,
         SampleSinkFifo* sampleFifo,
@@ -35,6 +47,14 @@ FileInputWorker::FileInputWorker(std::ifstream *samplesStream,
 	QObject(parent),
 	m_running(false),
 	m_ifstream(samplesStream),
+	m_mappedData(nullptr),
+	m_mappedSize(0),
+	m_chunkIndex(nullptr),
+	m_chunkSampleRate(0),
+	m_chunkCenterFrequency(0),
+	m_compressed(false),
+	m_decodedBlockOffset(0),
+	m_pageSize(4096),
 	m_fileBuf(nullptr),
 	m_convertBuf(nullptr),
 	m_bufsize(0),
@@ -47,9 +67,16 @@ FileInputWorker::FileInputWorker(std::ifstream *samplesStream,
 	m_samplesize(0),
 	m_samplebytes(0),
     m_throttlems(FILESOURCE_THROTTLE_MS),
-    m_throttleToggle(false)
+    m_throttleToggle(false),
+    m_asFastAsPossible(false),
+    m_deviceSourceEngine(nullptr),
+    m_runStartSamplesCount(0),
+    m_runNsecs(0)
 {
     assert(m_ifstream != nullptr);
+#if defined(__unix__) || defined(__APPLE__)
+    m_pageSize = sysconf(_SC_PAGESIZE);
+#endif
 }
 
 FileInputWorker::~FileInputWorker()
@@ -71,10 +98,12 @@ void FileInputWorker::startWork()
 {
 	qDebug() << "FileInputThread::startWork: ";
 
-    if (m_ifstream->is_open())
+    if (m_ifstream->is_open() || m_mappedData)
     {
         qDebug() << "FileInputThread::startWork: file stream open, starting...";
         m_elapsedTimer.start();
+        m_runTimer.start();
+        m_runStartSamplesCount = m_samplesCount;
         connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
 		m_running = true;
     }
@@ -88,6 +117,11 @@ void FileInputWorker::stopWork()
 {
 	qDebug() << "FileInputThread::stopWork";
 	disconnect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+
+	if (m_running) {
+		m_runNsecs = m_runTimer.nsecsElapsed();
+	}
+
 	m_running = false;
 }
 
@@ -116,6 +150,21 @@ void FileInputWorker::setSampleRateAndSize(int samplerate, quint32 samplesize)
 	//m_samplerate = samplerate;
 }
 
+void FileInputWorker::setMappedFile(const quint8 *data, quint64 size)
+{
+    m_mappedData = data;
+    m_mappedSize = data ? size : 0;
+}
+
+void FileInputWorker::setChunkIndex(const FileRecord::ChunkIndex *chunkIndex)
+{
+    // the file opening has notified the parameters of the first chunk
+    m_chunkIndex = chunkIndex;
+    m_chunkSampleRate = chunkIndex->front().sampleRate;
+    m_chunkCenterFrequency = chunkIndex->front().centerFrequency;
+    m_decodedBlock.clear();
+}
+
 void FileInputWorker::setBuffers(std::size_t chunksize)
 {
     if (chunksize > m_bufsize)
@@ -164,6 +213,12 @@ void FileInputWorker::tick()
 {
 	if (m_running)
 	{
+        if (m_asFastAsPossible)
+        {
+            tickAsFastAsPossible();
+            return;
+        }
+
         qint64 throttlems = m_elapsedTimer.restart();
 
         if (throttlems != m_throttlems)
@@ -174,21 +229,187 @@ void FileInputWorker::tick()
             setBuffers(m_chunksize);
         }
 
-		// read samples directly feeding the SampleFifo (no callback)
-		m_ifstream->read(reinterpret_cast<char*>(m_fileBuf), m_chunksize);
+        readChunk();
+	}
+}
+
+void FileInputWorker::tickAsFastAsPossible()
+{
+    // Write chunks as long as the FIFO has room for them and the channels downstream keep up then
+    // give the hand back to the event loop before the next tick. The slowest channel sets the pace.
+    QElapsedTimer tickTimer;
+    tickTimer.start();
+    unsigned int chunkSamples = m_chunksize / (2 * m_samplebytes);
+
+    while (m_running && (tickTimer.elapsed() < (FILESOURCE_THROTTLE_MS * 3) / 4))
+    {
+        if ((m_sampleFifo->size() - m_sampleFifo->fill() < chunkSamples)
+         || (m_deviceSourceEngine && (m_deviceSourceEngine->getDownstreamLoad() > FILESOURCE_MAX_DOWNSTREAM_LOAD)))
+        {
+            QThread::usleep(500); // let the DSP catch up
+            continue;
+        }
+
+        if (!readChunk()) {
+            return;
+        }
+    }
+}
+
+bool FileInputWorker::readChunk()
+{
+    // the position follows the samples count so that seeking is just setting the count
+    quint64 sampleBytes = 2 * m_samplebytes;
+    quint64 nbBytes = m_chunksize - (m_chunksize % sampleBytes);
+
+    while (nbBytes > 0)
+    {
+        const FileRecord::Chunk& chunk = (*m_chunkIndex)[FileRecord::findChunkBySample(*m_chunkIndex, m_samplesCount)];
+
+        if (m_samplesCount >= chunk.sampleIndex + chunk.nbSamples) // past the last chunk
+        {
+            MsgReportEOF *message = MsgReportEOF::create();
+            m_fileInputMessageQueue->push(message);
+            return false;
+        }
+
+        if ((chunk.sampleRate != m_chunkSampleRate) || (chunk.centerFrequency != m_chunkCenterFrequency))
+        {
+            MsgReportChunkChange *message = MsgReportChunkChange::create(chunk.sampleRate, chunk.centerFrequency);
+            m_fileInputMessageQueue->push(message);
+            bool rateChange = chunk.sampleRate != m_chunkSampleRate;
+
+            if (rateChange) // keep the acceleration factor
+            {
+                m_samplerate = (m_samplerate / m_chunkSampleRate) * chunk.sampleRate;
+                m_chunksize = (m_samplerate * 2 * m_samplebytes * m_throttlems) / 1000;
+                setBuffers(m_chunksize);
+            }
+
+            m_chunkSampleRate = chunk.sampleRate;
+            m_chunkCenterFrequency = chunk.centerFrequency;
 
-        if (m_ifstream->eof())
+            if (rateChange) { // resume at the new pace on next tick
+                return true;
+            }
+        }
+
+        quint64 chunkOffset = (m_samplesCount - chunk.sampleIndex) * sampleBytes;
+        quint64 count = std::min(nbBytes, chunk.nbSamples * sampleBytes - chunkOffset);
+        const quint8 *buf = m_compressed ?
+            readDecodedSamples(chunk, chunkOffset) :
+            readSamples(chunk.dataOffset + chunkOffset, count);
+
+        if (!buf) // truncated file or corrupted block
         {
-        	writeToSampleFifo(m_fileBuf, (qint32) m_ifstream->gcount());
-        	MsgReportEOF *message = MsgReportEOF::create();
-        	m_fileInputMessageQueue->push(message);
+            MsgReportEOF *message = MsgReportEOF::create();
+            m_fileInputMessageQueue->push(message);
+            return false;
+        }
+
+        writeToSampleFifo(buf, (qint32) count);
+        m_samplesCount += count / sampleBytes;
+        nbBytes -= count;
+    }
+
+    return true;
+}
+
+const quint8 *FileInputWorker::readSamples(quint64 offset, quint64 nbBytes)
+{
+    if (m_mappedData)
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        // start reading the pages of the next chunk in the background
+        quint64 next = offset + nbBytes;
+        quint64 nextPage = next - (next % m_pageSize);
+
+        if (nextPage < m_mappedSize)
+        {
+            quint64 length = std::min((quint64) m_chunksize + (next - nextPage), m_mappedSize - nextPage);
+            posix_madvise((void*) (m_mappedData + nextPage), length, POSIX_MADV_WILLNEED);
+        }
+#endif
+        // samples go from the mapped pages to the FIFO without intermediate copy
+        return m_mappedData + offset;
+    }
+
+    if ((quint64) m_ifstream->tellg() != offset) // start, seek or next chunk of the chunked format
+    {
+        m_ifstream->clear();
+        m_ifstream->seekg(offset, std::ios::beg);
+    }
+
+    // read samples directly feeding the SampleFifo (no callback)
+    m_ifstream->read(reinterpret_cast<char*>(m_fileBuf), nbBytes);
+    return m_ifstream->gcount() == (std::streamsize) nbBytes ? m_fileBuf : nullptr;
+}
+
+const quint8 *FileInputWorker::readDecodedSamples(const FileRecord::Chunk& chunk, quint64 chunkOffset)
+{
+    // decoding a whole block at once in this thread keeps the codec out of the DSP thread
+    if ((m_decodedBlock.size() == 0) || (chunk.dataOffset != m_decodedBlockOffset))
+    {
+        IQCodec::BlockHeader header;
+        const quint8 *block;
+
+        if (m_mappedData) // the chunk index checked that the block is in the file
+        {
+            memcpy(&header, m_mappedData + chunk.dataOffset, sizeof(IQCodec::BlockHeader));
+            block = m_mappedData + chunk.dataOffset;
+
+            if (!checkBlockHeader(chunk, header)
+             || (header.nbBytes > m_mappedSize - chunk.dataOffset - sizeof(IQCodec::BlockHeader))) {
+                return nullptr;
+            }
         }
         else
         {
-        	writeToSampleFifo(m_fileBuf, (qint32) m_chunksize);
-    		m_samplesCount += m_chunksize / (2 * m_samplebytes);
+            m_ifstream->clear();
+            m_ifstream->seekg(chunk.dataOffset, std::ios::beg);
+            m_ifstream->read(reinterpret_cast<char*>(&header), sizeof(IQCodec::BlockHeader));
+
+            if (!*m_ifstream || !checkBlockHeader(chunk, header)) {
+                return nullptr;
+            }
+
+            m_compressedBlock.resize(sizeof(IQCodec::BlockHeader) + header.nbBytes);
+            memcpy(m_compressedBlock.data(), &header, sizeof(IQCodec::BlockHeader));
+            m_ifstream->read(reinterpret_cast<char*>(m_compressedBlock.data() + sizeof(IQCodec::BlockHeader)), header.nbBytes);
+
+            if (!*m_ifstream) {
+                return nullptr;
+            }
+
+            block = m_compressedBlock.data();
         }
-	}
+
+        m_decodedBlock.resize(chunk.nbSamples * 2 * m_samplebytes);
+
+        if ((header.nbSamples != chunk.nbSamples)
+         || !IQCodec::decode(block, sizeof(IQCodec::BlockHeader) + header.nbBytes, m_samplebytes, m_decodedBlock.data()))
+        {
+            qWarning("FileInputWorker::readDecodedSamples: corrupted block at %llu", chunk.dataOffset);
+            m_decodedBlock.clear();
+            return nullptr;
+        }
+
+        m_decodedBlockOffset = chunk.dataOffset;
+    }
+
+    return m_decodedBlock.data() + chunkOffset;
+}
+
+bool FileInputWorker::checkBlockHeader(const FileRecord::Chunk& chunk, const IQCodec::BlockHeader& header) const
+{
+    // the coder never produces more bytes than the raw samples (verbatim block)
+    if ((header.nbSamples != chunk.nbSamples) || (header.nbBytes > chunk.nbSamples * 2 * m_samplebytes))
+    {
+        qWarning("FileInputWorker::checkBlockHeader: corrupted block header at %llu", chunk.dataOffset);
+        return false;
+    }
+
+    return true;
 }
 
 void FileInputWorker::writeToSampleFifo(const quint8* buf, qint32 nbBytes)
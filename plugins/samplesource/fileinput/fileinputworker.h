@@ -23,13 +23,18 @@
 #include <iostream>
 #include <fstream>
 #include <cstdlib>
+#include <vector>
 
 #include "dsp/inthalfbandfilter.h"
+#include "dsp/filerecord.h"
+#include "dsp/iqcodec.h"
 #include "util/message.h"
 
 #define FILESOURCE_THROTTLE_MS 50
+#define FILESOURCE_MAX_DOWNSTREAM_LOAD 500 //!< per mille of the channel FIFOs fill above which reads are held as fast as possible
 
 class SampleSinkFifo;
+class DSPDeviceSourceEngine;
 class MessageQueue;
 
 class FileInputWorker : public QObject {
@@ -50,6 +55,28 @@ public:
         { }
     };
 
+    class MsgReportChunkChange : public Message { //!< sample rate or center frequency change in a chunked file
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        int getSampleRate() const { return m_sampleRate; }
+        quint64 getCenterFrequency() const { return m_centerFrequency; }
+
+        static MsgReportChunkChange* create(int sampleRate, quint64 centerFrequency) {
+            return new MsgReportChunkChange(sampleRate, centerFrequency);
+        }
+
+    private:
+        int m_sampleRate;
+        quint64 m_centerFrequency;
+
+        MsgReportChunkChange(int sampleRate, quint64 centerFrequency) :
+            Message(),
+            m_sampleRate(sampleRate),
+            m_centerFrequency(centerFrequency)
+        { }
+    };
+
 	FileInputWorker(std::ifstream *samplesStream,
 	        SampleSinkFifo* sampleFifo,
 	        const QTimer& timer,
@@ -64,11 +91,28 @@ public:
 	bool isRunning() const { return m_running; }
     quint64 getSamplesCount() const { return m_samplesCount; }
     void setSamplesCount(quint64 samplesCount) { m_samplesCount = samplesCount; }
+    void setMappedFile(const quint8 *data, quint64 size); //!< play from the memory mapped file instead of the stream. nullptr to use the stream.
+    void setChunkIndex(const FileRecord::ChunkIndex *chunkIndex); //!< samples location in the file. Must not be empty.
+    void setCompressed(bool compressed) { m_compressed = compressed; } //!< chunks are IQCodec blocks
+    void setAsFastAsPossible(bool asFastAsPossible) { m_asFastAsPossible = asFastAsPossible; }
+    void setDeviceSourceEngine(const DSPDeviceSourceEngine *deviceSourceEngine) { m_deviceSourceEngine = deviceSourceEngine; } //!< for the downstream load when as fast as possible
+    quint64 getRunSamplesCount() const { return m_samplesCount - m_runStartSamplesCount; } //!< samples played since last start
+    qint64 getRunNsecs() const { return m_running ? m_runTimer.nsecsElapsed() : m_runNsecs; } //!< time since last start until stop
 
 private:
 	volatile bool m_running;
 
 	std::ifstream* m_ifstream;
+	const quint8 *m_mappedData; //!< whole file including header
+	quint64 m_mappedSize;
+	const FileRecord::ChunkIndex *m_chunkIndex;
+	quint32 m_chunkSampleRate;       //!< of the chunk being played
+	quint64 m_chunkCenterFrequency;  //!< of the chunk being played
+	bool m_compressed;
+	std::vector<quint8> m_compressedBlock;
+	std::vector<quint8> m_decodedBlock;
+	quint64 m_decodedBlockOffset;    //!< file offset of the decoded block
+	quint64 m_pageSize;
 	quint8  *m_fileBuf;
 	quint8  *m_convertBuf;
 	std::size_t m_bufsize;
@@ -84,9 +128,19 @@ private:
     qint64 m_throttlems;
     QElapsedTimer m_elapsedTimer;
     bool m_throttleToggle;
+    bool m_asFastAsPossible; //!< paced by the FIFO room instead of the timer
+    const DSPDeviceSourceEngine *m_deviceSourceEngine;
+    QElapsedTimer m_runTimer;
+    quint64 m_runStartSamplesCount;
+    qint64 m_runNsecs;
 
 	//void decimate1(SampleVector::iterator* it, const qint16* buf, qint32 len);
 	void writeToSampleFifo(const quint8* buf, qint32 nbBytes);
+	bool readChunk(); //!< returns false at end of file
+	const quint8 *readSamples(quint64 offset, quint64 nbBytes); //!< nullptr if not in file
+	bool checkBlockHeader(const FileRecord::Chunk& chunk, const IQCodec::BlockHeader& header) const; //!< false if the header does not match the chunk
+	const quint8 *readDecodedSamples(const FileRecord::Chunk& chunk, quint64 chunkOffset); //!< nullptr if the block is corrupted
+	void tickAsFastAsPossible();
 
 private slots:
 	void tick();
@@ -87,6 +87,12 @@ bool SoapySDRInput::openDevice()
         qDebug("SoapySDRInput::openDevice: allocated SampleFifo");
     }
 
+    if (!m_sampleFifoF.setSize(96000 * 4))
+    {
+        qCritical("SoapySDRInput::openDevice: could not allocate SampleFifoF");
+        return false;
+    }
+
     // look for Rx buddies and get reference to the device object
     if (m_deviceAPI->getSourceBuddies().size() > 0) // look source sibling first
     {
@@ -490,12 +496,14 @@ bool SoapySDRInput::start()
             qDebug("SoapySDRInput::start: expand channels. Re-allocate thread and take ownership");
 
             SampleSinkFifo **fifos = new SampleSinkFifo*[nbOriginalChannels];
+            SampleSinkFifoF **fifosF = new SampleSinkFifoF*[nbOriginalChannels];
             unsigned int *log2Decims = new unsigned int[nbOriginalChannels];
             int *fcPoss = new int[nbOriginalChannels];
 
             for (int i = 0; i < nbOriginalChannels; i++) // save original FIFO references and data
             {
                 fifos[i] = soapySDRInputThread->getFifo(i);
+                fifosF[i] = soapySDRInputThread->getFifoF(i);
                 log2Decims[i] = soapySDRInputThread->getLog2Decimation(i);
                 fcPoss[i] = soapySDRInputThread->getFcPos(i);
             }
@@ -508,6 +516,7 @@ bool SoapySDRInput::start()
             for (int i = 0; i < nbOriginalChannels; i++) // restore original FIFO references
             {
                 soapySDRInputThread->setFifo(i, fifos[i]);
+                soapySDRInputThread->setFifoF(i, fifosF[i]);
                 soapySDRInputThread->setLog2Decimation(i, log2Decims[i]);
                 soapySDRInputThread->setFcPos(i, fcPoss[i]);
             }
@@ -522,6 +531,7 @@ bool SoapySDRInput::start()
 
             delete[] fcPoss;
             delete[] log2Decims;
+            delete[] fifosF;
             delete[] fifos;
 
             needsStart = true;
@@ -540,6 +550,7 @@ bool SoapySDRInput::start()
     }
 
     soapySDRInputThread->setFifo(requestedChannel, &m_sampleFifo);
+    soapySDRInputThread->setFifoF(requestedChannel, m_settings.m_floatPipeline ? &m_sampleFifoF : nullptr);
     soapySDRInputThread->setLog2Decimation(requestedChannel, m_settings.m_log2Decim);
     soapySDRInputThread->setFcPos(requestedChannel, (int) m_settings.m_fcPos);
 
@@ -610,6 +621,7 @@ void SoapySDRInput::stop()
         qDebug("SoapySDRInput::stop: MI mode. Reduce by deleting and re-creating the thread");
         soapySDRInputThread->stopWork();
         SampleSinkFifo **fifos = new SampleSinkFifo*[nbOriginalChannels-1];
+        SampleSinkFifoF **fifosF = new SampleSinkFifoF*[nbOriginalChannels-1];
         unsigned int *log2Decims = new unsigned int[nbOriginalChannels-1];
         int *fcPoss = new int[nbOriginalChannels-1];
         int highestActiveChannelIndex = -1;
@@ -617,6 +629,7 @@ void SoapySDRInput::stop()
         for (int i = 0; i < nbOriginalChannels-1; i++) // save original FIFO references and get the channel with highest index
         {
             fifos[i] = soapySDRInputThread->getFifo(i);
+            fifosF[i] = soapySDRInputThread->getFifoF(i);
 
             if ((soapySDRInputThread->getFifo(i) != 0) && (i > highestActiveChannelIndex)) {
                 highestActiveChannelIndex = i;
@@ -637,6 +650,7 @@ void SoapySDRInput::stop()
             for (int i = 0; i < highestActiveChannelIndex; i++)  // restore original FIFO references
             {
                 soapySDRInputThread->setFifo(i, fifos[i]);
+                soapySDRInputThread->setFifoF(i, fifosF[i]);
                 soapySDRInputThread->setLog2Decimation(i, log2Decims[i]);
                 soapySDRInputThread->setFcPos(i, fcPoss[i]);
             }
@@ -662,12 +676,14 @@ void SoapySDRInput::stop()
 
         delete[] fcPoss;
         delete[] log2Decims;
+        delete[] fifosF;
         delete[] fifos;
     }
     else // remove channel from existing thread
     {
         qDebug("SoapySDRInput::stop: MI mode. Not changing MI configuration. Just remove FIFO reference");
         soapySDRInputThread->setFifo(requestedChannel, 0); // remove FIFO
+        soapySDRInputThread->setFifoF(requestedChannel, 0);
     }
 
     m_running = false;
@@ -976,6 +992,12 @@ bool SoapySDRInput::applySettings(const SoapySDRInputSettings& settings, bool fo
         }
     }
 
+    if ((m_settings.m_floatPipeline != settings.m_floatPipeline) || force)
+    {
+        reverseAPIKeys.append("floatPipeline");
+        qDebug() << "SoapySDRInput::applySettings: float pipeline " << (settings.m_floatPipeline ? "on" : "off") << " effective at next start";
+    }
+
     if ((m_settings.m_centerFrequency != settings.m_centerFrequency) || force) {
         reverseAPIKeys.append("centerFrequency");
     }
@@ -1340,6 +1362,7 @@ bool SoapySDRInput::applySettings(const SoapySDRInputSettings& settings, bool fo
             << " m_LOppmTenths: " << m_settings.m_LOppmTenths
             << " m_log2Decim: " << m_settings.m_log2Decim
             << " m_iqOrder: " << m_settings.m_iqOrder
+            << " m_floatPipeline: " << m_settings.m_floatPipeline
             << " m_fcPos: " << m_settings.m_fcPos
             << " m_devSampleRate: " << m_settings.m_devSampleRate
             << " m_softDCCorrection: " << m_settings.m_softDCCorrection
@@ -1445,6 +1468,9 @@ void SoapySDRInput::webapiUpdateDeviceSettings(
     if (deviceSettingsKeys.contains("iqOrder")) {
         settings.m_iqOrder = response.getSoapySdrInputSettings()->getIqOrder() != 0;
     }
+    if (deviceSettingsKeys.contains("floatPipeline")) {
+        settings.m_floatPipeline = response.getSoapySdrInputSettings()->getFloatPipeline() != 0;
+    }
     if (deviceSettingsKeys.contains("fcPos")) {
         settings.m_fcPos = static_cast<SoapySDRInputSettings::fcPos_t>(response.getSoapySdrInputSettings()->getFcPos());
     }
@@ -1620,6 +1646,7 @@ void SoapySDRInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& r
     response.getSoapySdrInputSettings()->setDevSampleRate(settings.m_devSampleRate);
     response.getSoapySdrInputSettings()->setLog2Decim(settings.m_log2Decim);
     response.getSoapySdrInputSettings()->setIqOrder(settings.m_iqOrder ? 1 : 0);
+    response.getSoapySdrInputSettings()->setFloatPipeline(settings.m_floatPipeline ? 1 : 0);
     response.getSoapySdrInputSettings()->setFcPos((int) settings.m_fcPos);
     response.getSoapySdrInputSettings()->setSoftDcCorrection(settings.m_softDCCorrection ? 1 : 0);
     response.getSoapySdrInputSettings()->setSoftIqCorrection(settings.m_softIQCorrection ? 1 : 0);
@@ -1938,6 +1965,9 @@ void SoapySDRInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys
     if (deviceSettingsKeys.contains("iqOrder") || force) {
         swgSoapySDRInputSettings->setIqOrder(settings.m_iqOrder);
     }
+    if (deviceSettingsKeys.contains("floatPipeline") || force) {
+        swgSoapySDRInputSettings->setFloatPipeline(settings.m_floatPipeline ? 1 : 0);
+    }
     if (deviceSettingsKeys.contains("fcPos") || force) {
         swgSoapySDRInputSettings->setFcPos((int) settings.m_fcPos);
     }
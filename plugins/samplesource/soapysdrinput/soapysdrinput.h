@@ -137,6 +137,7 @@ public:
     virtual void setSampleRate(int sampleRate) { (void) sampleRate; }
     virtual quint64 getCenterFrequency() const;
     virtual void setCenterFrequency(qint64 centerFrequency);
+    virtual bool getFloatPipeline() const { return m_settings.m_floatPipeline; }
 
     virtual bool handleMessage(const Message& message);
 
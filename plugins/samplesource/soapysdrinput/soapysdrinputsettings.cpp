@@ -38,6 +38,7 @@ void SoapySDRInputSettings::resetToDefaults()
     m_transverterMode = false;
     m_transverterDeltaFrequency = 0;
     m_iqOrder = true;
+    m_floatPipeline = false;
     m_antenna = "NONE";
     m_bandwidth = 1000000;
     m_globalGain = 0;
@@ -83,6 +84,7 @@ QByteArray SoapySDRInputSettings::serialize() const
     s.writeU32(25, m_reverseAPIPort);
     s.writeU32(26, m_reverseAPIDeviceIndex);
     s.writeBool(27, m_iqOrder);
+    s.writeBool(28, m_floatPipeline);
 
     return s.final();
 }
@@ -146,6 +148,7 @@ bool SoapySDRInputSettings::deserialize(const QByteArray& data)
         d.readU32(26, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
         d.readBool(27, &m_iqOrder, true);
+        d.readBool(28, &m_floatPipeline, false);
 
         return true;
     }
@@ -40,6 +40,7 @@ struct SoapySDRInputSettings {
     bool m_transverterMode;
     qint64 m_transverterDeltaFrequency;
     bool m_iqOrder;
+    bool m_floatPipeline; //!< deliver float samples to the float pipeline (CF32 stream format)
     QString m_antenna;
     quint32 m_bandwidth;
     QMap<QString, double> m_tunableElements;
@@ -22,6 +22,7 @@
 #include <SoapySDR/Errors.hpp>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/samplesinkfifof.h"
 #include "soapysdr/devicesoapysdr.h"
 
 #include "soapysdrinputthread.h"
@@ -100,7 +101,10 @@ void SoapySDRInputThread::run()
 
         qDebug("SoapySDRInputThread::run: format: %s fullScale: %f", format.c_str(), fullScale);
 
-        if ((format == "CS8") && (fullScale == 128.0)) { // 8 bit signed - native
+        if (getNbFifosF() > 0) { // float pipeline requested
+            m_decimatorType = DecimatorFloat;
+            format = "CF32";
+        } else if ((format == "CS8") && (fullScale == 128.0)) { // 8 bit signed - native
             m_decimatorType = Decimator8;
         } else if ((format == "CS16") && (fullScale == 2048.0)) { // 12 bit signed - native
             m_decimatorType = Decimator12;
@@ -125,6 +129,10 @@ void SoapySDRInputThread::run()
 
         for (unsigned int i = 0; i < m_nbChannels; i++) {
             m_channels[i].m_convertBuffer.resize(numElems, Sample{0,0});
+
+            if (m_channels[i].m_sampleFifoF) {
+                m_channels[i].m_convertBufferF.resize(numElems, FSample{0.0f, 0.0f});
+            }
         }
 
         m_dev->activateStream(stream);
@@ -235,6 +243,20 @@ unsigned int SoapySDRInputThread::getNbFifos()
     return fifoCount;
 }
 
+unsigned int SoapySDRInputThread::getNbFifosF()
+{
+    unsigned int fifoCount = 0;
+
+    for (unsigned int i = 0; i < m_nbChannels; i++)
+    {
+        if (m_channels[i].m_sampleFifoF) {
+            fifoCount++;
+        }
+    }
+
+    return fifoCount;
+}
+
 void SoapySDRInputThread::setLog2Decimation(unsigned int channel, unsigned int log2_decim)
 {
     if (channel < m_nbChannels) {
@@ -283,6 +305,22 @@ SampleSinkFifo *SoapySDRInputThread::getFifo(unsigned int channel)
     }
 }
 
+void SoapySDRInputThread::setFifoF(unsigned int channel, SampleSinkFifoF *sampleFifoF)
+{
+    if (channel < m_nbChannels) {
+        m_channels[channel].m_sampleFifoF = sampleFifoF;
+    }
+}
+
+SampleSinkFifoF *SoapySDRInputThread::getFifoF(unsigned int channel)
+{
+    if (channel < m_nbChannels) {
+        return m_channels[channel].m_sampleFifoF;
+    } else {
+        return 0;
+    }
+}
+
 void SoapySDRInputThread::callbackMIIQ(std::vector<void *>& buffs, qint32 samplesPerChannel)
 {
     for(unsigned int ichan = 0; ichan < m_nbChannels; ichan++)
@@ -887,6 +925,12 @@ void SoapySDRInputThread::callbackSI16QI(const qint16* buf, qint32 len, unsigned
 
 void SoapySDRInputThread::callbackSIFIQ(const float* buf, qint32 len, unsigned int channel)
 {
+    if (m_channels[channel].m_sampleFifoF)
+    {
+        callbackSIFF(m_channels[channel].m_decimatorsFFIQ, buf, len, channel);
+        return;
+    }
+
     SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
 
     if (m_channels[channel].m_log2Decim == 0)
@@ -980,6 +1024,12 @@ void SoapySDRInputThread::callbackSIFIQ(const float* buf, qint32 len, unsigned i
 
 void SoapySDRInputThread::callbackSIFQI(const float* buf, qint32 len, unsigned int channel)
 {
+    if (m_channels[channel].m_sampleFifoF)
+    {
+        callbackSIFF(m_channels[channel].m_decimatorsFFQI, buf, len, channel);
+        return;
+    }
+
     SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
 
     if (m_channels[channel].m_log2Decim == 0)
@@ -1070,3 +1120,97 @@ void SoapySDRInputThread::callbackSIFQI(const float* buf, qint32 len, unsigned i
 
     m_channels[channel].m_sampleFifo->write(m_channels[channel].m_convertBuffer.begin(), it);
 }
+
+template<bool IQOrder>
+void SoapySDRInputThread::callbackSIFF(DecimatorsFF<IQOrder>& decimators, const float* buf, qint32 len, unsigned int channel)
+{
+    FSampleVector::iterator it = m_channels[channel].m_convertBufferF.begin();
+
+    if (m_channels[channel].m_log2Decim == 0)
+    {
+        decimators.decimate1(&it, buf, len);
+    }
+    else
+    {
+        if (m_channels[channel].m_fcPos == 0) // Infra
+        {
+            switch (m_channels[channel].m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_inf(&it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_inf(&it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_inf(&it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_inf(&it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_inf(&it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_inf(&it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+        else if (m_channels[channel].m_fcPos == 1) // Supra
+        {
+            switch (m_channels[channel].m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_sup(&it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_sup(&it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_sup(&it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_sup(&it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_sup(&it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_sup(&it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+        else if (m_channels[channel].m_fcPos == 2) // Center
+        {
+            switch (m_channels[channel].m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_cen(&it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_cen(&it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_cen(&it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_cen(&it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_cen(&it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_cen(&it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    m_channels[channel].m_sampleFifoF->write(m_channels[channel].m_convertBufferF.begin(), it);
+}
@@ -31,8 +31,10 @@
 #include "soapysdr/devicesoapysdrshared.h"
 #include "dsp/decimators.h"
 #include "dsp/decimatorsfi.h"
+#include "dsp/decimatorsff.h"
 
 class SampleSinkFifo;
+class SampleSinkFifoF;
 
 class SoapySDRInputThread : public QThread {
     Q_OBJECT
@@ -53,6 +55,8 @@ public:
     int getFcPos(unsigned int channel) const;
     void setFifo(unsigned int channel, SampleSinkFifo *sampleFifo);
     SampleSinkFifo *getFifo(unsigned int channel);
+    void setFifoF(unsigned int channel, SampleSinkFifoF *sampleFifoF); //!< when set the channel delivers float samples (CF32 stream format forced)
+    SampleSinkFifoF *getFifoF(unsigned int channel);
     void setIQOrder(bool iqOrder) { m_iqOrder = iqOrder; }
 
 private:
@@ -60,6 +64,8 @@ private:
     {
         SampleVector m_convertBuffer;
         SampleSinkFifo* m_sampleFifo;
+        FSampleVector m_convertBufferF;
+        SampleSinkFifoF* m_sampleFifoF;
         unsigned int m_log2Decim;
         int m_fcPos;
         Decimators<qint32, qint8, SDR_RX_SAMP_SZ, 8, true> m_decimators8IQ;
@@ -70,9 +76,12 @@ private:
         Decimators<qint32, qint16, SDR_RX_SAMP_SZ, 16, false> m_decimators16QI;
         DecimatorsFI<true> m_decimatorsFloatIQ;
         DecimatorsFI<false> m_decimatorsFloatQI;
+        DecimatorsFF<true> m_decimatorsFFIQ;
+        DecimatorsFF<false> m_decimatorsFFQI;
 
         Channel() :
             m_sampleFifo(0),
+            m_sampleFifoF(0),
             m_log2Decim(0),
             m_fcPos(0)
         {}
@@ -102,6 +111,7 @@ private:
 
     void run();
     unsigned int getNbFifos();
+    unsigned int getNbFifosF();
 
     void callbackSI8IQ(const qint8* buf, qint32 len, unsigned int channel = 0);
     void callbackSI12IQ(const qint16* buf, qint32 len, unsigned int channel = 0);
@@ -113,6 +123,9 @@ private:
     void callbackSI16QI(const qint16* buf, qint32 len, unsigned int channel = 0);
     void callbackSIFQI(const float* buf, qint32 len, unsigned int channel = 0);
 
+    template<bool IQOrder>
+    void callbackSIFF(DecimatorsFF<IQOrder>& decimators, const float* buf, qint32 len, unsigned int channel);
+
     void callbackMIIQ(std::vector<void *>& buffs, qint32 samplesPerChannel);
     void callbackMIQI(std::vector<void *>& buffs, qint32 samplesPerChannel);
 };
@@ -24,6 +24,7 @@
 #include "dsp/devicesamplesink.h"
 #include "dsp/devicesamplemimo.h"
 #include "settings/preset.h"
+#include "dsp/basebandsamplesink.h"
 #include "channel/channelapi.h"
 
 #include "deviceapi.h"
@@ -115,12 +116,15 @@ void DeviceAPI::removeMIMOChannel(MIMOChannel* channel)
 
 void DeviceAPI::addChannelSinkAPI(ChannelAPI* channelAPI)
 {
+    QMutexLocker mutexLocker(&m_channelSinkAPIsMutex);
     m_channelSinkAPIs.append(channelAPI);
     renumerateChannels();
 }
 
 void DeviceAPI::removeChannelSinkAPI(ChannelAPI* channelAPI)
 {
+    QMutexLocker mutexLocker(&m_channelSinkAPIsMutex); // waits for a squelch state read of this channel
+
     if (m_channelSinkAPIs.removeOne(channelAPI)) {
         renumerateChannels();
     }
@@ -439,6 +443,20 @@ ChannelAPI *DeviceAPI::getChanelSinkAPIAt(int index)
     }
 }
 
+bool DeviceAPI::getChannelSinkSquelchState(int index, bool& open)
+{
+    // channels leave the list at the start of their destruction so that the channel stays valid under the lock
+    QMutexLocker mutexLocker(&m_channelSinkAPIsMutex);
+
+    if ((index < 0) || (index >= m_channelSinkAPIs.size())) {
+        return false;
+    }
+
+    BasebandSampleSink *sink = dynamic_cast<BasebandSampleSink*>(m_channelSinkAPIs.at(index));
+
+    return sink && sink->getSquelchState(open);
+}
+
 ChannelAPI *DeviceAPI::getChanelSourceAPIAt(int index)
 {
     if (index < m_channelSourceAPIs.size()) {
@@ -21,6 +21,7 @@
 #include <QObject>
 #include <QString>
 #include <QTimer>
+#include <QMutex>
 
 #include "export.h"
 
@@ -133,6 +134,7 @@ public:
 
     int getNbSourceChannels() const { return m_channelSourceAPIs.size(); }
     int getNbSinkChannels() const { return m_channelSinkAPIs.size(); }
+    bool getChannelSinkSquelchState(int index, bool& open); //!< from any thread. false if no such channel or no squelch
     int getNbMIMOChannels() const { return m_mimoChannelAPIs.size(); }
 
     void loadSamplingDeviceSettings(const Preset* preset);
@@ -193,6 +195,7 @@ protected:
 
     DSPDeviceSourceEngine *m_deviceSourceEngine;
     QList<ChannelAPI*> m_channelSinkAPIs;
+    QMutex m_channelSinkAPIsMutex; //!< for the channel list and its channels from other threads than the main one
 
     // Single Tx (i.e. sink)
 
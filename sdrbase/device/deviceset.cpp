@@ -19,6 +19,7 @@
 
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
+#include "dsp/spectrumvis.h"
 #include "plugin/pluginapi.h"
 #include "plugin/plugininterface.h"
 #include "settings/preset.h"
@@ -32,16 +33,22 @@
 
 DeviceSet::DeviceSet(int tabIndex, int deviceType)
 {
-    (void) deviceType;
     m_deviceAPI = nullptr;
     m_deviceSourceEngine = nullptr;
     m_deviceSinkEngine = nullptr;
     m_deviceMIMOEngine = nullptr;
     m_deviceTabIndex = tabIndex;
+
+    if (deviceType == 1) { // Single Tx
+        m_spectrumVis = new SpectrumVis(SDR_TX_SCALEF);
+    } else { // Single Rx or MIMO
+        m_spectrumVis = new SpectrumVis(SDR_RX_SCALEF);
+    }
 }
 
 DeviceSet::~DeviceSet()
 {
+    delete m_spectrumVis;
 }
 
 
@@ -26,6 +26,7 @@ class DeviceAPI;
 class DSPDeviceSourceEngine;
 class DSPDeviceSinkEngine;
 class DSPDeviceMIMOEngine;
+class SpectrumVis;
 class PluginAPI;
 class ChannelAPI;
 class Preset;
@@ -37,6 +38,7 @@ public:
     DSPDeviceSourceEngine *m_deviceSourceEngine;
     DSPDeviceSinkEngine *m_deviceSinkEngine;
     DSPDeviceMIMOEngine *m_deviceMIMOEngine;
+    SpectrumVis *m_spectrumVis; //!< main spectrum. Shared with the GUI when there is one.
 
     DeviceSet(int tabIndex, int deviceType);
     ~DeviceSet();
@@ -16,6 +16,7 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 #include "util/message.h"
+#include "dsp/fsampleconverter.h"
 
 #include "basebandsamplesink.h"
 
@@ -29,6 +30,12 @@ BasebandSampleSink::~BasebandSampleSink()
 {
 }
 
+void BasebandSampleSink::feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly)
+{
+	FSampleConverter::toSample(begin, end, m_convertedSamples);
+	feed(m_convertedSamples.begin(), m_convertedSamples.end(), positiveOnly);
+}
+
 void BasebandSampleSink::handleInputMessages()
 {
 	Message* message;
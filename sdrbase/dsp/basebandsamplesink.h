@@ -25,6 +25,8 @@
 #include "util/messagequeue.h"
 
 class Message;
+class SampleSinkSharedFifo;
+struct SampleFifoStats;
 
 class SDRBASE_API BasebandSampleSink : public QObject {
 	Q_OBJECT
@@ -35,7 +37,19 @@ public:
 	virtual void start() = 0;
 	virtual void stop() = 0;
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly) = 0;
+	/**
+	 * Float pipeline: samples normalized to full scale 1.0 from a source delivering float samples. The default converts
+	 * them to fixed point and calls feed(). Sinks returning true from isFloatNative() process them without conversion.
+	 */
+	virtual void feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly);
+	virtual bool isFloatNative() const { return false; } //!< true if feedF() is implemented. The sink is then fed directly in the float pipeline.
 	virtual bool handleMessage(const Message& cmd) = 0; //!< Processing of a message. Returns true if message has actually been processed
+	//! Read samples from the device engine shared FIFO instead of being fed. Returns false if not supported. nullptr detaches.
+	virtual bool setSharedFifo(SampleSinkSharedFifo *sharedFifo) { (void) sharedFifo; return false; }
+	//! Statistics of the FIFO the sink reads its samples from. Returns false if not supported.
+	virtual bool getFifoStats(SampleFifoStats& stats) const { (void) stats; return false; }
+	//! Current squelch state. Returns false if the sink has no squelch.
+	virtual bool getSquelchState(bool& open) const { (void) open; return false; }
 
 	MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
     void setMessageQueueToGUI(MessageQueue *queue) { m_guiMessageQueue = queue; }
@@ -45,6 +59,9 @@ protected:
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     MessageQueue *m_guiMessageQueue;  //!< Input message queue to the GUI
 
+private:
+    SampleVector m_convertedSamples;  //!< used by the default feedF()
+
 protected slots:
 	void handleInputMessages();
 };
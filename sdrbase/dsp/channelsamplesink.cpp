@@ -16,10 +16,96 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include "dsp/nco.h"
+#include "dsp/ncof.h"
+#include "dsp/interpolator.h"
+#include "dsp/fsampleconverter.h"
 #include "channelsamplesink.h"
 
 ChannelSampleSink::ChannelSampleSink()
 {}
 
 ChannelSampleSink::~ChannelSampleSink()
-{}
\ No newline at end of file
+{}
+
+void ChannelSampleSink::feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end)
+{
+    FSampleConverter::toSample(begin, end, m_convertedSamples);
+    feed(m_convertedSamples.begin(), m_convertedSamples.end());
+}
+
+template<class Oscillator, class Iterator>
+static void shiftAndResampleT(
+    const Iterator& begin,
+    const Iterator& end,
+    Real scale,
+    Oscillator& nco,
+    Interpolator& interpolator,
+    Real interpolatorDistance,
+    Real& interpolatorDistanceRemain,
+    ComplexVector& shiftedSamples,
+    ComplexVector& channelSamples)
+{
+    shiftedSamples.resize(end - begin);
+    ComplexVector::iterator sit = shiftedSamples.begin();
+
+    for (Iterator it = begin; it != end; ++it, ++sit)
+    {
+        Complex c(it->real() * scale, it->imag() * scale);
+        *sit = c * nco.nextIQ();
+    }
+
+    if (interpolatorDistance < 1.0f) { // interpolate
+        interpolator.interpolate(&interpolatorDistanceRemain, interpolatorDistance, shiftedSamples.data(), shiftedSamples.size(), channelSamples);
+    } else { // decimate
+        interpolator.decimate(&interpolatorDistanceRemain, interpolatorDistance, shiftedSamples.data(), shiftedSamples.size(), channelSamples);
+    }
+}
+
+void ChannelSampleSink::shiftAndResample(
+    const SampleVector::const_iterator& begin,
+    const SampleVector::const_iterator& end,
+    NCO& nco,
+    Interpolator& interpolator,
+    Real interpolatorDistance,
+    Real& interpolatorDistanceRemain,
+    ComplexVector& channelSamples)
+{
+    shiftAndResampleT(begin, end, 1.0f, nco, interpolator, interpolatorDistance, interpolatorDistanceRemain, m_shiftedSamples, channelSamples);
+}
+
+void ChannelSampleSink::shiftAndResample(
+    const SampleVector::const_iterator& begin,
+    const SampleVector::const_iterator& end,
+    NCOF& nco,
+    Interpolator& interpolator,
+    Real interpolatorDistance,
+    Real& interpolatorDistanceRemain,
+    ComplexVector& channelSamples)
+{
+    shiftAndResampleT(begin, end, 1.0f, nco, interpolator, interpolatorDistance, interpolatorDistanceRemain, m_shiftedSamples, channelSamples);
+}
+
+void ChannelSampleSink::shiftAndResample(
+    const FSampleVector::const_iterator& begin,
+    const FSampleVector::const_iterator& end,
+    NCO& nco,
+    Interpolator& interpolator,
+    Real interpolatorDistance,
+    Real& interpolatorDistanceRemain,
+    ComplexVector& channelSamples)
+{
+    shiftAndResampleT(begin, end, SDR_RX_SCALEF, nco, interpolator, interpolatorDistance, interpolatorDistanceRemain, m_shiftedSamples, channelSamples);
+}
+
+void ChannelSampleSink::shiftAndResample(
+    const FSampleVector::const_iterator& begin,
+    const FSampleVector::const_iterator& end,
+    NCOF& nco,
+    Interpolator& interpolator,
+    Real interpolatorDistance,
+    Real& interpolatorDistanceRemain,
+    ComplexVector& channelSamples)
+{
+    shiftAndResampleT(begin, end, SDR_RX_SCALEF, nco, interpolator, interpolatorDistance, interpolatorDistanceRemain, m_shiftedSamples, channelSamples);
+}
@@ -25,6 +25,9 @@
 #include "dsptypes.h"
 
 class Message;
+class NCO;
+class NCOF;
+class Interpolator;
 
 class SDRBASE_API ChannelSampleSink {
 public:
@@ -32,6 +35,61 @@ public:
 	virtual ~ChannelSampleSink();
 
     virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end) = 0;
+    /**
+     * Float pipeline: baseband samples normalized to full scale 1.0. The default converts them to fixed point
+     * and calls feed(). Sinks override it with the FSample version of shiftAndResample() to skip the conversion.
+     */
+    virtual void feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end);
+
+    /**
+     * Block API: process a contiguous block of channel rate samples already shifted to zero frequency.
+     * Sinks processing by block implement it and call it from feed() after shiftAndResample().
+     */
+    virtual void feedChannel(const Complex *samples, unsigned int nbSamples) { (void) samples; (void) nbSamples; }
+
+protected:
+    /** Shift baseband samples with the NCO and convert them to channel rate with the interpolator. Results are appended to channelSamples. */
+    void shiftAndResample(
+        const SampleVector::const_iterator& begin,
+        const SampleVector::const_iterator& end,
+        NCO& nco,
+        Interpolator& interpolator,
+        Real interpolatorDistance,
+        Real& interpolatorDistanceRemain,
+        ComplexVector& channelSamples
+    );
+    void shiftAndResample(
+        const SampleVector::const_iterator& begin,
+        const SampleVector::const_iterator& end,
+        NCOF& nco,
+        Interpolator& interpolator,
+        Real interpolatorDistance,
+        Real& interpolatorDistanceRemain,
+        ComplexVector& channelSamples
+    );
+    /** Same on float pipeline samples. Channel samples are scaled as for fixed point input (SDR_RX_SCALEF). */
+    void shiftAndResample(
+        const FSampleVector::const_iterator& begin,
+        const FSampleVector::const_iterator& end,
+        NCO& nco,
+        Interpolator& interpolator,
+        Real interpolatorDistance,
+        Real& interpolatorDistanceRemain,
+        ComplexVector& channelSamples
+    );
+    void shiftAndResample(
+        const FSampleVector::const_iterator& begin,
+        const FSampleVector::const_iterator& end,
+        NCOF& nco,
+        Interpolator& interpolator,
+        Real interpolatorDistance,
+        Real& interpolatorDistanceRemain,
+        ComplexVector& channelSamples
+    );
+
+private:
+    ComplexVector m_shiftedSamples; //!< NCO output fed to the interpolator buffer versions
+    SampleVector m_convertedSamples; //!< float pipeline samples converted by the default feedF()
 };
 
 #endif // SDRBASE_DSP_CHANNELSAMPLESINK_H_
@@ -18,8 +18,12 @@
 #ifndef INCLUDE_GPL_DSP_DECIMATORS_H_
 #define INCLUDE_GPL_DSP_DECIMATORS_H_
 
+#include <string.h>
+#include <vector>
+
 #include "dsp/dsptypes.h"
 #include "dsp/inthalfbandfiltereo.h"
+#include "dsp/inthalfbandfilterbk.h"
 
 #define DECIMATORS_HB_FILTER_ORDER 64
 
@@ -392,6 +396,18 @@ template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQ
 class Decimators
 {
 public:
+    Decimators();
+
+    /**
+     * In block mode the halfband cascade runs stage by stage on the whole buffer with the block
+     * filters instead of sample by sample with the even/odd filters. Results are identical but
+     * the block filters compute several outputs at a time with SIMD instructions (AVX-512, AVX2,
+     * SSE4.1 or NEON). Block mode is the default when the CPU has one of these.
+     */
+    void setBlockMode(bool blockMode) { m_blockMode = blockMode; }
+    bool getBlockMode() const { return m_blockMode; }
+    static bool isBlockModeAccelerated(); //!< SIMD block filters are usable on this CPU
+
     // interleaved I/Q input buffer
 	void decimate1(SampleVector::iterator* it, const T* buf, qint32 len);
 
@@ -442,6 +458,8 @@ public:
 
 private:
 #ifdef SDR_RX_SAMPLE_24BIT
+    typedef IntHalfbandFilterBK<qint64, qint64, DECIMATORS_HB_FILTER_ORDER, false> BlockFilter;
+    typedef qint64 BlockStorageType;
     IntHalfbandFilterEO<qint64, qint64, DECIMATORS_HB_FILTER_ORDER, IQOrder> m_decimator2;  // 1st stages
     IntHalfbandFilterEO<qint64, qint64, DECIMATORS_HB_FILTER_ORDER, true> m_decimator2s; // 1st stages - straight
     IntHalfbandFilterEO<qint64, qint64, DECIMATORS_HB_FILTER_ORDER, true> m_decimator4;  // 2nd stages
@@ -450,6 +468,8 @@ private:
     IntHalfbandFilterEO<qint64, qint64, DECIMATORS_HB_FILTER_ORDER, true> m_decimator32; // 5th stages
     IntHalfbandFilterEO<qint64, qint64, DECIMATORS_HB_FILTER_ORDER, true> m_decimator64; // 6th stages
 #else
+    typedef IntHalfbandFilterBK<qint32, qint32, DECIMATORS_HB_FILTER_ORDER, false> BlockFilter;
+    typedef qint32 BlockStorageType;
     IntHalfbandFilterEO<qint32, qint32, DECIMATORS_HB_FILTER_ORDER, IQOrder> m_decimator2;  // 1st stages
     IntHalfbandFilterEO<qint32, qint32, DECIMATORS_HB_FILTER_ORDER, true> m_decimator2s; // 1st stages - straight
     IntHalfbandFilterEO<qint32, qint32, DECIMATORS_HB_FILTER_ORDER, true> m_decimator4;  // 2nd stages
@@ -458,8 +478,76 @@ private:
     IntHalfbandFilterEO<qint32, qint32, DECIMATORS_HB_FILTER_ORDER, true> m_decimator32; // 5th stages
     IntHalfbandFilterEO<qint32, qint32, DECIMATORS_HB_FILTER_ORDER, true> m_decimator64; // 6th stages
 #endif
+    bool m_blockMode;
+    BlockFilter m_blockDecimator2;     // 1st stages
+    BlockFilter m_blockDecimator2s;    // 1st stages - straight
+    BlockFilter m_blockDecimators[5];  // 2nd to 6th stages
+    std::vector<BlockStorageType> m_blockBuffer; // interleaved I/Q samples between stages
+
+    /**
+     * Block mode decimation by 2^strlen(modes). Only whole output samples are processed.
+     * modes: one letter per stage from the first: I for infradyne (lower half), S for supradyne (upper half), C for center
+     * straight: the first stage is the one of the infradyne and supradyne positions
+     */
+    void decimateBlock(SampleVector::iterator* it, const T* buf, qint32 len, const char *modes, bool straight, uint pre, uint post);
 };
 
+template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
+Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::Decimators() :
+    m_blockMode(isBlockModeAccelerated())
+{
+}
+
+template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
+bool Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::isBlockModeAccelerated()
+{
+#if !defined(SDR_RX_SAMPLE_24BIT)
+    return IntHalfbandFilterBKIntrinsics<DECIMATORS_HB_FILTER_ORDER>::isAccelerated(); // 32 bit block filters
+#else
+    return false;
+#endif
+}
+
+template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
+void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimateBlock(SampleVector::iterator* it, const T* buf, qint32 len, const char *modes, bool straight, uint pre, uint post)
+{
+    unsigned int log2Decim = strlen(modes);
+    unsigned int nbIn = ((len / 2) >> log2Decim) << log2Decim;
+
+    if (m_blockBuffer.size() < 2*nbIn) {
+        m_blockBuffer.resize(2*nbIn);
+    }
+
+    BlockStorageType *data = m_blockBuffer.data();
+
+    for (unsigned int i = 0; i < 2*nbIn; i++) {
+        data[i] = buf[i] << pre;
+    }
+
+    // stages run in place. I and Q are swapped at the end when not in IQ order.
+    unsigned int nb = nbIn;
+
+    for (unsigned int stage = 0; stage < log2Decim; stage++)
+    {
+        BlockFilter& filter = stage > 0 ? m_blockDecimators[stage - 1] : straight ? m_blockDecimator2s : m_blockDecimator2;
+
+        if (modes[stage] == 'I') {
+            nb = filter.workDecimateLowerHalf(data, nb, data);
+        } else if (modes[stage] == 'S') {
+            nb = filter.workDecimateUpperHalf(data, nb, data);
+        } else {
+            nb = filter.workDecimateCenter(data, nb, data);
+        }
+    }
+
+    for (unsigned int m = 0; m < nb; m++)
+    {
+        (**it).setReal(data[2*m + (IQOrder ? 0 : 1)] >> post);
+        (**it).setImag(data[2*m + (IQOrder ? 1 : 0)] >> post);
+        ++(*it);
+    }
+}
+
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate1(SampleVector::iterator* it, const T* buf, qint32 len)
 {
@@ -507,6 +595,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate2_u(Sample
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate2_inf(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "I", false, decimation_shifts<SdrBits, InputBits>::pre2, decimation_shifts<SdrBits, InputBits>::post2);
+        return;
+    }
+
     StorageType buf2[4];
 
     for (int pos = 0; pos < len - 7; pos += 8)
@@ -535,6 +629,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate2_inf(Samp
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate2_sup(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "S", false, decimation_shifts<SdrBits, InputBits>::pre2, decimation_shifts<SdrBits, InputBits>::post2);
+        return;
+    }
+
     StorageType buf2[4];
 
     for (int pos = 0; pos < len - 7; pos += 8)
@@ -563,6 +663,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate2_sup(Samp
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate2_cen(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "C", false, decimation_shifts<SdrBits, InputBits>::pre2, decimation_shifts<SdrBits, InputBits>::post2);
+        return;
+    }
+
     StorageType buf2[4];
 
     for (int pos = 0; pos < len - 7; pos += 8)
@@ -591,6 +697,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate2_cen(Samp
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate4_inf(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "IS", true, decimation_shifts<SdrBits, InputBits>::pre4, decimation_shifts<SdrBits, InputBits>::post4);
+        return;
+    }
+
     StorageType buf2[8], buf4[4];
 
     for (int pos = 0; pos < len - 15; pos += 16)
@@ -641,6 +753,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate4_inf(Samp
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate4_inf_txsync(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "II", true, decimation_shifts<SdrBits, InputBits>::pre4, decimation_shifts<SdrBits, InputBits>::post4);
+        return;
+    }
+
     StorageType buf2[8], buf4[4];
 
     for (int pos = 0; pos < len - 15; pos += 16)
@@ -691,6 +809,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate4_inf_txsy
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate4_sup(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "SI", true, decimation_shifts<SdrBits, InputBits>::pre4, decimation_shifts<SdrBits, InputBits>::post4);
+        return;
+    }
+
     StorageType buf2[8], buf4[4];
 
     for (int pos = 0; pos < len - 15; pos += 16)
@@ -741,6 +865,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate4_sup(Samp
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate4_sup_txsync(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "SS", true, decimation_shifts<SdrBits, InputBits>::pre4, decimation_shifts<SdrBits, InputBits>::post4);
+        return;
+    }
+
     StorageType buf2[8], buf4[4];
 
     for (int pos = 0; pos < len - 15; pos += 16)
@@ -791,6 +921,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate4_sup_txsy
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate4_cen(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+	if (m_blockMode)
+	{
+		decimateBlock(it, buf, len, "CC", false, decimation_shifts<SdrBits, InputBits>::pre4, decimation_shifts<SdrBits, InputBits>::post4);
+		return;
+	}
+
 	StorageType buf2[8], buf4[4];
 
 	for (int pos = 0; pos < len - 15; pos += 16)
@@ -834,6 +970,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate4_cen(Samp
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate8_inf(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "ISC", true, decimation_shifts<SdrBits, InputBits>::pre8, decimation_shifts<SdrBits, InputBits>::post8);
+        return;
+    }
+
     StorageType buf2[16], buf4[8], buf8[4];
 
 	for (int pos = 0; pos < len - 31; pos += 32)
@@ -907,6 +1049,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate8_inf(Samp
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate8_inf_txsync(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "IIS", true, decimation_shifts<SdrBits, InputBits>::pre8, decimation_shifts<SdrBits, InputBits>::post8);
+        return;
+    }
+
     StorageType buf2[16], buf4[8], buf8[4];
 
 	for (int pos = 0; pos < len - 31; pos += 32)
@@ -950,6 +1098,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate8_inf_txsy
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate8_sup(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "SIC", true, decimation_shifts<SdrBits, InputBits>::pre8, decimation_shifts<SdrBits, InputBits>::post8);
+        return;
+    }
+
     StorageType buf2[16], buf4[8], buf8[4];
 
     for (int pos = 0; pos < len - 31; pos += 32)
@@ -1023,6 +1177,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate8_sup(Samp
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate8_sup_txsync(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "SSI", true, decimation_shifts<SdrBits, InputBits>::pre8, decimation_shifts<SdrBits, InputBits>::post8);
+        return;
+    }
+
     StorageType buf2[16], buf4[8], buf8[4];
 
     for (int pos = 0; pos < len - 31; pos += 32)
@@ -1066,6 +1226,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate8_sup_txsy
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate8_cen(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+	if (m_blockMode)
+	{
+		decimateBlock(it, buf, len, "CCC", false, decimation_shifts<SdrBits, InputBits>::pre8, decimation_shifts<SdrBits, InputBits>::post8);
+		return;
+	}
+
 	StorageType intbuf[8];
 
 	for (int pos = 0; pos < len - 15; pos += 16)
@@ -1126,6 +1292,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate8_cen(Samp
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate16_inf(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "ISSC", true, decimation_shifts<SdrBits, InputBits>::pre16, decimation_shifts<SdrBits, InputBits>::post16);
+        return;
+    }
+
     StorageType buf2[32], buf4[16], buf8[8], buf16[4];
 
     for (int pos = 0; pos < len - 63; pos += 64)
@@ -1259,6 +1431,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate16_inf(Sam
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate16_inf_txsync(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "IISI", true, decimation_shifts<SdrBits, InputBits>::pre16, decimation_shifts<SdrBits, InputBits>::post16);
+        return;
+    }
+
     StorageType buf2[32], buf4[16], buf8[8], buf16[4];
 
     for (int pos = 0; pos < len - 63; pos += 64)
@@ -1309,6 +1487,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate16_inf_txs
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate16_sup(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "SIIC", true, decimation_shifts<SdrBits, InputBits>::pre16, decimation_shifts<SdrBits, InputBits>::post16);
+        return;
+    }
+
     StorageType buf2[32], buf4[16], buf8[8], buf16[4];
 
     for (int pos = 0; pos < len - 63; pos += 64)
@@ -1442,6 +1626,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate16_sup(Sam
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate16_sup_txsync(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "SSIS", true, decimation_shifts<SdrBits, InputBits>::pre16, decimation_shifts<SdrBits, InputBits>::post16);
+        return;
+    }
+
     StorageType buf2[32], buf4[16], buf8[8], buf16[4];
 
     for (int pos = 0; pos < len - 63; pos += 64)
@@ -1492,6 +1682,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate16_sup_txs
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate16_cen(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+	if (m_blockMode)
+	{
+		decimateBlock(it, buf, len, "CCCC", false, decimation_shifts<SdrBits, InputBits>::pre16, decimation_shifts<SdrBits, InputBits>::post16);
+		return;
+	}
+
 	StorageType intbuf[16];
 
 	for (int pos = 0; pos < len - 31; pos += 32)
@@ -1601,6 +1797,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate16_cen(Sam
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate32_inf(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "ISSSC", true, decimation_shifts<SdrBits, InputBits>::pre32, decimation_shifts<SdrBits, InputBits>::post32);
+        return;
+    }
+
     StorageType buf2[64], buf4[32], buf8[16], buf16[8], buf32[4];
 
     for (int pos = 0; pos < len - 127; pos += 128)
@@ -1854,6 +2056,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate32_inf(Sam
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate32_inf_txsync(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "IISIS", true, decimation_shifts<SdrBits, InputBits>::pre32, decimation_shifts<SdrBits, InputBits>::post32);
+        return;
+    }
+
     StorageType buf2[64], buf4[32], buf8[16], buf16[8], buf32[4];
 
     for (int pos = 0; pos < len - 127; pos += 128)
@@ -1911,6 +2119,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate32_inf_txs
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate32_sup(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "SIIIC", true, decimation_shifts<SdrBits, InputBits>::pre32, decimation_shifts<SdrBits, InputBits>::post32);
+        return;
+    }
+
     StorageType buf2[64], buf4[32], buf8[16], buf16[8], buf32[4];
 
     for (int pos = 0; pos < len - 127; pos += 128)
@@ -2164,6 +2378,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate32_sup(Sam
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate32_sup_txsync(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "SSISI", true, decimation_shifts<SdrBits, InputBits>::pre32, decimation_shifts<SdrBits, InputBits>::post32);
+        return;
+    }
+
     StorageType buf2[64], buf4[32], buf8[16], buf16[8], buf32[4];
 
     for (int pos = 0; pos < len - 127; pos += 128)
@@ -2221,6 +2441,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate32_sup_txs
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate32_cen(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+	if (m_blockMode)
+	{
+		decimateBlock(it, buf, len, "CCCCC", false, decimation_shifts<SdrBits, InputBits>::pre32, decimation_shifts<SdrBits, InputBits>::post32);
+		return;
+	}
+
 	StorageType intbuf[32];
 
 	for (int pos = 0; pos < len - 63; pos += 64)
@@ -2427,6 +2653,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate32_cen(Sam
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate64_inf(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "ISSSSC", true, decimation_shifts<SdrBits, InputBits>::pre64, decimation_shifts<SdrBits, InputBits>::post64);
+        return;
+    }
+
     StorageType buf2[128], buf4[64], buf8[32], buf16[16], buf32[8], buf64[4];
 
     for (int pos = 0; pos < len - 255; pos += 256)
@@ -2920,6 +3152,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate64_inf(Sam
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate64_inf_txsync(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "ISISIS", true, decimation_shifts<SdrBits, InputBits>::pre64, decimation_shifts<SdrBits, InputBits>::post64);
+        return;
+    }
+
     StorageType buf2[128], buf4[64], buf8[32], buf16[16], buf32[8], buf64[4];
 
     for (int pos = 0; pos < len - 255; pos += 256)
@@ -2984,6 +3222,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate64_inf_txs
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate64_sup(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "ISISIS", true, decimation_shifts<SdrBits, InputBits>::pre64, decimation_shifts<SdrBits, InputBits>::post64);
+        return;
+    }
+
     StorageType buf2[128], buf4[64], buf8[32], buf16[16], buf32[8], buf64[4];
 
     for (int pos = 0; pos < len - 255; pos += 256)
@@ -3049,6 +3293,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate64_sup(Sam
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate64_cen(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+	if (m_blockMode)
+	{
+		decimateBlock(it, buf, len, "CCCCCC", false, decimation_shifts<SdrBits, InputBits>::pre64, decimation_shifts<SdrBits, InputBits>::post64);
+		return;
+	}
+
 	StorageType intbuf[64];
 
 	for (int pos = 0; pos < len - 127; pos += 128)
@@ -3449,6 +3699,12 @@ void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate64_cen(Sam
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate64_sup_txsync(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "SISISI", true, decimation_shifts<SdrBits, InputBits>::pre64, decimation_shifts<SdrBits, InputBits>::post64);
+        return;
+    }
+
     StorageType buf2[128], buf4[64], buf8[32], buf16[16], buf32[8], buf64[4];
 
     for (int pos = 0; pos < len - 255; pos += 256)
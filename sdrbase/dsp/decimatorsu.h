@@ -24,8 +24,12 @@
 #ifndef INCLUDE_GPL_DSP_DECIMATORSU_H_
 #define INCLUDE_GPL_DSP_DECIMATORSU_H_
 
+#include <string.h>
+#include <vector>
+
 #include "dsp/dsptypes.h"
 #include "dsp/inthalfbandfiltereo.h"
+#include "dsp/inthalfbandfilterbk.h"
 
 #define DECIMATORS_HB_FILTER_ORDER 64
 
@@ -177,6 +181,18 @@ template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shi
 class DecimatorsU
 {
 public:
+    DecimatorsU();
+
+    /**
+     * In block mode the halfband cascade runs stage by stage on the whole buffer with the block
+     * filters instead of sample by sample with the even/odd filters. Results are identical but
+     * the block filters compute several outputs at a time with SIMD instructions (AVX-512, AVX2,
+     * SSE4.1 or NEON). Block mode is the default when the CPU has one of these.
+     */
+    void setBlockMode(bool blockMode) { m_blockMode = blockMode; }
+    bool getBlockMode() const { return m_blockMode; }
+    static bool isBlockModeAccelerated(); //!< SIMD block filters are usable on this CPU
+
     // interleaved I/Q input buffer
 	void decimate1(SampleVector::iterator* it, const T* buf, qint32 len);
 	void decimate2_inf(SampleVector::iterator* it, const T* buf, qint32 len);
@@ -200,6 +216,8 @@ public:
 
 private:
 #ifdef SDR_RX_SAMPLE_24BIT
+	typedef IntHalfbandFilterBK<qint64, qint64, DECIMATORS_HB_FILTER_ORDER, false> BlockFilter;
+	typedef qint64 BlockStorageType;
 	IntHalfbandFilterEO<qint64, qint64, DECIMATORS_HB_FILTER_ORDER, IQOrder> m_decimator2;  // 1st stages
 	IntHalfbandFilterEO<qint64, qint64, DECIMATORS_HB_FILTER_ORDER, true> m_decimator2s; // 1st stages - straight
 	IntHalfbandFilterEO<qint64, qint64, DECIMATORS_HB_FILTER_ORDER, true> m_decimator4;  // 2nd stages
@@ -208,6 +226,8 @@ private:
 	IntHalfbandFilterEO<qint64, qint64, DECIMATORS_HB_FILTER_ORDER, true> m_decimator32; // 5th stages
 	IntHalfbandFilterEO<qint64, qint64, DECIMATORS_HB_FILTER_ORDER, true> m_decimator64; // 6th stages
 #else
+    typedef IntHalfbandFilterBK<qint32, qint32, DECIMATORS_HB_FILTER_ORDER, false> BlockFilter;
+    typedef qint32 BlockStorageType;
     IntHalfbandFilterEO<qint32, qint32, DECIMATORS_HB_FILTER_ORDER, IQOrder> m_decimator2;  // 1st stages
     IntHalfbandFilterEO<qint32, qint32, DECIMATORS_HB_FILTER_ORDER, true> m_decimator2s; // 1st stages - straight
     IntHalfbandFilterEO<qint32, qint32, DECIMATORS_HB_FILTER_ORDER, true> m_decimator4;  // 2nd stages
@@ -216,8 +236,76 @@ private:
     IntHalfbandFilterEO<qint32, qint32, DECIMATORS_HB_FILTER_ORDER, true> m_decimator32; // 5th stages
     IntHalfbandFilterEO<qint32, qint32, DECIMATORS_HB_FILTER_ORDER, true> m_decimator64; // 6th stages
 #endif
+    bool m_blockMode;
+    BlockFilter m_blockDecimator2;     // 1st stages
+    BlockFilter m_blockDecimator2s;    // 1st stages - straight
+    BlockFilter m_blockDecimators[5];  // 2nd to 6th stages
+    std::vector<BlockStorageType> m_blockBuffer; // interleaved I/Q samples between stages
+
+    /**
+     * Block mode decimation by 2^strlen(modes). Only whole output samples are processed.
+     * modes: one letter per stage from the first: I for infradyne (lower half), S for supradyne (upper half), C for center
+     * straight: the first stage is the one of the infradyne and supradyne positions
+     */
+    void decimateBlock(SampleVector::iterator* it, const T* buf, qint32 len, const char *modes, bool straight, uint pre, uint post);
 };
 
+template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
+DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::DecimatorsU() :
+    m_blockMode(isBlockModeAccelerated())
+{
+}
+
+template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
+bool DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::isBlockModeAccelerated()
+{
+#if !defined(SDR_RX_SAMPLE_24BIT)
+    return IntHalfbandFilterBKIntrinsics<DECIMATORS_HB_FILTER_ORDER>::isAccelerated(); // 32 bit block filters
+#else
+    return false;
+#endif
+}
+
+template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
+void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimateBlock(SampleVector::iterator* it, const T* buf, qint32 len, const char *modes, bool straight, uint pre, uint post)
+{
+    unsigned int log2Decim = strlen(modes);
+    unsigned int nbIn = ((len / 2) >> log2Decim) << log2Decim;
+
+    if (m_blockBuffer.size() < 2*nbIn) {
+        m_blockBuffer.resize(2*nbIn);
+    }
+
+    BlockStorageType *data = m_blockBuffer.data();
+
+    for (unsigned int i = 0; i < 2*nbIn; i++) {
+        data[i] = (buf[i] - Shift) << pre;
+    }
+
+    // stages run in place. I and Q are swapped at the end when not in IQ order.
+    unsigned int nb = nbIn;
+
+    for (unsigned int stage = 0; stage < log2Decim; stage++)
+    {
+        BlockFilter& filter = stage > 0 ? m_blockDecimators[stage - 1] : straight ? m_blockDecimator2s : m_blockDecimator2;
+
+        if (modes[stage] == 'I') {
+            nb = filter.workDecimateLowerHalf(data, nb, data);
+        } else if (modes[stage] == 'S') {
+            nb = filter.workDecimateUpperHalf(data, nb, data);
+        } else {
+            nb = filter.workDecimateCenter(data, nb, data);
+        }
+    }
+
+    for (unsigned int m = 0; m < nb; m++)
+    {
+        (**it).setReal(data[2*m + (IQOrder ? 0 : 1)] >> post);
+        (**it).setImag(data[2*m + (IQOrder ? 1 : 0)] >> post);
+        ++(*it);
+    }
+}
+
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate1(SampleVector::iterator* it, const T* buf, qint32 len)
 {
@@ -236,6 +324,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate1(
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate2_inf(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "I", false, decimation_shifts<SdrBits, InputBits>::pre2, decimation_shifts<SdrBits, InputBits>::post2);
+        return;
+    }
+
     StorageType buf2[4];
 
     for (int pos = 0; pos < len - 7; pos += 8)
@@ -264,6 +358,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate2_
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate2_sup(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "S", false, decimation_shifts<SdrBits, InputBits>::pre2, decimation_shifts<SdrBits, InputBits>::post2);
+        return;
+    }
+
     StorageType buf2[4];
 
     for (int pos = 0; pos < len - 7; pos += 8)
@@ -292,6 +392,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate2_
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate4_inf(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "IS", true, decimation_shifts<SdrBits, InputBits>::pre4, decimation_shifts<SdrBits, InputBits>::post4);
+        return;
+    }
+
     StorageType buf2[8], buf4[4];
 
     for (int pos = 0; pos < len - 15; pos += 16)
@@ -342,6 +448,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate4_
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate4_sup(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "SI", true, decimation_shifts<SdrBits, InputBits>::pre4, decimation_shifts<SdrBits, InputBits>::post4);
+        return;
+    }
+
     StorageType buf2[8], buf4[4];
 
     for (int pos = 0; pos < len - 15; pos += 16)
@@ -392,6 +504,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate4_
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate8_inf(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "ISC", true, decimation_shifts<SdrBits, InputBits>::pre8, decimation_shifts<SdrBits, InputBits>::post8);
+        return;
+    }
+
     StorageType buf2[16], buf4[8], buf8[4];
 
     for (int pos = 0; pos < len - 31; pos += 32)
@@ -468,6 +586,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate8_
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate8_sup(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "SIC", true, decimation_shifts<SdrBits, InputBits>::pre8, decimation_shifts<SdrBits, InputBits>::post8);
+        return;
+    }
+
     StorageType buf2[16], buf4[8], buf8[4];
 
     for (int pos = 0; pos < len - 31; pos += 32)
@@ -544,6 +668,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate8_
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate16_inf(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "ISSC", true, decimation_shifts<SdrBits, InputBits>::pre16, decimation_shifts<SdrBits, InputBits>::post16);
+        return;
+    }
+
     StorageType buf2[32], buf4[16], buf8[8], buf16[4];
 
     for (int pos = 0; pos < len - 63; pos += 64)
@@ -684,6 +814,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate16
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate16_sup(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "SIIC", true, decimation_shifts<SdrBits, InputBits>::pre16, decimation_shifts<SdrBits, InputBits>::post16);
+        return;
+    }
+
     StorageType buf2[32], buf4[16], buf8[8], buf16[4];
 
     for (int pos = 0; pos < len - 63; pos += 64)
@@ -824,6 +960,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate16
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate32_inf(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "ISSSC", true, decimation_shifts<SdrBits, InputBits>::pre32, decimation_shifts<SdrBits, InputBits>::post32);
+        return;
+    }
+
     StorageType buf2[64], buf4[32], buf8[16], buf16[8], buf32[4];
 
     for (int pos = 0; pos < len - 127; pos += 128)
@@ -1092,6 +1234,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate32
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate32_sup(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "SIIIC", true, decimation_shifts<SdrBits, InputBits>::pre32, decimation_shifts<SdrBits, InputBits>::post32);
+        return;
+    }
+
     StorageType buf2[64], buf4[32], buf8[16], buf16[8], buf32[4];
 
     for (int pos = 0; pos < len - 127; pos += 128)
@@ -1360,6 +1508,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate32
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate64_inf(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "ISSSSC", true, decimation_shifts<SdrBits, InputBits>::pre64, decimation_shifts<SdrBits, InputBits>::post64);
+        return;
+    }
+
     StorageType buf2[128], buf4[64], buf8[32], buf16[16], buf32[8], buf64[4];
 
     for (int pos = 0; pos < len - 255; pos += 256)
@@ -1884,6 +2038,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate64
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate64_sup(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "SIIIIC", true, decimation_shifts<SdrBits, InputBits>::pre64, decimation_shifts<SdrBits, InputBits>::post64);
+        return;
+    }
+
     StorageType buf2[128], buf4[64], buf8[32], buf16[16], buf32[8], buf64[4];
 
     for (int pos = 0; pos < len - 255; pos += 256)
@@ -2408,6 +2568,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate64
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate2_cen(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "C", false, decimation_shifts<SdrBits, InputBits>::pre2, decimation_shifts<SdrBits, InputBits>::post2);
+        return;
+    }
+
     StorageType buf2[4];
 
     for (int pos = 0; pos < len - 7; pos += 8)
@@ -2436,6 +2602,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate2_
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate4_cen(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+    if (m_blockMode)
+    {
+        decimateBlock(it, buf, len, "CC", false, decimation_shifts<SdrBits, InputBits>::pre4, decimation_shifts<SdrBits, InputBits>::post4);
+        return;
+    }
+
     StorageType buf2[8], buf4[4];
 
     for (int pos = 0; pos < len - 15; pos += 16)
@@ -2479,6 +2651,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate4_
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate8_cen(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+	if (m_blockMode)
+	{
+		decimateBlock(it, buf, len, "CCC", false, decimation_shifts<SdrBits, InputBits>::pre8, decimation_shifts<SdrBits, InputBits>::post8);
+		return;
+	}
+
 	StorageType intbuf[8];
 
 	for (int pos = 0; pos < len - 15; pos += 16)
@@ -2539,6 +2717,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate8_
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate16_cen(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+	if (m_blockMode)
+	{
+		decimateBlock(it, buf, len, "CCCC", false, decimation_shifts<SdrBits, InputBits>::pre16, decimation_shifts<SdrBits, InputBits>::post16);
+		return;
+	}
+
 	StorageType intbuf[16];
 
 	for (int pos = 0; pos < len - 31; pos += 32)
@@ -2648,6 +2832,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate16
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate32_cen(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+	if (m_blockMode)
+	{
+		decimateBlock(it, buf, len, "CCCCC", false, decimation_shifts<SdrBits, InputBits>::pre32, decimation_shifts<SdrBits, InputBits>::post32);
+		return;
+	}
+
 	StorageType intbuf[32];
 
 	for (int pos = 0; pos < len - 63; pos += 64)
@@ -2854,6 +3044,12 @@ void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate32
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift, bool IQOrder>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift, IQOrder>::decimate64_cen(SampleVector::iterator* it, const T* buf, qint32 len)
 {
+	if (m_blockMode)
+	{
+		decimateBlock(it, buf, len, "CCCCCC", false, decimation_shifts<SdrBits, InputBits>::pre64, decimation_shifts<SdrBits, InputBits>::post64);
+		return;
+	}
+
 	StorageType intbuf[64];
 
 	for (int pos = 0; pos < len - 127; pos += 128)
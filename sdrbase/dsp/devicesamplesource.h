@@ -23,6 +23,7 @@
 #include <QByteArray>
 
 #include "samplesinkfifo.h"
+#include "samplesinkfifof.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 #include "export.h"
@@ -133,6 +134,12 @@ public:
 	virtual void setMessageQueueToGUI(MessageQueue *queue) = 0; // pure virtual so that child classes must have to deal with this
 	MessageQueue *getMessageQueueToGUI() { return m_guiMessageQueue; }
     SampleSinkFifo* getSampleFifo() { return &m_sampleFifo; }
+    SampleSinkFifoF* getSampleFifoF() { return &m_sampleFifoF; } //!< float pipeline FIFO
+    /**
+     * True if the source writes its float samples to the float FIFO rather than converting them to the fixed point FIFO.
+     * Read by the engine when acquisition is initialized.
+     */
+    virtual bool getFloatPipeline() const { return false; }
 
     static qint64 calculateDeviceCenterFrequency(
             quint64 centerFrequency,
@@ -166,6 +173,7 @@ protected slots:
 
 protected:
     SampleSinkFifo m_sampleFifo;
+    SampleSinkFifoF m_sampleFifoF;
 	MessageQueue m_inputMessageQueue; //!< Input queue to the source
 	MessageQueue *m_guiMessageQueue;  //!< Input message queue to the GUI
 };
@@ -56,37 +56,73 @@ void DownChannelizer::feed(const SampleVector::const_iterator& begin, const Samp
 	}
 	else
 	{
-		for (SampleVector::const_iterator sample = begin; sample != end; ++sample)
+		// each stage processes the whole block before passing it on to the next stage
+		unsigned int nbSamples = end - begin;
+
+		if (nbSamples == 0) {
+			return;
+		}
+
+		if (m_sampleBuffer.size() < nbSamples/2 + 1) {
+			m_sampleBuffer.resize(nbSamples/2 + 1);
+		}
+
+		const Sample *in = &(*begin);
+
+		for (FilterStages::iterator stage = m_filterStages.begin(); (stage != m_filterStages.end()) && (nbSamples > 0); ++stage)
 		{
-			Sample s(*sample);
-			FilterStages::iterator stage = m_filterStages.begin();
-
-			for (; stage != m_filterStages.end(); ++stage)
-			{
-#ifndef SDR_RX_SAMPLE_24BIT
-                s.m_real /= 2; // avoid saturation on 16 bit samples
-                s.m_imag /= 2;
-#endif
-				if (!(*stage)->work(&s)) {
-					break;
-				}
-			}
+			nbSamples = stage->work(in, nbSamples, m_sampleBuffer.data());
+			in = m_sampleBuffer.data(); // next stages work in place
+		}
 
-			if(stage == m_filterStages.end())
-			{
 #ifdef SDR_RX_SAMPLE_24BIT
-			    s.m_real /= (1<<(m_filterStages.size())); // on 32 bit samples there is enough headroom to just divide the final result
-			    s.m_imag /= (1<<(m_filterStages.size()));
-#endif
-				m_sampleBuffer.push_back(s);
-			}
+		for (unsigned int i = 0; i < nbSamples; i++)
+		{
+			m_sampleBuffer[i].m_real /= (1<<(m_filterStages.size())); // on 32 bit samples there is enough headroom to just divide the final result
+			m_sampleBuffer[i].m_imag /= (1<<(m_filterStages.size()));
 		}
+#endif
 
-		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end());
-		m_sampleBuffer.clear();
+		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.begin() + nbSamples);
 	}
 }
 
+void DownChannelizer::feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end)
+{
+	if (m_sampleSink == 0)
+	{
+		m_sampleBufferF.clear();
+		return;
+	}
+
+	if (m_filterStages.size() == 0)
+	{
+		m_sampleSink->feedF(begin, end);
+		return;
+	}
+
+	unsigned int nbSamples = end - begin;
+
+	if (nbSamples == 0) {
+		return;
+	}
+
+	if (m_sampleBufferF.size() < nbSamples/2 + 1) {
+		m_sampleBufferF.resize(nbSamples/2 + 1);
+	}
+
+	const FSample *in = &(*begin);
+
+	for (FilterStages::iterator stage = m_filterStages.begin(); (stage != m_filterStages.end()) && (nbSamples > 0); ++stage)
+	{
+		nbSamples = stage->work(in, nbSamples, m_sampleBufferF.data());
+		in = m_sampleBufferF.data();
+	}
+
+	// float stages have unity gain: no rescaling at the end of the chain
+	m_sampleSink->feedF(m_sampleBufferF.begin(), m_sampleBufferF.begin() + nbSamples);
+}
+
 void DownChannelizer::setChannelization(int requestedSampleRate, qint64 requestedCenterFrequency)
 {
     if (requestedSampleRate < 0)
@@ -169,54 +205,33 @@ void DownChannelizer::applyDecimation()
 			<< " fc:" << m_channelFrequencyOffset;
 }
 
-#ifdef SDR_RX_SAMPLE_24BIT
 DownChannelizer::FilterStage::FilterStage(Mode mode) :
-    m_filter(new IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>),
     m_workFunction(0),
+    m_workFunctionF(0),
     m_mode(mode),
-    m_sse(true)
-{
-    switch(mode) {
-        case ModeCenter:
-            m_workFunction = &IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::workDecimateCenter;
-            break;
-
-        case ModeLowerHalf:
-            m_workFunction = &IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::workDecimateLowerHalf;
-            break;
-
-        case ModeUpperHalf:
-            m_workFunction = &IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::workDecimateUpperHalf;
-            break;
-    }
-}
+#if !defined(SDR_RX_SAMPLE_24BIT)
+    m_sse(IntHalfbandFilterBKIntrinsics<DOWNCHANNELIZER_HB_FILTER_ORDER>::isAccelerated()) // 32 bit filter taps use the SIMD kernel
 #else
-DownChannelizer::FilterStage::FilterStage(Mode mode) :
-    m_filter(new IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>),
-    m_workFunction(0),
-    m_mode(mode),
-    m_sse(true)
+    m_sse(false)
+#endif
 {
     switch(mode) {
         case ModeCenter:
-            m_workFunction = &IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::workDecimateCenter;
+            m_workFunction = &Filter::workDecimateCenter;
+            m_workFunctionF = &FilterF::workDecimateCenter;
             break;
 
         case ModeLowerHalf:
-            m_workFunction = &IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::workDecimateLowerHalf;
+            m_workFunction = &Filter::workDecimateLowerHalf;
+            m_workFunctionF = &FilterF::workDecimateLowerHalf;
             break;
 
         case ModeUpperHalf:
-            m_workFunction = &IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::workDecimateUpperHalf;
+            m_workFunction = &Filter::workDecimateUpperHalf;
+            m_workFunctionF = &FilterF::workDecimateUpperHalf;
             break;
     }
 }
-#endif
-
-DownChannelizer::FilterStage::~FilterStage()
-{
-	delete m_filter;
-}
 
 bool DownChannelizer::signalContainsChannel(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd) const
 {
@@ -239,7 +254,7 @@ Real DownChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanSta
 	if(signalContainsChannel(sigStart, sigStart + sigBw / 2.0, chanStart, chanEnd))
     {
 		//qDebug("DownChannelizer::createFilterChain: -> take left half (rotate by +1/4 and decimate by 2)");
-		m_filterStages.push_back(new FilterStage(FilterStage::ModeLowerHalf));
+		m_filterStages.emplace_back(FilterStage::ModeLowerHalf);
 		return createFilterChain(sigStart, sigStart + sigBw / 2.0, chanStart, chanEnd);
 	}
 
@@ -247,7 +262,7 @@ Real DownChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanSta
 	if(signalContainsChannel(sigEnd - sigBw / 2.0f, sigEnd, chanStart, chanEnd))
     {
 		//qDebug("DownChannelizer::createFilterChain: -> take right half (rotate by -1/4 and decimate by 2)");
-		m_filterStages.push_back(new FilterStage(FilterStage::ModeUpperHalf));
+		m_filterStages.emplace_back(FilterStage::ModeUpperHalf);
 		return createFilterChain(sigEnd - sigBw / 2.0f, sigEnd, chanStart, chanEnd);
 	}
 
@@ -255,7 +270,7 @@ Real DownChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanSta
 	if(signalContainsChannel(sigStart + rot, sigEnd - rot, chanStart, chanEnd))
     {
 		//qDebug("DownChannelizer::createFilterChain: -> take center half (decimate by 2)");
-		m_filterStages.push_back(new FilterStage(FilterStage::ModeCenter));
+		m_filterStages.emplace_back(FilterStage::ModeCenter);
 		return createFilterChain(sigStart + rot, sigEnd - rot, chanStart, chanEnd);
 	}
 
@@ -277,18 +292,18 @@ double DownChannelizer::setFilterChain(const std::vector<unsigned int>& stageInd
     {
         if (*rit == 0)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeLowerHalf));
+            m_filterStages.emplace_back(FilterStage::ModeLowerHalf);
             ofs -= ofs_stage;
             qDebug("DownChannelizer::setFilterChain: lower half: ofs: %f", ofs);
         }
         else if (*rit == 1)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeCenter));
+            m_filterStages.emplace_back(FilterStage::ModeCenter);
             qDebug("DownChannelizer::setFilterChain: center: ofs: %f", ofs);
         }
         else if (*rit == 2)
         {
-            m_filterStages.push_back(new FilterStage(FilterStage::ModeUpperHalf));
+            m_filterStages.emplace_back(FilterStage::ModeUpperHalf);
             ofs += ofs_stage;
             qDebug("DownChannelizer::setFilterChain: upper half: ofs: %f", ofs);
         }
@@ -299,8 +314,6 @@ double DownChannelizer::setFilterChain(const std::vector<unsigned int>& stageInd
 
 void DownChannelizer::freeFilterChain()
 {
-	for(FilterStages::iterator it = m_filterStages.begin(); it != m_filterStages.end(); ++it)
-		delete *it;
 	m_filterStages.clear();
 }
 
@@ -310,19 +323,19 @@ void DownChannelizer::debugFilterChain()
 
     for(FilterStages::iterator it = m_filterStages.begin(); it != m_filterStages.end(); ++it)
     {
-        switch ((*it)->m_mode)
+        switch (it->m_mode)
         {
         case FilterStage::ModeCenter:
-            qDebug("DownChannelizer::debugFilterChain: center %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: center %s", it->m_sse ? "sse" : "no_sse");
             break;
         case FilterStage::ModeLowerHalf:
-            qDebug("DownChannelizer::debugFilterChain: lower %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: lower %s", it->m_sse ? "sse" : "no_sse");
             break;
         case FilterStage::ModeUpperHalf:
-            qDebug("DownChannelizer::debugFilterChain: upper %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: upper %s", it->m_sse ? "sse" : "no_sse");
             break;
         default:
-            qDebug("DownChannelizer::debugFilterChain: none %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: none %s", it->m_sse ? "sse" : "no_sse");
             break;
         }
     }
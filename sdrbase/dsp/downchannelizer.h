@@ -19,12 +19,12 @@
 #ifndef SDRBASE_DSP_DOWNCHANNELIZER_H
 #define SDRBASE_DSP_DOWNCHANNELIZER_H
 
-#include <list>
 #include <vector>
 
 #include "export.h"
 #include "util/message.h"
-#include "dsp/inthalfbandfiltereo.h"
+#include "dsp/inthalfbandfilterbk.h"
+#include "dsp/inthalfbandfilterbkf.h"
 
 #include "channelsamplesink.h"
 
@@ -36,6 +36,7 @@ public:
 	virtual ~DownChannelizer();
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+	virtual void feedF(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end); //!< float pipeline: same filter chain in float passed to the sink feedF()
 
     void setDecimation(unsigned int log2Decim, unsigned int filterChainHash);         //!< Define channelizer with decimation factor and filter chain definition
     void setChannelization(int requestedSampleRate, qint64 requestedCenterFrequency); //!< Define channelizer with requested sample rate and center frequency (shift in the baseband)
@@ -53,26 +54,33 @@ protected:
 		};
 
 #ifdef SDR_RX_SAMPLE_24BIT
-        typedef bool (IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::*WorkFunction)(Sample* s);
-        IntHalfbandFilterEO<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, true>* m_filter;
+        typedef IntHalfbandFilterBK<qint64, qint64, DOWNCHANNELIZER_HB_FILTER_ORDER, false> Filter;
 #else
-        typedef bool (IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>::*WorkFunction)(Sample* s);
-        IntHalfbandFilterEO<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true>* m_filter;
+        typedef IntHalfbandFilterBK<qint32, qint32, DOWNCHANNELIZER_HB_FILTER_ORDER, true> Filter; // halve input to avoid saturation on 16 bit samples
 #endif
+        typedef unsigned int (Filter::*WorkFunction)(const Sample *in, unsigned int nbIn, Sample *out);
+        typedef IntHalfbandFilterBKF<DOWNCHANNELIZER_HB_FILTER_ORDER> FilterF;
+        typedef unsigned int (FilterF::*WorkFunctionF)(const FSample *in, unsigned int nbIn, FSample *out);
+        Filter m_filter;                  //!< held by value so that the stages state is contiguous
+        FilterF m_filterF;                //!< float pipeline filter. Buffers are allocated on first use.
 
 		WorkFunction m_workFunction;
+		WorkFunctionF m_workFunctionF;
 		Mode m_mode;
 		bool m_sse;
 
 		FilterStage(Mode mode);
-		~FilterStage();
 
-		bool work(Sample* sample)
+		unsigned int work(const Sample *in, unsigned int nbIn, Sample *out) //!< decimate a block of samples. Returns the number of output samples. out may be in.
 		{
-			return (m_filter->*m_workFunction)(sample);
+			return (m_filter.*m_workFunction)(in, nbIn, out);
+		}
+
+		unsigned int work(const FSample *in, unsigned int nbIn, FSample *out) {
+			return (m_filterF.*m_workFunctionF)(in, nbIn, out);
 		}
 	};
-	typedef std::list<FilterStage*> FilterStages;
+	typedef std::vector<FilterStage> FilterStages;
 	FilterStages m_filterStages;
     bool m_filterChainSetMode;
 	ChannelSampleSink* m_sampleSink; //!< Demodulator
@@ -84,6 +92,7 @@ protected:
     unsigned int m_log2Decim;
     unsigned int m_filterChainHash;
 	SampleVector m_sampleBuffer;
+	FSampleVector m_sampleBufferF;
 
 	void applyChannelization();
     void applyDecimation();
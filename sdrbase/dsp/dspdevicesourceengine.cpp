@@ -21,10 +21,13 @@
 #include <dsp/basebandsamplesink.h>
 #include <dsp/devicesamplesource.h>
 #include <stdio.h>
+#include <algorithm>
 #include <QDebug>
 #include "dsp/dspcommands.h"
+#include "dsp/fsampleconverter.h"
 #include "util/fixed.h"
 #include "samplesinkfifo.h"
+#include "samplefifostats.h"
 
 DSPDeviceSourceEngine::DSPDeviceSourceEngine(uint uid, QObject* parent) :
 	QThread(parent),
@@ -33,6 +36,9 @@ DSPDeviceSourceEngine::DSPDeviceSourceEngine(uint uid, QObject* parent) :
 	m_deviceSampleSource(nullptr),
 	m_sampleSourceSequence(0),
 	m_basebandSampleSinks(),
+	m_feedSampleSinks(),
+	m_floatPipeline(false),
+	m_downstreamLoad(0),
 	m_sampleRate(0),
 	m_centerFrequency(0),
 	m_dcOffsetCorrection(false),
@@ -246,6 +252,44 @@ void DSPDeviceSourceEngine::iqCorrections(SampleVector::iterator begin, SampleVe
     }
 }
 
+void DSPDeviceSourceEngine::iqCorrectionsF(FSampleVector::iterator begin, FSampleVector::iterator end, bool imbalanceCorrection)
+{
+    // floating point algorithm of iqCorrections() on normalized samples
+    for (FSampleVector::iterator it = begin; it < end; ++it)
+    {
+        m_iBetaF(it->m_real);
+        m_qBetaF(it->m_imag);
+        float xi = it->m_real - (float) m_iBetaF;
+        float xq = it->m_imag - (float) m_qBetaF;
+
+        if (imbalanceCorrection)
+        {
+            // phase imbalance
+            m_avgIIF(xi*xi); // <I", I">
+            m_avgIQF(xi*xq); // <I", Q">
+
+            if (m_avgIIF.asDouble() != 0) {
+                m_avgPhiF(m_avgIQF.asDouble()/m_avgIIF.asDouble());
+            }
+
+            float yq = xq - m_avgPhiF.asDouble()*xi;
+
+            // amplitude I/Q imbalance
+            m_avgII2F(xi*xi); // <I, I>
+            m_avgQQ2F(yq*yq); // <Q, Q>
+
+            if (m_avgQQ2F.asDouble() != 0) {
+                m_avgAmpF(sqrt(m_avgII2F.asDouble() / m_avgQQ2F.asDouble()));
+            }
+
+            xq = m_avgAmpF.asDouble() * yq;
+        }
+
+        it->m_real = xi;
+        it->m_imag = xq;
+    }
+}
+
 void DSPDeviceSourceEngine::dcOffset(SampleVector::iterator begin, SampleVector::iterator end)
 {
 	// sum and correct in one pass
@@ -331,8 +375,11 @@ void DSPDeviceSourceEngine::work()
                 iqCorrections(part1begin, part1end, m_iqImbalanceCorrection);
             }
 
+			// write data once for sinks reading the shared FIFO
+			m_sharedFifo.write(part1begin, part1end);
+
 			// feed data to direct sinks
-			for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
+			for (BasebandSampleSinks::const_iterator it = m_feedSampleSinks.begin(); it != m_feedSampleSinks.end(); ++it)
 			{
 				(*it)->feed(part1begin, part1end, positiveOnly);
 			}
@@ -348,8 +395,11 @@ void DSPDeviceSourceEngine::work()
                 iqCorrections(part2begin, part2end, m_iqImbalanceCorrection);
             }
 
+			// write data once for sinks reading the shared FIFO
+			m_sharedFifo.write(part2begin, part2end);
+
 			// feed data to direct sinks
-			for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++)
+			for (BasebandSampleSinks::const_iterator it = m_feedSampleSinks.begin(); it != m_feedSampleSinks.end(); it++)
 			{
 				(*it)->feed(part2begin, part2end, positiveOnly);
 			}
@@ -360,6 +410,148 @@ void DSPDeviceSourceEngine::work()
 		sampleFifo->readCommit((unsigned int) count);
 		samplesDone += count;
 	}
+
+	updateDownstreamLoad();
+}
+
+void DSPDeviceSourceEngine::workF()
+{
+	SampleSinkFifoF* sampleFifo = m_deviceSampleSource->getSampleFifoF();
+	std::size_t samplesDone = 0;
+
+	while ((sampleFifo->fill() > 0) && (m_inputMessageQueue.size() == 0) && (samplesDone < m_sampleRate))
+	{
+		FSampleVector::iterator part1begin;
+		FSampleVector::iterator part1end;
+		FSampleVector::iterator part2begin;
+		FSampleVector::iterator part2end;
+
+		std::size_t count = sampleFifo->readBegin(sampleFifo->fill(), &part1begin, &part1end, &part2begin, &part2end);
+
+		if (part1begin != part1end) {
+			feedF(part1begin, part1end);
+		}
+
+		if (part2begin != part2end) { // block wraps around
+			feedF(part2begin, part2end);
+		}
+
+		sampleFifo->readCommit((unsigned int) count);
+		samplesDone += count;
+	}
+
+	updateDownstreamLoad();
+}
+
+void DSPDeviceSourceEngine::updateDownstreamLoad()
+{
+	// slowest reader of the shared FIFO and FIFOs of the directly fed channels that report them
+	unsigned int load = m_sharedFifo.size() == 0 ? 0 : (1000ULL * m_sharedFifo.maxFill()) / m_sharedFifo.size();
+	SampleFifoStats stats;
+
+	for (BasebandSampleSinks::const_iterator it = m_feedSampleSinks.begin(); it != m_feedSampleSinks.end(); ++it)
+	{
+		if ((*it)->getFifoStats(stats) && (stats.m_size != 0)) {
+			load = std::max(load, (unsigned int) ((1000ULL * stats.m_fill) / stats.m_size));
+		}
+	}
+
+	m_downstreamLoad.storeRelease(load);
+}
+
+void DSPDeviceSourceEngine::feedF(FSampleVector::iterator begin, FSampleVector::iterator end)
+{
+	bool positiveOnly = false;
+
+	if (m_dcOffsetCorrection) {
+		iqCorrectionsF(begin, end, m_iqImbalanceCorrection);
+	}
+
+	// convert once for the shared FIFO readers and the fixed point direct sinks
+	bool converted = false;
+
+	if (m_sharedFifo.getNbReaders() != 0)
+	{
+		FSampleConverter::toSample(begin, end, m_convertedSamples);
+		converted = true;
+		m_sharedFifo.write(m_convertedSamples.begin(), m_convertedSamples.end());
+	}
+
+	for (BasebandSampleSinks::const_iterator it = m_feedSampleSinks.begin(); it != m_feedSampleSinks.end(); ++it)
+	{
+		if ((*it)->isFloatNative())
+		{
+			(*it)->feedF(begin, end, positiveOnly);
+		}
+		else
+		{
+			if (!converted)
+			{
+				FSampleConverter::toSample(begin, end, m_convertedSamples);
+				converted = true;
+			}
+
+			(*it)->feed(m_convertedSamples.begin(), m_convertedSamples.end(), positiveOnly);
+		}
+	}
+}
+
+void DSPDeviceSourceEngine::attachSink(BasebandSampleSink* sink)
+{
+	// float native sinks take the float samples directly rather than converted ones from the shared FIFO
+	if (m_floatPipeline && sink->isFloatNative())
+	{
+		sink->setSharedFifo(nullptr);
+		m_feedSampleSinks.push_back(sink);
+	}
+	else if (!sink->setSharedFifo(&m_sharedFifo))
+	{
+		m_feedSampleSinks.push_back(sink);
+	}
+}
+
+void DSPDeviceSourceEngine::attachSinks()
+{
+	m_feedSampleSinks.clear();
+
+	for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it) {
+		attachSink(*it);
+	}
+}
+
+void DSPDeviceSourceEngine::resizeSharedFifo()
+{
+	unsigned int size = SampleSinkFifo::getSizePolicy(m_sampleRate);
+
+	if (size == m_sharedFifo.size()) {
+		return;
+	}
+
+	// shared FIFO readers must be stopped while the buffer is reallocated
+	bool running = (m_state == StRunning) && (m_sharedFifo.getNbReaders() != 0);
+
+	if (running)
+	{
+		for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
+		{
+			if (std::find(m_feedSampleSinks.begin(), m_feedSampleSinks.end(), *it) == m_feedSampleSinks.end()) {
+				(*it)->stop();
+			}
+		}
+	}
+
+	qDebug("DSPDeviceSourceEngine::resizeSharedFifo: %u samples", size);
+	m_sharedFifo.setSize(size);
+
+	if (running)
+	{
+		for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
+		{
+			if (std::find(m_feedSampleSinks.begin(), m_feedSampleSinks.end(), *it) == m_feedSampleSinks.end()) {
+				(*it)->start();
+			}
+		}
+	}
 }
 
 // notStarted -> idle -> init -> running -+
@@ -398,6 +590,7 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoIdle()
 
 	m_deviceDescription.clear();
 	m_sampleRate = 0;
+	m_downstreamLoad.storeRelease(0);
 
 	return StIdle;
 }
@@ -440,6 +633,15 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoInit()
 			<< " sampleRate: " << m_sampleRate
 			<< " centerFrequency: " << m_centerFrequency;
 
+	resizeSharedFifo(); // sinks are not running at this point
+
+	if (m_floatPipeline != m_deviceSampleSource->getFloatPipeline())
+	{
+		m_floatPipeline = m_deviceSampleSource->getFloatPipeline();
+		qDebug("DSPDeviceSourceEngine::gotoInit: float pipeline: %s", m_floatPipeline ? "on" : "off");
+		attachSinks();
+	}
+
 	DSPSignalNotification notif(m_sampleRate, m_centerFrequency);
 
 	for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
@@ -527,6 +729,7 @@ void DSPDeviceSourceEngine::handleSetSource(DeviceSampleSource* source)
 	{
 		qDebug("DSPDeviceSourceEngine::handleSetSource: set %s", qPrintable(source->getDeviceDescription()));
 		connect(m_deviceSampleSource->getSampleFifo(), SIGNAL(dataReady()), this, SLOT(handleData()), Qt::QueuedConnection);
+		connect(m_deviceSampleSource->getSampleFifoF(), SIGNAL(dataReady()), this, SLOT(handleData()), Qt::QueuedConnection);
 	}
 	else
 	{
@@ -539,6 +742,7 @@ void DSPDeviceSourceEngine::handleData()
 	if(m_state == StRunning)
 	{
 		work();
+		workF();
 	}
 }
 
@@ -580,6 +784,8 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 	{
 		BasebandSampleSink* sink = ((DSPAddBasebandSampleSink*) message)->getSampleSink();
 		m_basebandSampleSinks.push_back(sink);
+		attachSink(sink);
+
         // initialize sample rate and center frequency in the sink:
         DSPSignalNotification msg(m_sampleRate, m_centerFrequency);
         sink->handleMessage(msg);
@@ -597,6 +803,8 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 		}
 
 		m_basebandSampleSinks.remove(sink);
+		m_feedSampleSinks.remove(sink);
+		sink->setSharedFifo(nullptr);
 	}
 
 	m_syncMessenger.done(m_state);
@@ -638,6 +846,14 @@ void DSPDeviceSourceEngine::handleInputMessages()
 			m_avgQQ2.reset();
 			m_iBeta.reset();
 			m_qBeta.reset();
+			m_avgAmpF.reset();
+			m_avgIIF.reset();
+			m_avgII2F.reset();
+			m_avgIQF.reset();
+			m_avgPhiF.reset();
+			m_avgQQ2F.reset();
+			m_iBetaF.reset();
+			m_qBetaF.reset();
 
 			delete message;
 		}
@@ -662,6 +878,8 @@ void DSPDeviceSourceEngine::handleInputMessages()
 				(*it)->handleMessage(*message);
 			}
 
+			resizeSharedFifo();
+
 			// forward changes to source GUI input queue
 
 			MessageQueue *guiMessageQueue = m_deviceSampleSource->getMessageQueueToGUI();
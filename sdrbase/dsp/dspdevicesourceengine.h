@@ -23,8 +23,10 @@
 #include <QTimer>
 #include <QMutex>
 #include <QWaitCondition>
+#include <QAtomicInt>
 #include "dsp/dsptypes.h"
 #include "dsp/fftwindow.h"
+#include "dsp/samplesinksharedfifo.h"
 #include "util/messagequeue.h"
 #include "util/syncmessenger.h"
 #include "export.h"
@@ -69,6 +71,7 @@ public:
 	void configureCorrections(bool dcOffsetCorrection, bool iqImbalanceCorrection); //!< Configure DSP corrections
 
 	State state() const { return m_state; } //!< Return DSP engine current state
+	int getDownstreamLoad() const { return m_downstreamLoad.loadAcquire(); } //!< Highest fill in per mille of the channel FIFOs fed by the engine. Can be read from any thread.
 
 	QString errorMessage(); //!< Return the current error message
 	QString sourceDeviceDescription(); //!< Return the source device description
@@ -89,6 +92,11 @@ private:
 
 	typedef std::list<BasebandSampleSink*> BasebandSampleSinks;
 	BasebandSampleSinks m_basebandSampleSinks; //!< sample sinks within main thread (usually spectrum, file output)
+	BasebandSampleSinks m_feedSampleSinks;     //!< subset of the above fed with a copy of the samples
+	SampleSinkSharedFifo m_sharedFifo;         //!< written once and read by the other sinks of the above
+	bool m_floatPipeline;                      //!< the source delivers float samples: float native sinks are fed directly with them
+	SampleVector m_convertedSamples;           //!< float samples converted for the fixed point sinks
+	QAtomicInt m_downstreamLoad;               //!< see getDownstreamLoad()
 
 	uint m_sampleRate;
 	quint64 m_centerFrequency;
@@ -119,6 +127,16 @@ private:
     MovingAverageUtil<double, double, 128> m_avgAmp;
 #endif
 
+    // Float pipeline DC + IQ corrections
+    MovingAverageUtil<float, double, 1024> m_iBetaF;
+    MovingAverageUtil<float, double, 1024> m_qBetaF;
+    MovingAverageUtil<float, double, 128> m_avgIIF;
+    MovingAverageUtil<float, double, 128> m_avgIQF;
+    MovingAverageUtil<float, double, 128> m_avgII2F;
+    MovingAverageUtil<float, double, 128> m_avgQQ2F;
+    MovingAverageUtil<double, double, 128> m_avgPhiF;
+    MovingAverageUtil<double, double, 128> m_avgAmpF;
+
     qint32 m_iRange;
 	qint32 m_qRange;
 	qint32 m_imbalance;
@@ -126,9 +144,16 @@ private:
 	void run();
 
 	void iqCorrections(SampleVector::iterator begin, SampleVector::iterator end, bool imbalanceCorrection);
+	void iqCorrectionsF(FSampleVector::iterator begin, FSampleVector::iterator end, bool imbalanceCorrection);
 	void dcOffset(SampleVector::iterator begin, SampleVector::iterator end);
 	void imbalance(SampleVector::iterator begin, SampleVector::iterator end);
 	void work(); //!< transfer samples from source to sinks if in running state
+	void workF(); //!< same from the float FIFO of the source
+	void feedF(FSampleVector::iterator begin, FSampleVector::iterator end);
+	void attachSink(BasebandSampleSink* sink); //!< to the shared FIFO or to the directly fed sinks
+	void attachSinks(); //!< re-attach all sinks after the float pipeline mode was changed
+	void resizeSharedFifo(); //!< adapt shared FIFO size to sample rate
+	void updateDownstreamLoad(); //!< after the sinks were fed
 
 	State gotoIdle();     //!< Go to the idle state
 	State gotoInit();     //!< Go to the acquisition init state from idle
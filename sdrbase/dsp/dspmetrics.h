@@ -0,0 +1,41 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_DSPMETRICS_H_
+#define SDRBASE_DSP_DSPMETRICS_H_
+
+#include <QAtomicInt>
+
+#include "export.h"
+
+/**
+ * Global switch of the DSP processing time measurements. Sample FIFO counters are always
+ * updated as they cost one atomic add per block. The time spent by the FIFO readers processing
+ * the samples is only measured when enabled. When disabled only this flag is tested.
+ */
+class SDRBASE_API DSPMetrics
+{
+public:
+    static bool isEnabled() { return m_enabled.loadAcquire() != 0; }
+    static void setEnabled(bool enabled);
+
+private:
+    static QAtomicInt m_enabled;
+};
+
+#endif // SDRBASE_DSP_DSPMETRICS_H_
@@ -96,5 +96,6 @@ struct AudioSample {
 typedef std::vector<Sample> SampleVector;
 typedef std::vector<FSample> FSampleVector;
 typedef std::vector<AudioSample> AudioVector;
+typedef std::vector<Complex> ComplexVector;
 
 #endif // INCLUDE_DSPTYPES_H
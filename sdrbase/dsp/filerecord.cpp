@@ -15,6 +15,9 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <string.h>
+#include <algorithm>
+
 #include <boost/crc.hpp>
 #include <boost/cstdint.hpp>
 
@@ -22,6 +25,7 @@
 #include <QDateTime>
 
 #include "dsp/dspcommands.h"
+#include "dsp/iqcodec.h"
 #include "util/simpleserializer.h"
 #include "util/message.h"
 
@@ -35,7 +39,14 @@ FileRecord::FileRecord() :
 	m_recordOn(false),
     m_recordStart(false),
     m_byteCount(0),
-    m_msShift(0)
+    m_msShift(0),
+    m_directIO(false),
+    m_preallocation(0),
+    m_chunked(false),
+    m_compressed(false),
+    m_compressionBits(0),
+    m_newChunk(false),
+    m_chunkSampleCount(0)
 {
 	setObjectName("FileRecord");
 }
@@ -47,7 +58,15 @@ FileRecord::FileRecord(const QString& fileBase) :
     m_centerFrequency(0),
     m_recordOn(false),
     m_recordStart(false),
-    m_byteCount(0)
+    m_byteCount(0),
+    m_msShift(0),
+    m_directIO(false),
+    m_preallocation(0),
+    m_chunked(false),
+    m_compressed(false),
+    m_compressionBits(0),
+    m_newChunk(false),
+    m_chunkSampleCount(0)
 {
     setObjectName("FileRecord");
 }
@@ -89,7 +108,12 @@ void FileRecord::feed(const SampleVector::const_iterator& begin, const SampleVec
             m_recordStart = false;
         }
 
-        m_sampleFile.write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample));
+        if (m_chunked && !m_compressed) {
+            feedChunked(begin, end);
+        } else {
+            m_writer.write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample));
+        }
+
         m_byteCount += end - begin;
     }
 }
@@ -109,23 +133,29 @@ void FileRecord::startRecording()
         stopRecording();
     }
 
-    if (!m_sampleFile.is_open())
+    if (!m_writer.isOpen())
     {
     	qDebug() << "FileRecord::startRecording";
         m_curentFileName = QString("%1.%2.sdriq").arg(m_fileBase).arg(QDateTime::currentDateTimeUtc().toString("yyyy-MM-ddTHH_mm_ss_zzz"));
-        m_sampleFile.open(m_curentFileName.toStdString().c_str(), std::ios::binary);
-        m_recordOn = true;
-        m_recordStart = true;
+        m_writer.setCompression(m_compressed, sizeof(Sample) / 2, m_compressionBits);
+        m_recordOn = m_writer.open(m_curentFileName, m_directIO, m_preallocation);
+        m_recordStart = m_recordOn;
         m_byteCount = 0;
+        m_index.clear();
     }
 }
 
 void FileRecord::stopRecording()
 {
-    if (m_sampleFile.is_open())
+    if (m_writer.isOpen())
     {
-    	qDebug() << "FileRecord::stopRecording";
-        m_sampleFile.close();
+    	qDebug() << "FileRecord::stopRecording: dropped buffers: " << m_writer.getNbDroppedBuffers();
+
+        if (m_chunked && !m_compressed && !m_recordStart) { // something was recorded
+            writeIndex();
+        }
+
+        m_writer.close();
         m_recordOn = false;
         m_recordStart = false;
     }
@@ -141,8 +171,13 @@ bool FileRecord::handleMessage(const Message& message)
 		qDebug() << "FileRecord::handleMessage: DSPSignalNotification: m_inputSampleRate: " << m_sampleRate
 				<< " m_centerFrequency: " << m_centerFrequency;
 
-        if (m_recordOn) {
-            startRecording();
+        if (m_recordOn)
+        {
+            if (m_chunked && !m_compressed) { // the file stays valid: just start a new chunk
+                m_newChunk = true;
+            } else {
+                startRecording();
+            }
         }
 
         return true;
@@ -161,9 +196,79 @@ void FileRecord::writeHeader()
     std::time_t ts = time(0);
     header.startTimeStamp = ts + (m_msShift / 1000);
     header.sampleSize = SDR_RX_SAMP_SZ;
-    header.filler = 0;
+    header.filler = m_compressed ? m_compressedFormatMarker : m_chunked ? m_chunkedFormatMarker : 0;
+    setHeaderCRC(header);
+
+    m_writer.writeHeader((const char *) &header, sizeof(Header));
+    m_newChunk = true;
+}
+
+void FileRecord::feedChunked(SampleVector::const_iterator begin, const SampleVector::const_iterator& end)
+{
+    quint64 chunkLength = (quint64) std::max(m_sampleRate, 1U) * m_chunkSeconds;
+
+    while (begin < end)
+    {
+        if (m_newChunk || (m_chunkSampleCount >= chunkLength)) {
+            writeChunkHeader();
+        }
+
+        quint64 count = std::min<quint64>(end - begin, chunkLength - m_chunkSampleCount);
+        m_writer.write(reinterpret_cast<const char*>(&*(begin)), count*sizeof(Sample));
+        m_chunkSampleCount += count;
+        begin += count;
+        removeLostChunks();
+    }
+}
+
+void FileRecord::writeChunkHeader()
+{
+    ChunkHeader chunkHeader;
+    chunkHeader.marker = m_chunkMarker;
+    chunkHeader.sampleRate = m_sampleRate;
+    chunkHeader.centerFrequency = m_centerFrequency;
+    chunkHeader.timeStampUs = (QDateTime::currentMSecsSinceEpoch() + m_msShift) * 1000LL;
+    chunkHeader.filler = 0;
+    boost::crc_32_type crc32;
+    crc32.process_bytes(&chunkHeader, sizeof(ChunkHeader) - sizeof(quint32));
+    chunkHeader.crc32 = crc32.checksum();
+
+    IndexEntry entry;
+    entry.offset = m_writer.getPosition();
+    entry.timeStampUs = chunkHeader.timeStampUs;
+    entry.centerFrequency = chunkHeader.centerFrequency;
+    entry.sampleRate = chunkHeader.sampleRate;
+    entry.filler = 0;
+    m_index.push_back(entry);
+
+    m_writer.write((const char *) &chunkHeader, sizeof(ChunkHeader));
+    m_chunkSampleCount = 0;
+    m_newChunk = false;
+}
+
+void FileRecord::removeLostChunks()
+{
+    // a chunk header in a buffer dropped by the writer is not in the file: its samples extend the previous chunk
+    while (!m_index.empty() && (m_index.back().offset + sizeof(ChunkHeader) > m_writer.getPosition())) {
+        m_index.pop_back();
+    }
+}
+
+void FileRecord::writeIndex()
+{
+    IndexTrailer trailer;
+    trailer.indexOffset = m_writer.getPosition();
+    trailer.nbEntries = m_index.size();
+    trailer.marker = m_indexMarker;
+    trailer.filler = 0;
+    boost::crc_32_type crc32;
+    crc32.process_bytes(m_index.data(), m_index.size() * sizeof(IndexEntry));
+    crc32.process_bytes(&trailer, sizeof(IndexTrailer) - sizeof(quint32));
+    trailer.crc32 = crc32.checksum();
 
-    writeHeader(m_sampleFile, header);
+    m_writer.write((const char *) m_index.data(), m_index.size() * sizeof(IndexEntry));
+    m_writer.write((const char *) &trailer, sizeof(IndexTrailer));
+    qDebug("FileRecord::writeIndex: %u chunks", trailer.nbEntries);
 }
 
 bool FileRecord::readHeader(std::ifstream& sampleFile, Header& header)
@@ -175,9 +280,230 @@ bool FileRecord::readHeader(std::ifstream& sampleFile, Header& header)
 }
 
 void FileRecord::writeHeader(std::ofstream& sampleFile, Header& header)
+{
+    setHeaderCRC(header);
+    sampleFile.write((const char *) &header, sizeof(Header));
+}
+
+void FileRecord::setHeaderCRC(Header& header)
 {
     boost::crc_32_type crc32;
     crc32.process_bytes(&header, 28);
     header.crc32 = crc32.checksum();
-    sampleFile.write((const char *) &header, sizeof(Header));
+}
+
+bool FileRecord::readChunkIndex(std::ifstream& sampleFile, quint64 fileSize, const Header& header, ChunkIndex& index)
+{
+    quint64 sampleBytes = header.sampleSize == 24 ? 8 : 4;
+    std::vector<IndexEntry> entries;
+    quint64 dataEnd = fileSize;
+    index.clear();
+
+    if (isCompressed(header))
+    {
+        readCompressedBlocks(sampleFile, fileSize, header, index);
+        sampleFile.clear();
+        return index.size() > 0;
+    }
+    else if (!isChunked(header))
+    {
+        IndexEntry entry;
+        entry.offset = sizeof(Header) - sizeof(ChunkHeader); // no chunk header: samples follow the file header
+        entry.timeStampUs = header.startTimeStamp * 1000000ULL;
+        entry.centerFrequency = header.centerFrequency;
+        entry.sampleRate = header.sampleRate;
+        entries.push_back(entry);
+    }
+    else if (readIndexEntries(sampleFile, fileSize, entries))
+    {
+        dataEnd = entries.size() == 0 ? fileSize : fileSize - sizeof(IndexTrailer) - entries.size() * sizeof(IndexEntry);
+    }
+    else
+    {
+        qWarning("FileRecord::readChunkIndex: no valid index: scan the chunks");
+        entries.clear();
+        scanChunkHeaders(sampleFile, fileSize, entries);
+    }
+
+    quint64 sampleIndex = 0;
+
+    for (unsigned int i = 0; i < entries.size(); i++)
+    {
+        Chunk chunk;
+        chunk.dataOffset = entries[i].offset + sizeof(ChunkHeader);
+        quint64 chunkEnd = i + 1 < entries.size() ? entries[i+1].offset : dataEnd;
+
+        if ((chunkEnd <= chunk.dataOffset) || (entries[i].sampleRate == 0)) { // empty or corrupted
+            continue;
+        }
+
+        chunk.sampleIndex = sampleIndex;
+        chunk.nbSamples = (chunkEnd - chunk.dataOffset) / sampleBytes;
+        chunk.timeStampUs = entries[i].timeStampUs;
+        chunk.centerFrequency = entries[i].centerFrequency;
+        chunk.sampleRate = entries[i].sampleRate;
+        index.push_back(chunk);
+        sampleIndex += chunk.nbSamples;
+    }
+
+    sampleFile.clear();
+    return sampleIndex > 0;
+}
+
+bool FileRecord::readIndexEntries(std::ifstream& sampleFile, quint64 fileSize, std::vector<IndexEntry>& entries)
+{
+    IndexTrailer trailer;
+
+    if (fileSize < sizeof(Header) + sizeof(IndexTrailer)) {
+        return false;
+    }
+
+    sampleFile.clear();
+    sampleFile.seekg(fileSize - sizeof(IndexTrailer), std::ios::beg);
+    sampleFile.read((char *) &trailer, sizeof(IndexTrailer));
+
+    if (!sampleFile
+     || (trailer.marker != m_indexMarker)
+     || (trailer.indexOffset + (quint64) trailer.nbEntries * sizeof(IndexEntry) + sizeof(IndexTrailer) != fileSize)) {
+        return false;
+    }
+
+    entries.resize(trailer.nbEntries);
+    sampleFile.seekg(trailer.indexOffset, std::ios::beg);
+    sampleFile.read((char *) entries.data(), entries.size() * sizeof(IndexEntry));
+    boost::crc_32_type crc32;
+    crc32.process_bytes(entries.data(), entries.size() * sizeof(IndexEntry));
+    crc32.process_bytes(&trailer, sizeof(IndexTrailer) - sizeof(quint32));
+
+    return sampleFile && (trailer.crc32 == crc32.checksum());
+}
+
+void FileRecord::scanChunkHeaders(std::ifstream& sampleFile, quint64 fileSize, std::vector<IndexEntry>& entries)
+{
+    // chunk headers are on 4 bytes boundaries. Blocks overlap so that a header across two blocks is found.
+    const quint64 blockSize = 1<<20;
+    std::vector<char> block(blockSize + sizeof(ChunkHeader));
+    quint64 blockOffset = sizeof(Header);
+    sampleFile.clear();
+
+    while (blockOffset + sizeof(ChunkHeader) <= fileSize)
+    {
+        quint64 size = std::min<quint64>(block.size(), fileSize - blockOffset);
+        sampleFile.seekg(blockOffset, std::ios::beg);
+        sampleFile.read(block.data(), size);
+
+        if (!sampleFile) {
+            break;
+        }
+
+        for (quint64 i = 0; (i < blockSize) && (i + sizeof(ChunkHeader) <= size); i += 4)
+        {
+            ChunkHeader chunkHeader;
+            memcpy(&chunkHeader, &block[i], sizeof(ChunkHeader));
+
+            if (chunkHeader.marker != m_chunkMarker) {
+                continue;
+            }
+
+            boost::crc_32_type crc32;
+            crc32.process_bytes(&chunkHeader, sizeof(ChunkHeader) - sizeof(quint32));
+
+            if (chunkHeader.crc32 != crc32.checksum()) {
+                continue;
+            }
+
+            IndexEntry entry;
+            entry.offset = blockOffset + i;
+            entry.timeStampUs = chunkHeader.timeStampUs;
+            entry.centerFrequency = chunkHeader.centerFrequency;
+            entry.sampleRate = chunkHeader.sampleRate;
+            entry.filler = 0;
+            entries.push_back(entry);
+            i += sizeof(ChunkHeader) - 4;
+        }
+
+        blockOffset += blockSize;
+    }
+
+    qDebug("FileRecord::scanChunkHeaders: %u chunks found", (unsigned int) entries.size());
+}
+
+void FileRecord::readCompressedBlocks(std::ifstream& sampleFile, quint64 fileSize, const Header& header, ChunkIndex& index)
+{
+    // hop from block header to block header
+    quint64 offset = sizeof(Header);
+    quint64 sampleIndex = 0;
+    sampleFile.clear();
+
+    if (header.sampleRate == 0) {
+        return;
+    }
+
+    while (offset + sizeof(IQCodec::BlockHeader) <= fileSize)
+    {
+        IQCodec::BlockHeader blockHeader;
+        sampleFile.seekg(offset, std::ios::beg);
+        sampleFile.read((char *) &blockHeader, sizeof(IQCodec::BlockHeader));
+
+        if (!sampleFile
+         || (blockHeader.marker != IQCodec::m_blockMarker)
+         || (offset + sizeof(IQCodec::BlockHeader) + blockHeader.nbBytes > fileSize)) // ex: interrupted recording
+        {
+            qWarning("FileRecord::readCompressedBlocks: invalid or truncated block at %llu: ignore the rest", offset);
+            break;
+        }
+
+        if (blockHeader.nbSamples > 0)
+        {
+            Chunk chunk;
+            chunk.dataOffset = offset;
+            chunk.sampleIndex = sampleIndex;
+            chunk.nbSamples = blockHeader.nbSamples;
+            chunk.timeStampUs = header.startTimeStamp * 1000000ULL + (sampleIndex * 1000000ULL) / header.sampleRate;
+            chunk.centerFrequency = header.centerFrequency;
+            chunk.sampleRate = header.sampleRate;
+            index.push_back(chunk);
+            sampleIndex += blockHeader.nbSamples;
+        }
+
+        offset += sizeof(IQCodec::BlockHeader) + blockHeader.nbBytes;
+    }
+
+    qDebug("FileRecord::readCompressedBlocks: %u blocks %llu samples", (unsigned int) index.size(), sampleIndex);
+}
+
+int FileRecord::findChunkBySample(const ChunkIndex& index, quint64 sampleIndex)
+{
+    ChunkIndex::const_iterator it = std::upper_bound(index.begin(), index.end(), sampleIndex,
+        [](quint64 s, const Chunk& chunk) { return s < chunk.sampleIndex; });
+    return it == index.begin() ? 0 : (it - index.begin()) - 1;
+}
+
+int FileRecord::findChunkByTimeStamp(const ChunkIndex& index, quint64 timeStampUs)
+{
+    ChunkIndex::const_iterator it = std::upper_bound(index.begin(), index.end(), timeStampUs,
+        [](quint64 t, const Chunk& chunk) { return t < chunk.timeStampUs; });
+    return it == index.begin() ? 0 : (it - index.begin()) - 1;
+}
+
+quint64 FileRecord::getSampleIndex(const ChunkIndex& index, quint64 timeStampUs)
+{
+    if (index.size() == 0) {
+        return 0;
+    }
+
+    const Chunk& chunk = index[findChunkByTimeStamp(index, timeStampUs)];
+    quint64 offsetUs = timeStampUs > chunk.timeStampUs ? timeStampUs - chunk.timeStampUs : 0;
+    return chunk.sampleIndex + std::min<quint64>((offsetUs * chunk.sampleRate) / 1000000ULL, chunk.nbSamples);
+}
+
+quint64 FileRecord::getRecordLengthMuSec(const ChunkIndex& index)
+{
+    quint64 lengthMuSec = 0;
+
+    for (ChunkIndex::const_iterator it = index.begin(); it != index.end(); ++it) {
+        lengthMuSec += (it->nbSamples * 1000000ULL) / it->sampleRate;
+    }
+
+    return lengthMuSec;
 }
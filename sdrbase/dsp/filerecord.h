@@ -23,8 +23,10 @@
 #include <iostream>
 #include <fstream>
 #include <ctime>
+#include <vector>
 
 #include "dsp/filerecordinterface.h"
+#include "dsp/filerecordwriter.h"
 #include "export.h"
 
 class Message;
@@ -39,11 +41,63 @@ public:
         quint64 centerFrequency;
         quint64 startTimeStamp;
         quint32 sampleSize;
+        quint32 filler;          //!< m_chunkedFormatMarker or m_compressedFormatMarker else 0
+        quint32 crc32;
+    };
+
+    // Chunked format: the header is followed by chunks made of a ChunkHeader and the samples.
+    // A new chunk starts periodically and at each sample rate or center frequency change.
+    // The file ends with an index of the chunks followed by an IndexTrailer.
+
+    struct ChunkHeader
+    {
+        quint32 marker;          //!< m_chunkMarker
+        quint32 sampleRate;
+        quint64 centerFrequency;
+        quint64 timeStampUs;     //!< time of the first sample in microseconds since epoch
         quint32 filler;
         quint32 crc32;
     };
+
+    struct IndexEntry
+    {
+        quint64 offset;          //!< file offset of the chunk header
+        quint64 timeStampUs;
+        quint64 centerFrequency;
+        quint32 sampleRate;
+        quint32 filler;
+    };
+
+    struct IndexTrailer
+    {
+        quint64 indexOffset;     //!< file offset of the first index entry
+        quint32 nbEntries;
+        quint32 marker;          //!< m_indexMarker
+        quint32 filler;
+        quint32 crc32;           //!< of the index entries and the trailer up to this field
+    };
 #pragma pack(pop)
 
+    // Compressed format: the header is followed by IQCodec blocks
+
+    struct Chunk //!< chunk as seen by readers. Files in the original format are made of one chunk.
+    {
+        quint64 dataOffset;      //!< file offset of the first sample or of the IQCodec block in the compressed format
+        quint64 sampleIndex;     //!< first sample index from the start of the record
+        quint64 nbSamples;
+        quint64 timeStampUs;
+        quint64 centerFrequency;
+        quint32 sampleRate;
+    };
+
+    typedef std::vector<Chunk> ChunkIndex;
+
+    static const quint32 m_chunkedFormatMarker = 0x32524453; //!< "SDR2"
+    static const quint32 m_compressedFormatMarker = 0x5a524453; //!< "SDRZ"
+    static const quint32 m_chunkMarker = 0x4b4e4843;         //!< "CHNK"
+    static const quint32 m_indexMarker = 0x58444e49;         //!< "INDX"
+    static const unsigned int m_chunkSeconds = 1;            //!< maximum chunk length
+
 	FileRecord();
     FileRecord(const QString& fileBase);
 	virtual ~FileRecord();
@@ -51,6 +105,13 @@ public:
     quint64 getByteCount() const { return m_byteCount; }
     void setMsShift(int shift) { m_msShift = shift; }
     const QString& getCurrentFileName() { return m_curentFileName; }
+    void setDirectIO(bool directIO) { m_directIO = directIO; }                      //!< applies to the next recording
+    void setPreallocation(quint64 preallocation) { m_preallocation = preallocation; } //!< bytes. Applies to the next recording
+    unsigned int getNbDroppedBuffers() const { return m_writer.getNbDroppedBuffers(); } //!< of the current or last recording
+    void setChunked(bool chunked) { m_chunked = chunked; }                          //!< applies to the next recording
+    void setWriterRingSize(quint64 ringSize) { m_writer.setRingSize(ringSize); }      //!< bytes buffered for the storage. Applies to the next recording. 0 for the default.
+    /** Applies to the next recording. Takes precedence over the chunked format. effectiveBits: 0 for lossless else most significant bits kept. */
+    void setCompression(bool compressed, unsigned int effectiveBits) { m_compressed = compressed; m_compressionBits = effectiveBits; }
 
     void genUniqueFileName(uint deviceUID, int istream = -1);
 
@@ -66,6 +127,20 @@ public:
 
     static bool readHeader(std::ifstream& samplefile, Header& header); //!< returns true if CRC checksum is correct else false
     static void writeHeader(std::ofstream& samplefile, Header& header);
+    static void setHeaderCRC(Header& header);
+    static bool isChunked(const Header& header) { return header.filler == m_chunkedFormatMarker; }
+    static bool isCompressed(const Header& header) { return header.filler == m_compressedFormatMarker; }
+    /**
+     * Builds the chunks list of a file which header has been read. In the chunked format the index at
+     * the end of the file is used or if it is missing or corrupted (interrupted recording) the chunk
+     * headers are searched in the whole file. In the compressed format each block is a chunk.
+     * Returns false if there are no samples.
+     */
+    static bool readChunkIndex(std::ifstream& sampleFile, quint64 fileSize, const Header& header, ChunkIndex& index);
+    static int findChunkBySample(const ChunkIndex& index, quint64 sampleIndex);    //!< O(log n)
+    static int findChunkByTimeStamp(const ChunkIndex& index, quint64 timeStampUs); //!< O(log n)
+    static quint64 getSampleIndex(const ChunkIndex& index, quint64 timeStampUs);   //!< sample at a given time
+    static quint64 getRecordLengthMuSec(const ChunkIndex& index);
 
 private:
 	QString m_fileBase;
@@ -73,12 +148,27 @@ private:
 	quint64 m_centerFrequency;
 	bool m_recordOn;
     bool m_recordStart;
-    std::ofstream m_sampleFile;
+    FileRecordWriter m_writer;
+    bool m_directIO;
+    quint64 m_preallocation;
     QString m_curentFileName;
     quint64 m_byteCount;
     int m_msShift;
+    bool m_chunked;
+    bool m_compressed;
+    unsigned int m_compressionBits;
+    bool m_newChunk;
+    quint64 m_chunkSampleCount;
+    std::vector<IndexEntry> m_index;
 
     void writeHeader();
+    void feedChunked(SampleVector::const_iterator begin, const SampleVector::const_iterator& end);
+    void writeChunkHeader();
+    void removeLostChunks();
+    void writeIndex();
+    static bool readIndexEntries(std::ifstream& sampleFile, quint64 fileSize, std::vector<IndexEntry>& entries);
+    static void scanChunkHeaders(std::ifstream& sampleFile, quint64 fileSize, std::vector<IndexEntry>& entries);
+    static void readCompressedBlocks(std::ifstream& sampleFile, quint64 fileSize, const Header& header, ChunkIndex& index);
 };
 
 #endif // INCLUDE_FILERECORD_H
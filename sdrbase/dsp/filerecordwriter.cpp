@@ -0,0 +1,325 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <QDebug>
+
+#include "filerecordwriter.h"
+
+FileRecordWriter::FileRecordWriter(unsigned int nbBuffers, unsigned int bufferSize) :
+    m_nbBuffers(nbBuffers < 2 ? 2 : nbBuffers),
+    m_bufferSize(((bufferSize + m_alignment - 1) / m_alignment) * m_alignment),
+    m_defaultBufferSize(m_bufferSize),
+    m_nextBufferSize(m_bufferSize),
+    m_fill(0),
+    m_position(0),
+    m_produceIndex(0),
+    m_consumeIndex(0),
+    m_nbQueued(0),
+    m_stop(false),
+    m_nbDroppedBuffers(0),
+    m_directIO(false),
+    m_nbBytes(0),
+    m_writeError(false),
+    m_compressed(false)
+{
+}
+
+FileRecordWriter::~FileRecordWriter()
+{
+    close();
+}
+
+bool FileRecordWriter::open(const QString& fileName, bool directIO, quint64 preallocation)
+{
+    close();
+
+    if (m_compressed && directIO)
+    {
+        qDebug("FileRecordWriter::open: compressed data sizes are not aligned: use buffered I/O");
+        directIO = false;
+    }
+
+    m_directIO = directIO;
+
+#if defined(__linux__)
+    int flags = O_WRONLY | O_CREAT | O_TRUNC;
+    int fd = ::open(fileName.toLocal8Bit().constData(), flags | (directIO ? O_DIRECT : 0), 0644);
+
+    if ((fd < 0) && directIO)
+    {
+        qWarning("FileRecordWriter::open: %s: direct I/O not supported: use buffered I/O", qPrintable(fileName));
+        m_directIO = false;
+        fd = ::open(fileName.toLocal8Bit().constData(), flags, 0644);
+    }
+
+    if (fd < 0)
+    {
+        qWarning("FileRecordWriter::open: cannot create %s", qPrintable(fileName));
+        return false;
+    }
+
+    // reserve the blocks without changing the file size so that an interrupted recording is still readable
+    if ((preallocation > 0) && (fallocate(fd, FALLOC_FL_KEEP_SIZE, 0, preallocation) < 0)) {
+        qWarning("FileRecordWriter::open: %s: cannot preallocate %llu bytes", qPrintable(fileName), preallocation);
+    }
+
+    if (!m_file.open(fd, QIODevice::WriteOnly | QIODevice::Unbuffered, QFileDevice::AutoCloseHandle))
+    {
+        ::close(fd);
+        return false;
+    }
+#else
+    (void) preallocation;
+    m_directIO = false; // only on Linux
+    m_file.setFileName(fileName);
+
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Unbuffered))
+    {
+        qWarning("FileRecordWriter::open: cannot create %s", qPrintable(fileName));
+        return false;
+    }
+#endif
+
+    m_bufferSize = m_nextBufferSize;
+    allocateBuffers();
+    m_fill = 0;
+    m_position = 0;
+    m_produceIndex = 0;
+    m_consumeIndex = 0;
+    m_nbQueued = 0;
+    m_stop = false;
+    m_nbDroppedBuffers = 0;
+    m_nbBytes = 0;
+    m_writeError = false;
+    m_header.clear();
+    start();
+
+    qDebug("FileRecordWriter::open: %s: %u buffers of %u bytes direct I/O: %s",
+        qPrintable(fileName), m_nbBuffers, m_bufferSize, m_directIO ? "on" : "off");
+    return true;
+}
+
+void FileRecordWriter::close()
+{
+    if (!m_file.isOpen()) {
+        return;
+    }
+
+    m_mutex.lock();
+    m_stop = true;
+    m_bufferQueued.wakeOne();
+    m_mutex.unlock();
+    wait();
+
+    if (m_header.size() > 0) // nothing was queued
+    {
+        m_nbBytes += writeBuffer(m_header.data(), m_header.size());
+        m_header.clear();
+    }
+
+    // the writer thread is done: write the buffer being filled from this thread
+    if (m_compressed)
+    {
+        m_nbBytes += writeData(m_buffers[m_produceIndex], m_fill);
+        m_fill = 0;
+    }
+    else if (m_fill > 0)
+    {
+        quint64 nbBytes = m_nbBytes + m_fill;
+
+        if (m_directIO) // sizes must be aligned: pad with zeros then truncate
+        {
+            unsigned int paddedSize = ((m_fill + m_alignment - 1) / m_alignment) * m_alignment;
+            std::fill(m_buffers[m_produceIndex] + m_fill, m_buffers[m_produceIndex] + paddedSize, 0);
+            writeBuffer(m_buffers[m_produceIndex], paddedSize);
+        }
+        else
+        {
+            writeBuffer(m_buffers[m_produceIndex], m_fill);
+        }
+
+        m_nbBytes = nbBytes;
+        m_fill = 0;
+    }
+
+    m_file.resize(m_nbBytes); // removes the padding and the unused preallocated blocks
+    m_file.close();
+    freeBuffers();
+
+    qDebug("FileRecordWriter::close: %llu bytes written %d buffers dropped", m_nbBytes, m_nbDroppedBuffers.load());
+}
+
+void FileRecordWriter::write(const char *data, unsigned int size)
+{
+    if (m_buffers.size() == 0) { // not open
+        return;
+    }
+
+    while (size > 0)
+    {
+        unsigned int chunk = std::min(size, m_bufferSize - m_fill);
+        std::copy(data, data + chunk, m_buffers[m_produceIndex] + m_fill);
+        m_fill += chunk;
+        m_position += chunk;
+        data += chunk;
+        size -= chunk;
+
+        if (m_fill == m_bufferSize) {
+            queueBuffer();
+        }
+    }
+}
+
+void FileRecordWriter::writeHeader(const char *data, unsigned int size)
+{
+    if (!m_compressed)
+    {
+        write(data, size);
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+    m_header.assign(data, data + size);
+}
+
+void FileRecordWriter::setCompression(bool compressed, unsigned int sampleBytes, unsigned int effectiveBits)
+{
+    if (isOpen()) {
+        return;
+    }
+
+    m_compressed = compressed;
+    m_codec.configure(sampleBytes, effectiveBits);
+}
+
+void FileRecordWriter::queueBuffer()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_nbQueued == m_nbBuffers - 1) // the writer thread is late: discard this buffer
+    {
+        m_nbDroppedBuffers.fetchAndAddRelaxed(1);
+        m_position -= m_bufferSize;
+    }
+    else
+    {
+        m_nbQueued++;
+        m_produceIndex = (m_produceIndex + 1) % m_nbBuffers;
+        m_bufferQueued.wakeOne();
+    }
+
+    m_fill = 0;
+}
+
+void FileRecordWriter::run()
+{
+    m_mutex.lock();
+
+    while (true)
+    {
+        while ((m_nbQueued == 0) && !m_stop) {
+            m_bufferQueued.wait(&m_mutex);
+        }
+
+        if (m_nbQueued == 0) { // stopped and all queued buffers written
+            break;
+        }
+
+        const char *buffer = m_buffers[m_consumeIndex];
+        std::vector<char> header;
+        header.swap(m_header); // set before the first buffer was queued
+        m_mutex.unlock();
+        quint64 nbBytes = header.size() > 0 ? writeBuffer(header.data(), header.size()) : 0;
+        nbBytes += writeData(buffer, m_bufferSize);
+        m_mutex.lock();
+        m_nbBytes += nbBytes;
+        m_consumeIndex = (m_consumeIndex + 1) % m_nbBuffers;
+        m_nbQueued--;
+    }
+
+    m_mutex.unlock();
+}
+
+quint64 FileRecordWriter::writeData(const char *buffer, unsigned int size)
+{
+    if (!m_compressed) {
+        return writeBuffer(buffer, size);
+    }
+
+    unsigned int nbSamples = size / (2 * m_codec.getSampleBytes());
+
+    if (nbSamples == 0) {
+        return 0;
+    }
+
+    unsigned int blockSize = m_codec.encode((const quint8 *) buffer, nbSamples, m_block);
+    return writeBuffer((const char *) m_block.data(), blockSize);
+}
+
+quint64 FileRecordWriter::writeBuffer(const char *buffer, unsigned int size)
+{
+    if (m_file.write(buffer, size) != (qint64) size)
+    {
+        if (!m_writeError) { // report once
+            qWarning("FileRecordWriter::writeBuffer: write error: %s", qPrintable(m_file.errorString()));
+        }
+
+        m_writeError = true;
+    }
+
+    return size;
+}
+
+void FileRecordWriter::setRingSize(quint64 ringSize)
+{
+    if (ringSize == 0)
+    {
+        m_nextBufferSize = m_defaultBufferSize;
+    }
+    else
+    {
+        quint64 bufferSize = (ringSize + m_nbBuffers - 1) / m_nbBuffers;
+        bufferSize = std::max((quint64) m_alignment, ((bufferSize + m_alignment - 1) / m_alignment) * m_alignment);
+        m_nextBufferSize = (unsigned int) std::min(bufferSize, (quint64) m_defaultBufferSize);
+    }
+}
+
+void FileRecordWriter::allocateBuffers()
+{
+    freeBuffers();
+
+    for (unsigned int i = 0; i < m_nbBuffers; i++) {
+        m_buffers.push_back((char *) qMallocAligned(m_bufferSize, m_alignment));
+    }
+}
+
+void FileRecordWriter::freeBuffers()
+{
+    for (unsigned int i = 0; i < m_buffers.size(); i++) {
+        qFreeAligned(m_buffers[i]);
+    }
+
+    m_buffers.clear();
+}
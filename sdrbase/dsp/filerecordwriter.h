@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Asynchronous file writer for recordings. The recording thread copies its data //
+// into a ring of large buffers that a dedicated thread writes to disk so that   //
+// a storage stall never blocks the DSP thread.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_FILERECORDWRITER_H
+#define SDRBASE_DSP_FILERECORDWRITER_H
+
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QAtomicInt>
+#include <QFile>
+#include <QString>
+
+#include "dsp/iqcodec.h"
+#include "export.h"
+
+/**
+ * Single producer single consumer: write() is called from the recording thread only and fills
+ * the current buffer. Full buffers are queued to the writer thread. When all buffers are waiting
+ * to be written the buffer being filled is discarded and counted as dropped so that the producer
+ * never waits on the storage.
+ *
+ * With compression the writer thread codes each buffer of samples in an IQCodec block so that
+ * the recording thread does not spend time in the codec.
+ */
+class SDRBASE_API FileRecordWriter : public QThread
+{
+public:
+    FileRecordWriter(unsigned int nbBuffers = 16, unsigned int bufferSize = 4*1024*1024); //!< bufferSize is rounded up to a multiple of m_alignment
+    ~FileRecordWriter();
+
+    /**
+     * Creates the file, allocates the buffers and starts the writer thread. Returns false if the file cannot be created.
+     * directIO: bypass the page cache (O_DIRECT) when the platform and file system support it
+     * preallocation: number of bytes to reserve on disk beforehand (0 for none). Linux only.
+     */
+    bool open(const QString& fileName, bool directIO, quint64 preallocation);
+    void close();   //!< writes the pending data, stops the thread and closes the file
+    bool isOpen() const { return m_file.isOpen(); }
+    void write(const char *data, unsigned int size); //!< never blocks
+    void writeHeader(const char *data, unsigned int size); //!< data written uncompressed before the samples. Call before the first write().
+    /**
+     * Applies to the next open. The data written must then be whole I/Q samples.
+     * sampleBytes: bytes of I or Q samples (2 or 4)
+     * effectiveBits: most significant bits kept by the lossy compression. 0 for lossless.
+     */
+    void setCompression(bool compressed, unsigned int sampleBytes, unsigned int effectiveBits);
+    void setRingSize(quint64 ringSize); //!< total size of the buffers in bytes up to the constructor size. Applies to the next open. 0 for the constructor size.
+
+    quint64 getPosition() const { return m_position; } //!< file offset of the next byte written. Call from the write() thread only.
+    unsigned int getNbDroppedBuffers() const { return m_nbDroppedBuffers.load(); }
+    unsigned int getBufferSize() const { return m_bufferSize; }
+    bool isDirectIO() const { return m_directIO; }
+
+protected:
+    virtual void run();
+
+private:
+    static const unsigned int m_alignment = 4096; //!< buffers address and size alignment as required by direct I/O
+
+    unsigned int m_nbBuffers;
+    unsigned int m_bufferSize;
+    unsigned int m_defaultBufferSize; //!< as given to the constructor
+    unsigned int m_nextBufferSize;    //!< applied at next open
+    std::vector<char*> m_buffers;
+    unsigned int m_fill;           //!< bytes in the buffer being filled
+    quint64 m_position;            //!< bytes written minus the dropped ones
+    unsigned int m_produceIndex;   //!< buffer being filled by write()
+    unsigned int m_consumeIndex;   //!< next buffer to be written to disk
+    unsigned int m_nbQueued;       //!< full buffers waiting to be written. At most m_nbBuffers - 1.
+    bool m_stop;
+    QMutex m_mutex;
+    QWaitCondition m_bufferQueued;
+    QAtomicInt m_nbDroppedBuffers;
+    QFile m_file;
+    bool m_directIO;
+    quint64 m_nbBytes;             //!< bytes actually in the file
+    bool m_writeError;
+    bool m_compressed;
+    IQCodec m_codec;
+    std::vector<quint8> m_block;   //!< compressed buffer
+    std::vector<char> m_header;    //!< pending uncompressed header
+
+    void queueBuffer();
+    quint64 writeData(const char *buffer, unsigned int size); //!< returns the number of bytes in the file
+    quint64 writeBuffer(const char *buffer, unsigned int size);
+    void allocateBuffers();
+    void freeBuffers();
+};
+
+#endif // SDRBASE_DSP_FILERECORDWRITER_H
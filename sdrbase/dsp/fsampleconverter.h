@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Conversions between the fixed point (Sample) and float (FSample) pipelines   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_FSAMPLECONVERTER_H_
+#define SDRBASE_DSP_FSAMPLECONVERTER_H_
+
+#include "dsp/dsptypes.h"
+
+/**
+ * FSample of the float pipeline are normalized to full scale 1.0 and Sample are scaled by SDR_RX_SCALEF.
+ * Float samples beyond full scale are clipped when converted to fixed point.
+ */
+struct FSampleConverter
+{
+    static inline FixReal toFixReal(Real x)
+    {
+        x *= SDR_RX_SCALEF;
+        return (FixReal) (x > SDR_RX_SCALEF - 1.0f ? SDR_RX_SCALEF - 1.0f : x < -SDR_RX_SCALEF ? -SDR_RX_SCALEF : x);
+    }
+
+    static void toSample(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, SampleVector& out)
+    {
+        out.resize(end - begin);
+        SampleVector::iterator oit = out.begin();
+
+        for (FSampleVector::const_iterator it = begin; it != end; ++it, ++oit)
+        {
+            oit->m_real = toFixReal(it->m_real);
+            oit->m_imag = toFixReal(it->m_imag);
+        }
+    }
+
+    static void toFSample(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, FSampleVector& out)
+    {
+        out.resize(end - begin);
+        FSampleVector::iterator oit = out.begin();
+
+        for (SampleVector::const_iterator it = begin; it != end; ++it, ++oit)
+        {
+            oit->m_real = it->m_real / SDR_RX_SCALEF;
+            oit->m_imag = it->m_imag / SDR_RX_SCALEF;
+        }
+    }
+};
+
+#endif // SDRBASE_DSP_FSAMPLECONVERTER_H_
@@ -50,6 +50,9 @@ void GLSpectrumSettings::resetToDefaults()
 	m_averagingMode = AvgModeNone;
 	m_averagingIndex = 0;
 	m_linear = false;
+	m_waterfallHistory = false;
+	m_waterfallHistoryMemoryMB = 64;
+	m_waterfallHistorySpillDirectory = "";
 }
 
 QByteArray GLSpectrumSettings::serialize() const
@@ -77,6 +80,9 @@ QByteArray GLSpectrumSettings::serialize() const
 	s.writeS32(19, (int) m_averagingMode);
 	s.writeS32(20, (qint32) getAveragingValue(m_averagingIndex, m_averagingMode));
 	s.writeBool(21, m_linear);
+	s.writeBool(22, m_waterfallHistory);
+	s.writeS32(23, m_waterfallHistoryMemoryMB);
+	s.writeString(24, m_waterfallHistorySpillDirectory);
 
 	return s.final();
 }
@@ -119,6 +125,9 @@ bool GLSpectrumSettings::deserialize(const QByteArray& data)
 		m_averagingIndex = getAveragingIndex(tmp, m_averagingMode);
 	    m_averagingNb = getAveragingValue(m_averagingIndex, m_averagingMode);
 	    d.readBool(21, &m_linear, false);
+		d.readBool(22, &m_waterfallHistory, false);
+		d.readS32(23, &m_waterfallHistoryMemoryMB, 64);
+		d.readString(24, &m_waterfallHistorySpillDirectory, "");
 
 		return true;
 	}
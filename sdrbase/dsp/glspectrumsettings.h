@@ -19,6 +19,7 @@
 #define SDRBASE_DSP_GLSPECTRUMSETTNGS_H
 
 #include <QByteArray>
+#include <QString>
 
 #include "export.h"
 #include "dsp/dsptypes.h"
@@ -58,6 +59,9 @@ public:
 	int m_averagingIndex;
 	unsigned int m_averagingNb;
 	bool m_linear; //!< linear else logarithmic scale
+	bool m_waterfallHistory;                  //!< keep a waterfall history in SpectrumVis
+	int m_waterfallHistoryMemoryMB;           //!< memory limit of the waterfall history
+	QString m_waterfallHistorySpillDirectory; //!< older waterfall history is spilled there. Empty to drop it.
 
     GLSpectrumSettings();
 	virtual ~GLSpectrumSettings();
@@ -1,7 +1,13 @@
 #define _USE_MATH_DEFINES
 #include <math.h>
 #include <vector>
+#include <algorithm>
 #include "dsp/interpolator.h"
+#include "util/cpufeatures.h"
+
+#if defined(CPUFEATURES_X86)
+#include <immintrin.h>
+#endif
 
 
 void Interpolator::createPolyphaseLowPass(
@@ -72,6 +78,10 @@ Interpolator::Interpolator() :
 	m_alignedTaps(0),
 	m_taps2(0),
 	m_alignedTaps2(0),
+	m_revTaps(0),
+	m_alignedRevTaps(0),
+	m_revTapsStride(0),
+	m_interpolateKernel(selectInterpolateKernel()),
     m_ptr(0),
 	m_phaseSteps(1),
     m_nTaps(1)
@@ -159,6 +169,27 @@ void Interpolator::create(int phaseSteps, double sampleRate, double cutoff, doub
 		m_alignedTaps2[2 * (i - 1) + 0] = polyphase[i];
 		m_alignedTaps2[2 * (i - 1) + 1] = polyphase[i];
 	}
+
+	// phase filters reversed so that the buffer versions run forward on the contiguous history
+	m_revTapsStride = ((2 * m_nTaps + 7) / 8) * 8;
+	m_revTaps = new float[phaseSteps * m_revTapsStride + 8];
+
+	for (int i = 0; i < phaseSteps * m_revTapsStride + 8; ++i) {
+	    m_revTaps[i] = 0;
+	}
+
+	m_alignedRevTaps = (float*)((((quint64)m_revTaps) + 31) & ~31);
+
+	for (int phase = 0; phase < phaseSteps; phase++)
+	{
+		for (int i = 0; i < m_nTaps; i++)
+		{
+			m_alignedRevTaps[phase * m_revTapsStride + 2 * i + 0] = polyphase[phase * m_nTaps + m_nTaps - 1 - i];
+			m_alignedRevTaps[phase * m_revTapsStride + 2 * i + 1] = polyphase[phase * m_nTaps + m_nTaps - 1 - i];
+		}
+	}
+
+	m_history.assign(m_nTaps, Complex{0, 0});
 }
 
 void Interpolator::free()
@@ -171,5 +202,162 @@ void Interpolator::free()
 		delete[] m_taps2;
 		m_taps2 = NULL;
 		m_alignedTaps2 = NULL;
+		delete[] m_revTaps;
+		m_revTaps = NULL;
+		m_alignedRevTaps = NULL;
+	}
+}
+
+const Complex *Interpolator::loadHistory(const Complex *in, unsigned int nbIn)
+{
+	// history from the ring buffer oldest first then the input samples
+	// extra room for the padding of the phase filters
+	if (m_history.size() < m_nTaps + nbIn + 4) {
+		m_history.resize(m_nTaps + nbIn + 4);
+	}
+
+	for (int i = 0; i < m_nTaps; i++) {
+		m_history[i] = m_samples[(m_ptr + m_nTaps - 1 - i) % m_nTaps];
+	}
+
+	std::copy(in, in + nbIn, m_history.begin() + m_nTaps);
+
+	return m_history.data();
+}
+
+void Interpolator::storeHistory(unsigned int nbIn)
+{
+	// back to the ring buffer so that per sample and buffer versions can be mixed
+	m_ptr = 0;
+
+	for (int i = 0; i < m_nTaps; i++) {
+		m_samples[i] = m_history[m_nTaps + nbIn - 1 - i];
+	}
+}
+
+void Interpolator::decimate(Real *distanceRemain, Real distance, const Complex *in, unsigned int nbIn, ComplexVector& out)
+{
+	if (!m_taps || (nbIn == 0)) {
+		return;
+	}
+
+	const Complex *history = loadHistory(in, nbIn);
+	Complex result;
+
+	for (unsigned int i = 0; i < nbIn; i++)
+	{
+		*distanceRemain -= 1.0;
+
+		if (*distanceRemain < 1.0)
+		{
+			// filter window ends with input sample i
+			doInterpolateBuffer(&history[i + 1], (int) floor(*distanceRemain * (Real) m_phaseSteps), &result);
+			out.push_back(result);
+			*distanceRemain += distance;
+		}
+	}
+
+	storeHistory(nbIn);
+}
+
+void Interpolator::interpolate(Real *distanceRemain, Real distance, const Complex *in, unsigned int nbIn, ComplexVector& out)
+{
+	if (!m_taps || (nbIn == 0)) {
+		return;
+	}
+
+	const Complex *history = loadHistory(in, nbIn);
+	Complex result;
+
+	for (unsigned int i = 0; i < nbIn; i++)
+	{
+		// filter window ends with the sample before input sample i
+		while (*distanceRemain < 1.0)
+		{
+			doInterpolateBuffer(&history[i], (int) floor(*distanceRemain * (Real) m_phaseSteps), &result);
+			out.push_back(result);
+			*distanceRemain += distance;
+		}
+
+		*distanceRemain -= 1.0;
+	}
+
+	storeHistory(nbIn);
+}
+
+void Interpolator::doInterpolateBuffer(const Complex *oldest, int phase, Complex* result) const
+{
+	if (phase < 0) {
+		phase = 0;
+	}
+
+	m_interpolateKernel((const float*) oldest, &m_alignedRevTaps[phase * m_revTapsStride], m_revTapsStride, result);
+}
+
+Interpolator::InterpolateKernel Interpolator::selectInterpolateKernel()
+{
+#if defined(CPUFEATURES_X86)
+	if (CPUFeatures::hasAVX2()) {
+		return interpolateKernelAVX2;
+	} else if (CPUFeatures::hasSSE2()) {
+		return interpolateKernelSSE2;
+	}
+#elif defined(USE_NEON)
+	if (CPUFeatures::hasNEON()) {
+		return interpolateKernelNEON;
+	}
+#endif
+	return interpolateKernelGeneric;
+}
+
+#if defined(CPUFEATURES_X86)
+CPUFEATURES_TARGET("avx2")
+void Interpolator::interpolateKernelAVX2(const float *src, const float *taps, int stride, Complex* result)
+{
+	__m256 sum = _mm256_setzero_ps();
+
+	for (int i = 0; i < stride; i += 8) {
+		sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(&src[i]), _mm256_load_ps(&taps[i])));
+	}
+
+	__m128 sum4 = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+	_mm_storel_pi((__m64*) result, _mm_add_ps(sum4, _mm_movehl_ps(sum4, sum4)));
+}
+
+CPUFEATURES_TARGET("sse2")
+void Interpolator::interpolateKernelSSE2(const float *src, const float *taps, int stride, Complex* result)
+{
+	__m128 sum = _mm_setzero_ps();
+
+	for (int i = 0; i < stride; i += 4) {
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&src[i]), _mm_load_ps(&taps[i])));
+	}
+
+	_mm_storel_pi((__m64*) result, _mm_add_ps(sum, _mm_movehl_ps(sum, sum)));
+}
+#elif defined(USE_NEON)
+void Interpolator::interpolateKernelNEON(const float *src, const float *taps, int stride, Complex* result)
+{
+	float32x4_t sum = vdupq_n_f32(0.0f);
+
+	for (int i = 0; i < stride; i += 4) {
+		sum = vmlaq_f32(sum, vld1q_f32(&src[i]), vld1q_f32(&taps[i]));
+	}
+
+	vst1_f32((float*) result, vadd_f32(vget_low_f32(sum), vget_high_f32(sum)));
+}
+#endif
+
+void Interpolator::interpolateKernelGeneric(const float *src, const float *taps, int stride, Complex* result)
+{
+	Real rAcc = 0;
+	Real iAcc = 0;
+
+	for (int i = 0; i < stride; i += 2)
+	{
+		rAcc += taps[i] * src[i];
+		iAcc += taps[i + 1] * src[i + 1];
 	}
+
+	*result = Complex(rAcc, iAcc);
 }
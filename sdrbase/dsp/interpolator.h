@@ -18,8 +18,12 @@
 #ifndef INCLUDE_INTERPOLATOR_H
 #define INCLUDE_INTERPOLATOR_H
 
-#ifdef USE_SSE2
+#if defined(USE_AVX2)
+#include <immintrin.h>
+#elif defined(USE_SSE2)
 #include <emmintrin.h>
+#elif defined(USE_NEON)
+#include <arm_neon.h>
 #endif
 #include "dsp/dsptypes.h"
 #include "export.h"
@@ -66,6 +70,11 @@ public:
         return consumed;
 	}
 
+	// buffer versions of decimate and interpolate: process nbIn input samples and append results to out
+	// distance is the input over output samples ratio and distanceRemain the running value as above
+	void decimate(Real *distanceRemain, Real distance, const Complex *in, unsigned int nbIn, ComplexVector& out);
+	void interpolate(Real *distanceRemain, Real distance, const Complex *in, unsigned int nbIn, ComplexVector& out);
+
 	// original interpolator which is actually an arbitrary rational resampler P/Q for any positive P, Q
 	// sampling frequency must be the highest of the two
 	bool resample(Real* distance, const Complex& next, bool* consumed, Complex* result)
@@ -94,7 +103,13 @@ private:
 	float* m_alignedTaps;
 	float* m_taps2;
 	float* m_alignedTaps2;
+	float* m_revTaps;
+	float* m_alignedRevTaps; //!< 32 bytes aligned phase filters in reverse order with duplicated coefficients for the buffer versions
+	int m_revTapsStride;     //!< number of floats per phase in m_alignedRevTaps (multiple of 8)
+	typedef void (*InterpolateKernel)(const float *src, const float *taps, int stride, Complex* result);
+	InterpolateKernel m_interpolateKernel; //!< buffer versions kernel for the instruction set of the CPU selected at run time
 	std::vector<Complex> m_samples;
+	ComplexVector m_history; //!< contiguous history followed by input samples for the buffer versions
 	int m_ptr;
 	int m_phaseSteps;
 	int m_nTaps;
@@ -117,6 +132,14 @@ private:
         double nbTapsPerPhase);
 
 	void createTaps(int nTaps, double sampleRate, double cutoff, std::vector<Real>* taps);
+	const Complex *loadHistory(const Complex *in, unsigned int nbIn);
+	void storeHistory(unsigned int nbIn);
+	void doInterpolateBuffer(const Complex *oldest, int phase, Complex* result) const;
+	static InterpolateKernel selectInterpolateKernel();
+	static void interpolateKernelAVX2(const float *src, const float *taps, int stride, Complex* result);
+	static void interpolateKernelSSE2(const float *src, const float *taps, int stride, Complex* result);
+	static void interpolateKernelNEON(const float *src, const float *taps, int stride, Complex* result);
+	static void interpolateKernelGeneric(const float *src, const float *taps, int stride, Complex* result);
 
 	void advanceFilter(const Complex& next)
 	{
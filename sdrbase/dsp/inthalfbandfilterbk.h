@@ -0,0 +1,250 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Integer half-band FIR based decimator                                         //
+// This is the block variant: a whole buffer is split in its two polyphase       //
+// streams that are stored contiguously after the history then the FIR is       //
+// run over several outputs at a time. Results are identical to the even/odd     //
+// variant (IntHalfbandFilterEO) run sample by sample.                           //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_INTHALFBANDFILTERBK_H_
+#define SDRBASE_DSP_INTHALFBANDFILTERBK_H_
+
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+
+#include "dsp/dsptypes.h"
+#include "dsp/hbfiltertraits.h"
+#include "dsp/inthalfbandfilterbki.h"
+
+/**
+ * HalveInput: divide input samples by 2 before filtering to avoid saturation on 16 bit samples
+ */
+template<typename StorageType, typename AccuType, uint32_t HBFilterOrder, bool HalveInput>
+class IntHalfbandFilterBK {
+public:
+    IntHalfbandFilterBK() :
+        m_state(0),
+        m_qPending(false)
+    {
+        for (int c = 0; c < 2; c++)
+        {
+            m_p[c].assign(m_pHistory, 0);
+            m_q[c].assign(m_qHistory, 0);
+        }
+    }
+
+    // downsample by 2, return center part of original spectrum
+    unsigned int workDecimateCenter(const Sample *in, unsigned int nbIn, Sample *out) {
+        return workDecimate<ModeCenter>(in, nbIn, out);
+    }
+
+    // downsample by 2, return lower half of original spectrum
+    unsigned int workDecimateLowerHalf(const Sample *in, unsigned int nbIn, Sample *out) {
+        return workDecimate<ModeLowerHalf>(in, nbIn, out);
+    }
+
+    // downsample by 2, return upper half of original spectrum
+    unsigned int workDecimateUpperHalf(const Sample *in, unsigned int nbIn, Sample *out) {
+        return workDecimate<ModeUpperHalf>(in, nbIn, out);
+    }
+
+    // same on interleaved I/Q samples. Values are not limited to the FixReal range.
+    unsigned int workDecimateCenter(const StorageType *in, unsigned int nbIn, StorageType *out) {
+        return workDecimate<ModeCenter>(in, nbIn, out);
+    }
+
+    unsigned int workDecimateLowerHalf(const StorageType *in, unsigned int nbIn, StorageType *out) {
+        return workDecimate<ModeLowerHalf>(in, nbIn, out);
+    }
+
+    unsigned int workDecimateUpperHalf(const StorageType *in, unsigned int nbIn, StorageType *out) {
+        return workDecimate<ModeUpperHalf>(in, nbIn, out);
+    }
+
+private:
+    enum Mode {
+        ModeCenter,
+        ModeLowerHalf,
+        ModeUpperHalf
+    };
+
+    static const unsigned int m_pHistory = HBFIRFilterTraits<HBFilterOrder>::hbOrder/2 - 1; //!< output phase samples kept for the taps
+    static const unsigned int m_qHistory = HBFIRFilterTraits<HBFilterOrder>::hbOrder/4 - 1; //!< other phase samples kept for the center tap
+
+    std::vector<StorageType> m_p[2]; //!< I and Q of the output phase samples (the ones on which a sample is output)
+    std::vector<StorageType> m_q[2]; //!< I and Q of the other phase samples
+    std::vector<StorageType> m_y[2]; //!< I and Q of the outputs
+    int m_state;                     //!< rotation phase of the next input sample (0..3). Odd phases produce an output.
+    bool m_qPending;                 //!< an other phase sample is waiting for its output phase sample
+
+    /** Returns the number of output samples. out may be the same as in. */
+    template<Mode mode, typename SampleType>
+    unsigned int workDecimate(const SampleType *in, unsigned int nbIn, SampleType *out)
+    {
+        unsigned int qStart = m_qHistory + (m_qPending ? 1 : 0);
+
+        for (int c = 0; c < 2; c++)
+        {
+            if (m_p[c].size() < m_pHistory + nbIn/2 + 1) {
+                m_p[c].resize(m_pHistory + nbIn/2 + 1);
+            }
+            if (m_q[c].size() < qStart + nbIn/2 + 1) {
+                m_q[c].resize(qStart + nbIn/2 + 1);
+            }
+            if (m_y[c].size() < nbIn/2 + 1) {
+                m_y[c].resize(nbIn/2 + 1);
+            }
+        }
+
+        // split into polyphase streams applying the quarter of sample rate rotation
+
+        StorageType *pI = m_p[0].data(), *pQ = m_p[1].data();
+        StorageType *qI = m_q[0].data(), *qQ = m_q[1].data();
+        unsigned int nbP = m_pHistory;
+        unsigned int nbQ = qStart;
+
+        for (unsigned int j = 0; j < nbIn; j++)
+        {
+            auto re = getReal(in, j);
+            auto im = getImag(in, j);
+            decltype(re) x, y;
+
+            if (HalveInput)
+            {
+                re /= 2;
+                im /= 2;
+            }
+
+            rotate<mode>(m_state, re, im, x, y);
+
+            if (m_state & 1)
+            {
+                pI[nbP] = x;
+                pQ[nbP] = y;
+                nbP++;
+            }
+            else
+            {
+                qI[nbQ] = x;
+                qQ[nbQ] = y;
+                nbQ++;
+            }
+
+            m_state = (m_state + 1) & 3;
+        }
+
+        unsigned int nbOut = nbP - m_pHistory;
+
+        // run the FIR on the output phase
+
+        for (int c = 0; c < 2; c++) {
+            doFIR(m_p[c].data(), m_q[c].data(), nbOut, m_y[c].data());
+        }
+
+        for (unsigned int m = 0; m < nbOut; m++) {
+            setOutput(out, m, m_y[0][m], m_y[1][m]);
+        }
+
+        // keep history for next block
+
+        for (int c = 0; c < 2; c++)
+        {
+            std::copy(m_p[c].begin() + nbOut, m_p[c].begin() + nbP, m_p[c].begin());
+            std::copy(m_q[c].begin() + nbOut, m_q[c].begin() + nbQ, m_q[c].begin());
+        }
+
+        m_qPending = nbQ - nbOut > m_qHistory;
+
+        return nbOut;
+    }
+
+    static FixReal getReal(const Sample *in, unsigned int j) { return in[j].real(); }
+    static FixReal getImag(const Sample *in, unsigned int j) { return in[j].imag(); }
+    static StorageType getReal(const StorageType *in, unsigned int j) { return in[2*j]; }
+    static StorageType getImag(const StorageType *in, unsigned int j) { return in[2*j + 1]; }
+
+    static void setOutput(Sample *out, unsigned int m, StorageType re, StorageType im)
+    {
+        out[m].setReal(re);
+        out[m].setImag(im);
+    }
+
+    static void setOutput(StorageType *out, unsigned int m, StorageType re, StorageType im)
+    {
+        out[2*m] = re;
+        out[2*m + 1] = im;
+    }
+
+    /** ValueType is FixReal for Sample input so that the negation wraps as in the even/odd variant */
+    template<Mode mode, typename ValueType>
+    static void rotate(int state, ValueType re, ValueType im, ValueType& x, ValueType& y)
+    {
+        if (mode == ModeCenter)
+        {
+            x = re;
+            y = im;
+            return;
+        }
+
+        switch (state)
+        {
+        case 0:
+            x = mode == ModeLowerHalf ? (ValueType) -im : im;
+            y = mode == ModeLowerHalf ? re : (ValueType) -re;
+            break;
+        case 1:
+            x = -re;
+            y = -im;
+            break;
+        case 2:
+            x = mode == ModeLowerHalf ? im : (ValueType) -im;
+            y = mode == ModeLowerHalf ? (ValueType) -re : re;
+            break;
+        default:
+            x = re;
+            y = im;
+            break;
+        }
+    }
+
+    /** p: output phase stream with history, q: other phase stream with history */
+    static void doFIR(const StorageType *p, const StorageType *q, unsigned int nbOut, StorageType *y)
+    {
+        unsigned int m = 0;
+
+        if ((sizeof(StorageType) == 4) && (sizeof(AccuType) == 4)) { // 32 bit lanes give the same result as the scalar code
+            m = IntHalfbandFilterBKIntrinsics<HBFilterOrder>::work((const int32_t*) p, (const int32_t*) q, nbOut, (int32_t*) y);
+        }
+
+        for (; m < nbOut; m++)
+        {
+            AccuType acc = 0;
+
+            for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++) {
+                acc += ((StorageType)(p[m_pHistory + m - i] + p[m + i])) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
+            }
+
+            acc += q[m] << (HBFIRFilterTraits<HBFilterOrder>::hbShift - 1);
+            y[m] = acc >> (HBFIRFilterTraits<HBFilterOrder>::hbShift - 1);
+        }
+    }
+};
+
+#endif /* SDRBASE_DSP_INTHALFBANDFILTERBK_H_ */
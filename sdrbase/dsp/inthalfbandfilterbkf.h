@@ -0,0 +1,211 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Float half-band FIR based decimator                                           //
+// Block variant on FSample of IntHalfbandFilterBK: the polyphase streams are    //
+// stored contiguously after the history so that the FIR loop over several       //
+// outputs can be vectorized by the compiler. Unity gain.                        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_INTHALFBANDFILTERBKF_H_
+#define SDRBASE_DSP_INTHALFBANDFILTERBKF_H_
+
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+
+#include "dsp/dsptypes.h"
+#include "dsp/hbfiltertraits.h"
+
+template<uint32_t HBFilterOrder>
+class IntHalfbandFilterBKF {
+public:
+    IntHalfbandFilterBKF() :
+        m_state(0),
+        m_qPending(false)
+    {
+        for (int i = 0; i < m_nbCoeffs; i++) {
+            m_coeffs[i] = HBFIRFilterTraits<HBFilterOrder>::hbCoeffsF[i];
+        }
+
+        for (int c = 0; c < 2; c++)
+        {
+            m_p[c].assign(m_pHistory, 0.0f);
+            m_q[c].assign(m_qHistory, 0.0f);
+        }
+    }
+
+    // downsample by 2, return center part of original spectrum
+    unsigned int workDecimateCenter(const FSample *in, unsigned int nbIn, FSample *out) {
+        return workDecimate<ModeCenter>(in, nbIn, out);
+    }
+
+    // downsample by 2, return lower half of original spectrum
+    unsigned int workDecimateLowerHalf(const FSample *in, unsigned int nbIn, FSample *out) {
+        return workDecimate<ModeLowerHalf>(in, nbIn, out);
+    }
+
+    // downsample by 2, return upper half of original spectrum
+    unsigned int workDecimateUpperHalf(const FSample *in, unsigned int nbIn, FSample *out) {
+        return workDecimate<ModeUpperHalf>(in, nbIn, out);
+    }
+
+private:
+    enum Mode {
+        ModeCenter,
+        ModeLowerHalf,
+        ModeUpperHalf
+    };
+
+    static const int m_nbCoeffs = HBFIRFilterTraits<HBFilterOrder>::hbOrder/4;
+    static const unsigned int m_pHistory = HBFIRFilterTraits<HBFilterOrder>::hbOrder/2 - 1; //!< output phase samples kept for the taps
+    static const unsigned int m_qHistory = HBFIRFilterTraits<HBFilterOrder>::hbOrder/4 - 1; //!< other phase samples kept for the center tap
+
+    Real m_coeffs[m_nbCoeffs];
+    std::vector<Real> m_p[2]; //!< I and Q of the output phase samples (the ones on which a sample is output)
+    std::vector<Real> m_q[2]; //!< I and Q of the other phase samples
+    std::vector<Real> m_y[2]; //!< I and Q of the outputs
+    int m_state;              //!< rotation phase of the next input sample (0..3). Odd phases produce an output.
+    bool m_qPending;          //!< an other phase sample is waiting for its output phase sample
+
+    /** Returns the number of output samples. out may be the same as in. */
+    template<Mode mode>
+    unsigned int workDecimate(const FSample *in, unsigned int nbIn, FSample *out)
+    {
+        unsigned int qStart = m_qHistory + (m_qPending ? 1 : 0);
+
+        for (int c = 0; c < 2; c++)
+        {
+            if (m_p[c].size() < m_pHistory + nbIn/2 + 1) {
+                m_p[c].resize(m_pHistory + nbIn/2 + 1);
+            }
+            if (m_q[c].size() < qStart + nbIn/2 + 1) {
+                m_q[c].resize(qStart + nbIn/2 + 1);
+            }
+            if (m_y[c].size() < nbIn/2 + 1) {
+                m_y[c].resize(nbIn/2 + 1);
+            }
+        }
+
+        // split into polyphase streams applying the quarter of sample rate rotation
+
+        Real *pI = m_p[0].data(), *pQ = m_p[1].data();
+        Real *qI = m_q[0].data(), *qQ = m_q[1].data();
+        unsigned int nbP = m_pHistory;
+        unsigned int nbQ = qStart;
+
+        for (unsigned int j = 0; j < nbIn; j++)
+        {
+            Real x, y;
+            rotate<mode>(m_state, in[j].m_real, in[j].m_imag, x, y);
+
+            if (m_state & 1)
+            {
+                pI[nbP] = x;
+                pQ[nbP] = y;
+                nbP++;
+            }
+            else
+            {
+                qI[nbQ] = x;
+                qQ[nbQ] = y;
+                nbQ++;
+            }
+
+            m_state = (m_state + 1) & 3;
+        }
+
+        unsigned int nbOut = nbP - m_pHistory;
+
+        // run the FIR on the output phase
+
+        for (int c = 0; c < 2; c++) {
+            doFIR(m_p[c].data(), m_q[c].data(), nbOut, m_y[c].data());
+        }
+
+        for (unsigned int m = 0; m < nbOut; m++)
+        {
+            out[m].m_real = m_y[0][m];
+            out[m].m_imag = m_y[1][m];
+        }
+
+        // keep history for next block
+
+        for (int c = 0; c < 2; c++)
+        {
+            std::copy(m_p[c].begin() + nbOut, m_p[c].begin() + nbP, m_p[c].begin());
+            std::copy(m_q[c].begin() + nbOut, m_q[c].begin() + nbQ, m_q[c].begin());
+        }
+
+        m_qPending = nbQ - nbOut > m_qHistory;
+
+        return nbOut;
+    }
+
+    template<Mode mode>
+    static void rotate(int state, Real re, Real im, Real& x, Real& y)
+    {
+        if (mode == ModeCenter)
+        {
+            x = re;
+            y = im;
+            return;
+        }
+
+        switch (state)
+        {
+        case 0:
+            x = mode == ModeLowerHalf ? -im : im;
+            y = mode == ModeLowerHalf ? re : -re;
+            break;
+        case 1:
+            x = -re;
+            y = -im;
+            break;
+        case 2:
+            x = mode == ModeLowerHalf ? im : -im;
+            y = mode == ModeLowerHalf ? -re : re;
+            break;
+        default:
+            x = re;
+            y = im;
+            break;
+        }
+    }
+
+    /** p: output phase stream with history, q: other phase stream with history */
+    void doFIR(const Real *p, const Real *q, unsigned int nbOut, Real *y) const
+    {
+        for (unsigned int m = 0; m < nbOut; m++) {
+            y[m] = 0.5f * q[m];
+        }
+
+        // tap by tap so that the inner loop over the outputs is vectorized
+        for (int i = 0; i < m_nbCoeffs; i++)
+        {
+            const Real c = m_coeffs[i];
+            const Real *pa = p + m_pHistory - i;
+            const Real *pb = p + i;
+
+            for (unsigned int m = 0; m < nbOut; m++) {
+                y[m] += (pa[m] + pb[m]) * c;
+            }
+        }
+    }
+};
+
+#endif /* SDRBASE_DSP_INTHALFBANDFILTERBKF_H_ */
@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Integer half-band FIR based decimator                                         //
+// This is the block variant working on polyphase streams                        //
+// This is the SIMD intrinsics code                                              //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_INTHALFBANDFILTERBKI_H_
+#define SDRBASE_DSP_INTHALFBANDFILTERBKI_H_
+
+#include <stdint.h>
+
+#include "util/cpufeatures.h"
+
+#if defined(CPUFEATURES_X86)
+#include <immintrin.h>
+#elif defined(USE_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "hbfiltertraits.h"
+
+/**
+ * Computes the outputs of one component (I or Q) several at a time. Output m is:
+ * sum(h[i] * (p[hbOrder/2 - 1 + m - i] + p[m + i])) + (q[m] << (hbShift - 1)) >> (hbShift - 1)
+ * This is the same 32 bit wrapping arithmetic as the scalar code.
+ * The variant is chosen at run time from the instruction sets of the CPU (see CPUFeatures).
+ */
+template<uint32_t HBFilterOrder>
+class IntHalfbandFilterBKIntrinsics
+{
+public:
+    /** Returns the number of outputs done. The caller completes the remainder. */
+    static unsigned int work(const int32_t *p, const int32_t *q, unsigned int nbOut, int32_t *out)
+    {
+#if defined(CPUFEATURES_X86)
+        switch (CPUFeatures::getLevel())
+        {
+        case CPUFeatures::LevelAVX512:
+            return workAVX512(p, q, nbOut, out);
+        case CPUFeatures::LevelAVX2:
+            return workAVX2(p, q, nbOut, out);
+        case CPUFeatures::LevelSSE4_1:
+            return workSSE4_1(p, q, nbOut, out, 0);
+        default:
+            return 0;
+        }
+#elif defined(USE_NEON)
+        return CPUFeatures::hasNEON() ? workNEON(p, q, nbOut, out) : 0;
+#else
+        (void) p;
+        (void) q;
+        (void) nbOut;
+        (void) out;
+        return 0;
+#endif
+    }
+
+    /** work() does something on this CPU */
+    static bool isAccelerated()
+    {
+#if defined(CPUFEATURES_X86)
+        return CPUFeatures::hasSSE4_1();
+#elif defined(USE_NEON)
+        return CPUFeatures::hasNEON();
+#else
+        return false;
+#endif
+    }
+
+private:
+    static const int m_tip = HBFIRFilterTraits<HBFilterOrder>::hbOrder/2 - 1;
+    static const int m_shift = HBFIRFilterTraits<HBFilterOrder>::hbShift - 1;
+
+#if defined(CPUFEATURES_X86)
+    CPUFEATURES_TARGET("avx512f")
+    static unsigned int workAVX512(const int32_t *p, const int32_t *q, unsigned int nbOut, int32_t *out)
+    {
+        unsigned int m = 0;
+
+        for (; m + 16 <= nbOut; m += 16)
+        {
+            __m512i acc = _mm512_slli_epi32(_mm512_loadu_si512((const void*) &q[m]), m_shift);
+
+            for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
+            {
+                __m512i sa = _mm512_loadu_si512((const void*) &p[m_tip + m - i]);
+                __m512i sb = _mm512_loadu_si512((const void*) &p[m + i]);
+                acc = _mm512_add_epi32(acc, _mm512_mullo_epi32(_mm512_add_epi32(sa, sb), _mm512_set1_epi32(HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i])));
+            }
+
+            _mm512_storeu_si512((void*) &out[m], _mm512_srai_epi32(acc, m_shift));
+        }
+
+        return workSSE4_1(p, q, nbOut, out, m);
+    }
+
+    CPUFEATURES_TARGET("avx2")
+    static unsigned int workAVX2(const int32_t *p, const int32_t *q, unsigned int nbOut, int32_t *out)
+    {
+        unsigned int m = 0;
+
+        for (; m + 8 <= nbOut; m += 8)
+        {
+            __m256i acc = _mm256_slli_epi32(_mm256_loadu_si256((const __m256i*) &q[m]), m_shift);
+
+            for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
+            {
+                __m256i sa = _mm256_loadu_si256((const __m256i*) &p[m_tip + m - i]);
+                __m256i sb = _mm256_loadu_si256((const __m256i*) &p[m + i]);
+                acc = _mm256_add_epi32(acc, _mm256_mullo_epi32(_mm256_add_epi32(sa, sb), _mm256_set1_epi32(HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i])));
+            }
+
+            _mm256_storeu_si256((__m256i*) &out[m], _mm256_srai_epi32(acc, m_shift));
+        }
+
+        return workSSE4_1(p, q, nbOut, out, m);
+    }
+
+    /** starts at output m */
+    CPUFEATURES_TARGET("sse4.1")
+    static unsigned int workSSE4_1(const int32_t *p, const int32_t *q, unsigned int nbOut, int32_t *out, unsigned int m)
+    {
+        for (; m + 4 <= nbOut; m += 4)
+        {
+            __m128i acc = _mm_slli_epi32(_mm_loadu_si128((const __m128i*) &q[m]), m_shift);
+
+            for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
+            {
+                __m128i sa = _mm_loadu_si128((const __m128i*) &p[m_tip + m - i]);
+                __m128i sb = _mm_loadu_si128((const __m128i*) &p[m + i]);
+                acc = _mm_add_epi32(acc, _mm_mullo_epi32(_mm_add_epi32(sa, sb), _mm_set1_epi32(HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i])));
+            }
+
+            _mm_storeu_si128((__m128i*) &out[m], _mm_srai_epi32(acc, m_shift));
+        }
+
+        return m;
+    }
+#elif defined(USE_NEON)
+    static unsigned int workNEON(const int32_t *p, const int32_t *q, unsigned int nbOut, int32_t *out)
+    {
+        unsigned int m = 0;
+
+        for (; m + 4 <= nbOut; m += 4)
+        {
+            int32x4_t acc = vshlq_n_s32(vld1q_s32(&q[m]), m_shift);
+
+            for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
+            {
+                int32x4_t sa = vld1q_s32(&p[m_tip + m - i]);
+                int32x4_t sb = vld1q_s32(&p[m + i]);
+                acc = vmlaq_n_s32(acc, vaddq_s32(sa, sb), HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i]);
+            }
+
+            vst1q_s32(&out[m], vshrq_n_s32(acc, m_shift));
+        }
+
+        return m;
+    }
+#endif
+};
+
+#endif /* SDRBASE_DSP_INTHALFBANDFILTERBKI_H_ */
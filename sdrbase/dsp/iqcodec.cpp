@@ -0,0 +1,353 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <algorithm>
+
+#include "iqcodec.h"
+
+namespace {
+
+// Residuals are coded MSB first as: order (2 bits) and Rice parameter k (5 bits) per partition
+// then for each residual the quotient in unary (zeros ended by a one) and the k low bits.
+// A quotient of 31 or more is escaped as 31 zeros and a one followed by the 32 bits residual.
+const unsigned int escapeQuotient = 31;
+
+inline unsigned int clz64(quint64 x) // x != 0
+{
+#if defined(__GNUC__)
+    return __builtin_clzll(x);
+#else
+    unsigned int n = 0;
+
+    while ((x & 0x8000000000000000ULL) == 0)
+    {
+        x <<= 1;
+        n++;
+    }
+
+    return n;
+#endif
+}
+
+class BitWriter
+{
+public:
+    BitWriter(std::vector<quint8>& out) : m_out(out), m_acc(0), m_nbBits(0) {}
+
+    void put(quint32 value, unsigned int nbBits) //!< nbBits <= 32 and value < 2^nbBits
+    {
+        m_acc = (m_acc << nbBits) | value;
+        m_nbBits += nbBits;
+
+        while (m_nbBits >= 8)
+        {
+            m_nbBits -= 8;
+            m_out.push_back((quint8) (m_acc >> m_nbBits));
+        }
+    }
+
+    void flush()
+    {
+        if (m_nbBits > 0) {
+            m_out.push_back((quint8) (m_acc << (8 - m_nbBits)));
+        }
+
+        m_nbBits = 0;
+    }
+
+private:
+    std::vector<quint8>& m_out;
+    quint64 m_acc;
+    unsigned int m_nbBits;
+};
+
+class BitReader
+{
+public:
+    BitReader(const quint8 *data, unsigned int nbBytes) :
+        m_begin(data), m_p(data), m_end(data + nbBytes), m_acc(0), m_nbBits(0), m_padBytes(0)
+    {}
+
+    quint32 get(unsigned int nbBits) //!< nbBits <= 32
+    {
+        if (nbBits == 0) {
+            return 0;
+        }
+
+        refill();
+        quint32 value = (quint32) (m_acc >> (64 - nbBits));
+        m_acc <<= nbBits;
+        m_nbBits -= nbBits;
+        return value;
+    }
+
+    unsigned int unary() //!< number of zeros before the next one. The one is consumed.
+    {
+        refill();
+        unsigned int zeros = m_acc == 0 ? 64 : clz64(m_acc);
+
+        if (zeros > escapeQuotient) // corrupted
+        {
+            zeros = escapeQuotient;
+            m_padBytes = m_end - m_begin + 1; // make overrun() true
+        }
+
+        m_acc <<= zeros + 1;
+        m_nbBits -= zeros + 1;
+        return zeros;
+    }
+
+    bool overrun() const { return ((m_p - m_begin) + m_padBytes) * 8 - m_nbBits > (quint64) (m_end - m_begin) * 8; }
+
+private:
+    const quint8 *m_begin;
+    const quint8 *m_p;
+    const quint8 *m_end;
+    quint64 m_acc;        //!< bits to read aligned on the most significant bit
+    unsigned int m_nbBits;
+    quint64 m_padBytes;   //!< zeros read past the end
+
+    void refill() //!< at least 57 bits in the accumulator
+    {
+        while (m_nbBits <= 56)
+        {
+            quint64 byte = 0;
+
+            if (m_p < m_end) {
+                byte = *m_p++;
+            } else {
+                m_padBytes++;
+            }
+
+            m_acc |= byte << (56 - m_nbBits);
+            m_nbBits += 8;
+        }
+    }
+};
+
+} // namespace
+
+IQCodec::IQCodec() :
+    m_sampleBytes(2),
+    m_shift(0),
+    m_residuals(m_partitionSize)
+{
+}
+
+void IQCodec::configure(unsigned int sampleBytes, unsigned int effectiveBits)
+{
+    m_sampleBytes = sampleBytes == 4 ? 4 : 2;
+    unsigned int sampleBits = m_sampleBytes == 4 ? 24 : 16;
+    m_shift = (effectiveBits == 0) || (effectiveBits >= sampleBits) ? 0 : sampleBits - effectiveBits;
+}
+
+unsigned int IQCodec::encode(const quint8 *samples, unsigned int nbSamples, std::vector<quint8>& block)
+{
+    unsigned int rawBytes = nbSamples * 2 * m_sampleBytes;
+    block.reserve(sizeof(BlockHeader) + rawBytes + 16);
+    block.resize(sizeof(BlockHeader));
+
+    if (m_sampleBytes == 4) {
+        encodeSamples((const qint32*) samples, nbSamples, block);
+    } else {
+        encodeSamples((const qint16*) samples, nbSamples, block);
+    }
+
+    BlockHeader header;
+    header.marker = m_blockMarker;
+    header.nbSamples = nbSamples;
+    header.shift = m_shift;
+    header.verbatim = 0;
+    header.filler = 0;
+
+    if (block.size() - sizeof(BlockHeader) >= rawBytes) // coding does not help (ex: white noise at full scale)
+    {
+        block.resize(sizeof(BlockHeader));
+        block.insert(block.end(), samples, samples + rawBytes);
+        header.shift = 0;
+        header.verbatim = 1;
+    }
+
+    header.nbBytes = block.size() - sizeof(BlockHeader);
+    memcpy(block.data(), &header, sizeof(BlockHeader));
+    return block.size();
+}
+
+template<typename T>
+void IQCodec::encodeSamples(const T *samples, unsigned int nbSamples, std::vector<quint8>& block)
+{
+    BitWriter writer(block);
+    qint32 history[2][3] = {{0, 0, 0}, {0, 0, 0}}; // x[n-1], x[n-2], x[n-3] of I and Q. Zeros before the block.
+
+    for (unsigned int start = 0; start < nbSamples; start += m_partitionSize)
+    {
+        unsigned int n = std::min(m_partitionSize, nbSamples - start);
+        const T *p = &samples[2*start];
+
+        for (unsigned int c = 0; c < 2; c++)
+        {
+            // sum of the absolute residuals of the fixed predictors of order 0 to 3
+            quint64 sums[4] = {0, 0, 0, 0};
+            qint32 x1 = history[c][0], x2 = history[c][1], x3 = history[c][2];
+
+            for (unsigned int i = 0; i < n; i++)
+            {
+                qint32 x = p[2*i + c] >> m_shift;
+                qint32 e1 = x - x1;
+                qint32 e2 = e1 - (x1 - x2);
+                qint32 e3 = e2 - (x1 - x2) + (x2 - x3);
+                sums[0] += x < 0 ? -x : x;
+                sums[1] += e1 < 0 ? -e1 : e1;
+                sums[2] += e2 < 0 ? -e2 : e2;
+                sums[3] += e3 < 0 ? -e3 : e3;
+                x3 = x2;
+                x2 = x1;
+                x1 = x;
+            }
+
+            unsigned int order = std::min_element(sums, sums + 4) - sums;
+            x1 = history[c][0];
+            x2 = history[c][1];
+            x3 = history[c][2];
+            quint64 sum = 0;
+
+            for (unsigned int i = 0; i < n; i++)
+            {
+                qint32 x = p[2*i + c] >> m_shift;
+                qint32 e = order == 0 ? x : order == 1 ? x - x1 : order == 2 ? x - 2*x1 + x2 : x - 3*x1 + 3*x2 - x3;
+                quint32 u = ((quint32) e << 1) ^ (quint32) (e >> 31); // zigzag: small magnitudes give small values
+                m_residuals[i] = u;
+                sum += u;
+                x3 = x2;
+                x2 = x1;
+                x1 = x;
+            }
+
+            history[c][0] = x1;
+            history[c][1] = x2;
+            history[c][2] = x3;
+
+            // Rice parameter close to log2 of the mean
+            unsigned int k = 0;
+
+            while ((k < 30) && (((quint64) n << (k + 1)) < sum)) {
+                k++;
+            }
+
+            writer.put(order, 2);
+            writer.put(k, 5);
+            quint32 mask = (1U << k) - 1;
+
+            for (unsigned int i = 0; i < n; i++)
+            {
+                quint32 u = m_residuals[i];
+                quint32 q = u >> k;
+
+                if (q < escapeQuotient)
+                {
+                    writer.put(1, q + 1);
+                    writer.put(u & mask, k);
+                }
+                else
+                {
+                    writer.put(1, escapeQuotient + 1);
+                    writer.put(u, 32);
+                }
+            }
+        }
+    }
+
+    writer.flush();
+}
+
+bool IQCodec::decode(const quint8 *block, unsigned int blockSize, unsigned int sampleBytes, quint8 *samples)
+{
+    BlockHeader header;
+
+    if (blockSize < sizeof(BlockHeader)) {
+        return false;
+    }
+
+    memcpy(&header, block, sizeof(BlockHeader));
+
+    if ((header.marker != m_blockMarker) || (header.nbBytes > blockSize - sizeof(BlockHeader))) {
+        return false;
+    }
+
+    const quint8 *data = block + sizeof(BlockHeader);
+
+    if (header.verbatim)
+    {
+        if (header.nbBytes != header.nbSamples * 2 * sampleBytes) {
+            return false;
+        }
+
+        std::copy(data, data + header.nbBytes, samples);
+        return true;
+    }
+
+    if (sampleBytes == 4) {
+        return decodeSamples(data, header.nbBytes, header.nbSamples, header.shift, (qint32*) samples);
+    } else {
+        return decodeSamples(data, header.nbBytes, header.nbSamples, header.shift, (qint16*) samples);
+    }
+}
+
+template<typename T>
+bool IQCodec::decodeSamples(const quint8 *data, unsigned int nbBytes, unsigned int nbSamples, unsigned int shift, T *samples)
+{
+    BitReader reader(data, nbBytes);
+    qint32 history[2][3] = {{0, 0, 0}, {0, 0, 0}};
+    qint32 scale = 1 << shift;
+
+    for (unsigned int start = 0; start < nbSamples; start += m_partitionSize)
+    {
+        unsigned int n = std::min(m_partitionSize, nbSamples - start);
+        T *p = &samples[2*start];
+
+        for (unsigned int c = 0; c < 2; c++)
+        {
+            unsigned int order = reader.get(2);
+            unsigned int k = reader.get(5);
+            qint32 x1 = history[c][0], x2 = history[c][1], x3 = history[c][2];
+
+            for (unsigned int i = 0; i < n; i++)
+            {
+                unsigned int q = reader.unary();
+                quint32 u = q < escapeQuotient ? (q << k) | reader.get(k) : reader.get(32);
+                qint32 e = (qint32) (u >> 1) ^ -(qint32) (u & 1);
+                qint32 x = order == 0 ? e : order == 1 ? x1 + e : order == 2 ? 2*x1 - x2 + e : 3*x1 - 3*x2 + x3 + e;
+                p[2*i + c] = (T) (x * scale);
+                x3 = x2;
+                x2 = x1;
+                x1 = x;
+            }
+
+            history[c][0] = x1;
+            history[c][1] = x2;
+            history[c][2] = x3;
+        }
+
+        if (reader.overrun()) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,80 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Compression of I/Q sample blocks for recordings. Lossless with fixed integer  //
+// predictors and Rice coding of the residuals as in FLAC. Lossy by keeping only //
+// the most significant bits of the samples before the lossless coding.          //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_IQCODEC_H
+#define SDRBASE_DSP_IQCODEC_H
+
+#include <vector>
+
+#include <QtGlobal>
+
+#include "export.h"
+
+/**
+ * A block holds interleaved I/Q samples of 16 bits (2 bytes) or 24 bits (in 4 bytes) and can be
+ * decoded on its own. It is cut in partitions of m_partitionSize samples. For each partition and
+ * each of I and Q the fixed predictor of order 0 to 3 giving the smallest residuals is used and
+ * the residuals are Rice coded with their own parameter. If coding does not reduce the size the
+ * samples are stored as they are.
+ */
+class SDRBASE_API IQCodec
+{
+public:
+#pragma pack(push, 1)
+    struct BlockHeader
+    {
+        quint32 marker;       //!< m_blockMarker
+        quint32 nbSamples;    //!< I/Q samples in the block
+        quint32 nbBytes;      //!< size of the data following the header
+        quint8 shift;         //!< number of least significant bits dropped (lossy)
+        quint8 verbatim;      //!< 1 if the samples are not coded
+        quint16 filler;
+    };
+#pragma pack(pop)
+
+    static const quint32 m_blockMarker = 0x425a5149;  //!< "IQZB"
+    static const unsigned int m_partitionSize = 4096;
+
+    IQCodec();
+
+    /**
+     * sampleBytes: bytes of I or Q samples: 2 for 16 bits or 4 for 24 bits
+     * effectiveBits: number of most significant bits kept. 0 for lossless.
+     */
+    void configure(unsigned int sampleBytes, unsigned int effectiveBits);
+    unsigned int getSampleBytes() const { return m_sampleBytes; }
+
+    /** Codes nbSamples I/Q samples into block (header included) and returns the size of the block */
+    unsigned int encode(const quint8 *samples, unsigned int nbSamples, std::vector<quint8>& block);
+    /** Decodes a block of blockSize bytes into nbSamples (from the header) I/Q samples. Returns false if the block is inconsistent. */
+    static bool decode(const quint8 *block, unsigned int blockSize, unsigned int sampleBytes, quint8 *samples);
+
+private:
+    unsigned int m_sampleBytes;
+    unsigned int m_shift;
+    std::vector<quint32> m_residuals; //!< of the I or Q samples of a partition
+
+    template<typename T> void encodeSamples(const T *samples, unsigned int nbSamples, std::vector<quint8>& block);
+    template<typename T> static bool decodeSamples(const quint8 *data, unsigned int nbBytes, unsigned int nbSamples, unsigned int shift, T *samples);
+};
+
+#endif // SDRBASE_DSP_IQCODEC_H
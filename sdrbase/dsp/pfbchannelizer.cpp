@@ -0,0 +1,224 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "dsp/dspengine.h"
+#include "dsp/fftfactory.h"
+#include "dsp/fftengine.h"
+#include "dsp/channelsamplesink.h"
+#include "dsp/wfir.h"
+#include "pfbchannelizer.h"
+
+PFBChannelizer::PFBChannelizer() :
+    m_nbChannels(0),
+    m_nbTaps(0),
+    m_basebandSampleRate(0),
+    m_delayIndex(0),
+    m_inCount(0),
+    m_fft(nullptr),
+    m_fftSequence(0)
+{
+}
+
+PFBChannelizer::~PFBChannelizer()
+{
+    releaseFFT();
+}
+
+void PFBChannelizer::configure(unsigned int nbChannels, unsigned int nbTapsPerChannel, int basebandSampleRate)
+{
+    if ((nbChannels < 2) || ((nbChannels & (nbChannels - 1)) != 0) || (nbTapsPerChannel == 0))
+    {
+        qWarning("PFBChannelizer::configure: invalid number of channels (%u) or taps (%u)", nbChannels, nbTapsPerChannel);
+        return;
+    }
+
+    releaseFFT();
+
+    m_nbChannels = nbChannels;
+    m_nbTaps = nbTapsPerChannel;
+    m_basebandSampleRate = basebandSampleRate;
+
+    // prototype low pass with a cutoff at half the channel bandwidth and unity gain at DC
+    unsigned int nbTaps = m_nbChannels * m_nbTaps;
+    std::vector<double> prototype(nbTaps);
+    WFIR::BasicFIR(prototype.data(), nbTaps, WFIR::LPF, 1.0 / m_nbChannels, 0.0, WFIR::wtBLACKMAN_HARRIS, 0.0);
+    double sum = 0.0;
+
+    for (unsigned int i = 0; i < nbTaps; i++) {
+        sum += prototype[i];
+    }
+
+    m_taps.resize(nbTaps);
+
+    for (unsigned int p = 0; p < m_nbChannels; p++)
+    {
+        for (unsigned int r = 0; r < m_nbTaps; r++) {
+            m_taps[p*m_nbTaps + r] = prototype[r*m_nbChannels + p] / sum;
+        }
+    }
+
+    m_delays.assign(2 * nbTaps, Complex{0, 0});
+    m_delayIndex = 0;
+    m_inCount = 0;
+
+    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+    m_fftSequence = fftFactory->getEngine(m_nbChannels, true, &m_fft);
+
+    for (std::vector<BinSink>::iterator it = m_binSinks.begin(); it != m_binSinks.end();)
+    {
+        if (it->m_bin >= m_nbChannels)
+        {
+            qWarning("PFBChannelizer::configure: detach sink from bin %u", it->m_bin);
+            it = m_binSinks.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    qDebug("PFBChannelizer::configure: channels: %u taps per channel: %u baseband: %d channel: %d",
+        m_nbChannels, m_nbTaps, m_basebandSampleRate, getChannelSampleRate());
+}
+
+void PFBChannelizer::releaseFFT()
+{
+    if (m_fft)
+    {
+        FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+        fftFactory->releaseEngine(m_nbChannels, true, m_fftSequence);
+        m_fft = nullptr;
+    }
+}
+
+bool PFBChannelizer::attach(unsigned int bin, ChannelSampleSink *sink)
+{
+    if (bin >= m_nbChannels) {
+        return false;
+    }
+
+    detach(sink);
+    m_binSinks.push_back(BinSink(bin, sink));
+    return true;
+}
+
+void PFBChannelizer::detach(ChannelSampleSink *sink)
+{
+    for (std::vector<BinSink>::iterator it = m_binSinks.begin(); it != m_binSinks.end(); ++it)
+    {
+        if (it->m_sink == sink)
+        {
+            m_binSinks.erase(it);
+            return;
+        }
+    }
+}
+
+int PFBChannelizer::getChannelFrequencyOffset(unsigned int bin) const
+{
+    if (m_nbChannels == 0) {
+        return 0;
+    }
+
+    int k = bin < m_nbChannels/2 ? (int) bin : (int) bin - (int) m_nbChannels;
+    return (int) (((qint64) k * m_basebandSampleRate) / m_nbChannels);
+}
+
+unsigned int PFBChannelizer::getBin(qint64 frequencyOffset) const
+{
+    if ((m_nbChannels == 0) || (m_basebandSampleRate == 0)) {
+        return 0;
+    }
+
+    qint64 channelRate = m_basebandSampleRate / m_nbChannels;
+    qint64 k = (frequencyOffset + (frequencyOffset < 0 ? -channelRate/2 : channelRate/2)) / channelRate;
+    return (unsigned int) ((k % (qint64) m_nbChannels + m_nbChannels) % m_nbChannels);
+}
+
+void PFBChannelizer::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    if (!m_fft) {
+        return;
+    }
+
+    for (SampleVector::const_iterator it = begin; it != end; ++it)
+    {
+        if (m_inCount == 0) { // new block: move delay lines one sample in the past
+            m_delayIndex = m_delayIndex == 0 ? m_nbTaps - 1 : m_delayIndex - 1;
+        }
+
+        // commutator: the last sample of a block goes to branch 0
+        unsigned int branch = m_nbChannels - 1 - m_inCount;
+        Complex c(it->real(), it->imag());
+        m_delays[2*m_nbTaps*branch + m_delayIndex] = c;
+        m_delays[2*m_nbTaps*branch + m_delayIndex + m_nbTaps] = c;
+
+        if (++m_inCount == m_nbChannels)
+        {
+            processBlock();
+            m_inCount = 0;
+        }
+    }
+
+    for (std::vector<BinSink>::iterator it = m_binSinks.begin(); it != m_binSinks.end(); ++it)
+    {
+        it->m_sink->feed(it->m_samples.begin(), it->m_samples.end());
+        it->m_samples.clear();
+    }
+}
+
+void PFBChannelizer::processBlock()
+{
+    Complex *fftIn = m_fft->in();
+
+    for (unsigned int p = 0; p < m_nbChannels; p++)
+    {
+        const Complex *delay = &m_delays[2*m_nbTaps*p + m_delayIndex];
+        const Real *taps = &m_taps[m_nbTaps*p];
+        Real re = 0, im = 0;
+
+        for (unsigned int r = 0; r < m_nbTaps; r++)
+        {
+            re += taps[r] * delay[r].real();
+            im += taps[r] * delay[r].imag();
+        }
+
+        fftIn[p] = Complex(re, im);
+    }
+
+    // inverse (non normalized) transform brings channel k down to DC in bin k
+    m_fft->transform();
+    const Complex *fftOut = m_fft->out();
+
+    for (std::vector<BinSink>::iterator it = m_binSinks.begin(); it != m_binSinks.end(); ++it) {
+        it->m_samples.push_back(Sample(saturate(fftOut[it->m_bin].real()), saturate(fftOut[it->m_bin].imag())));
+    }
+}
+
+FixReal PFBChannelizer::saturate(Real v)
+{
+    if (v >= SDR_RX_SCALEF - 1.0f) {
+        return (FixReal) (SDR_RX_SCALEF - 1.0f);
+    } else if (v <= -SDR_RX_SCALEF) {
+        return (FixReal) -SDR_RX_SCALEF;
+    } else {
+        return (FixReal) v;
+    }
+}
@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Polyphase filter bank channelizer. Splits the baseband into N uniformly       //
+// spaced channels of bandwidth baseband rate / N at once.                       //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_PFBCHANNELIZER_H
+#define SDRBASE_DSP_PFBCHANNELIZER_H
+
+#include <vector>
+
+#include "export.h"
+#include "dsp/dsptypes.h"
+
+class ChannelSampleSink;
+class FFTEngine;
+
+/**
+ * Critically sampled analysis filter bank: every N baseband samples the N polyphase branches of
+ * a windowed sinc prototype low pass filter are run then an N points FFT gives one sample of
+ * each of the N channels. Channel (bin) k is centered at k * baseband rate / N (bins above N/2
+ * are negative frequencies) and its sample rate is baseband rate / N.
+ *
+ * The cost per baseband sample is the number of taps per branch plus log2(N) whatever the
+ * number of channels used. Sinks attached to a bin receive its samples. Configuration and
+ * attachment must be done from the thread calling feed() or while it is not running.
+ */
+class SDRBASE_API PFBChannelizer
+{
+public:
+    PFBChannelizer();
+    ~PFBChannelizer();
+
+    void configure(unsigned int nbChannels, unsigned int nbTapsPerChannel, int basebandSampleRate); //!< nbChannels must be a power of 2
+    void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+
+    bool attach(unsigned int bin, ChannelSampleSink *sink); //!< returns false if bin does not exist
+    void detach(ChannelSampleSink *sink);
+
+    unsigned int getNbChannels() const { return m_nbChannels; }
+    int getBasebandSampleRate() const { return m_basebandSampleRate; }
+    int getChannelSampleRate() const { return m_nbChannels == 0 ? 0 : m_basebandSampleRate / m_nbChannels; }
+    int getChannelFrequencyOffset(unsigned int bin) const; //!< center of the bin relative to the baseband center
+    unsigned int getBin(qint64 frequencyOffset) const;     //!< nearest bin to a frequency relative to the baseband center
+
+private:
+    struct BinSink
+    {
+        unsigned int m_bin;
+        ChannelSampleSink *m_sink;
+        SampleVector m_samples; //!< output of the current feed
+
+        BinSink(unsigned int bin, ChannelSampleSink *sink) :
+            m_bin(bin),
+            m_sink(sink)
+        {}
+    };
+
+    unsigned int m_nbChannels;
+    unsigned int m_nbTaps;         //!< taps per polyphase branch
+    int m_basebandSampleRate;
+    std::vector<Real> m_taps;      //!< prototype filter in branch order: branch p tap r is h[r*N + p]
+    std::vector<Complex> m_delays; //!< branch delay lines as double buffers of 2 * m_nbTaps samples
+    unsigned int m_delayIndex;     //!< position of the newest sample in the delay lines
+    unsigned int m_inCount;        //!< number of samples received in the current block
+    FFTEngine *m_fft;
+    unsigned int m_fftSequence;
+    std::vector<BinSink> m_binSinks;
+
+    void releaseFFT();
+    void processBlock();
+    static FixReal saturate(Real v); //!< channel outputs may exceed the FixReal range
+};
+
+#endif // SDRBASE_DSP_PFBCHANNELIZER_H
@@ -0,0 +1,51 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SAMPLEFIFOSTATS_H_
+#define SDRBASE_DSP_SAMPLEFIFOSTATS_H_
+
+#include <QtGlobal>
+
+/**
+ * Counters of a sample FIFO since it was last sized. Counters are cumulative so that
+ * the figures of a time interval are obtained by difference of two snapshots.
+ */
+struct SampleFifoStats
+{
+    unsigned int m_size;          //!< FIFO size in samples
+    unsigned int m_fill;          //!< current fill
+    unsigned int m_highWaterMark; //!< highest fill seen by the writer
+    quint64 m_nbWritten;          //!< samples written
+    quint64 m_nbDropped;          //!< samples dropped on overflow
+    quint64 m_nbOverflows;        //!< writes that dropped samples
+    quint64 m_nbRead;             //!< samples processed by the reader
+    qint64 m_readNsecs;           //!< time spent by the reader between readBegin and readCommit i.e. processing the samples. Only counted when DSPMetrics is enabled.
+
+    SampleFifoStats() :
+        m_size(0),
+        m_fill(0),
+        m_highWaterMark(0),
+        m_nbWritten(0),
+        m_nbDropped(0),
+        m_nbOverflows(0),
+        m_nbRead(0),
+        m_readNsecs(0)
+    {}
+};
+
+#endif // SDRBASE_DSP_SAMPLEFIFOSTATS_H_
@@ -20,27 +20,16 @@
 #define INCLUDE_SAMPLEFIFO_H
 
 #include <QObject>
-#include <QMutex>
-#include <QElapsedTimer>
 #include "dsp/dsptypes.h"
+#include "dsp/samplefifostats.h"
+#include "dsp/samplesinkfiforing.h"
 #include "export.h"
 
 class SDRBASE_API SampleSinkFifo : public QObject {
 	Q_OBJECT
 
 private:
-	QMutex m_mutex;
-	QElapsedTimer m_msgRateTimer;
-	int m_suppressed;
-
-	SampleVector m_data;
-
-	unsigned int m_size;
-	unsigned int m_fill;
-	unsigned int m_head;
-	unsigned int m_tail;
-
-	void create(unsigned int s);
+	SampleSinkFifoRing<Sample> m_ring;
 
 public:
 	SampleSinkFifo(QObject* parent = nullptr);
@@ -48,22 +37,36 @@ public:
     SampleSinkFifo(const SampleSinkFifo& other);
 	~SampleSinkFifo();
 
-	bool setSize(int size);
-    void reset();
-	inline unsigned int size() const { return m_size; }
-	inline unsigned int fill() { QMutexLocker mutexLocker(&m_mutex); unsigned int fill = m_fill; return fill; }
+	bool setSize(int size) { return m_ring.setSize(size); }
+    void reset() { m_ring.reset(); }
+	inline unsigned int size() const { return m_ring.size(); }
+	inline unsigned int fill() { return m_ring.fill(); }
+	/**
+	 * Lock free mode is only valid with exactly one writer thread and one reader thread
+	 * (e.g. device engine thread writing and channel baseband thread reading).
+	 * The reader never takes the mutex and the writer only tries it to guard against
+	 * a concurrent setSize() that must then be called from the reader thread.
+	 * reset() must not be called while the reader is active.
+	 */
+	void setLockFree(bool lockFree) { m_ring.setLockFree(lockFree); }
+	bool getLockFree() const { return m_ring.getLockFree(); }
 
 	unsigned int write(const quint8* data, unsigned int count);
 	unsigned int write(SampleVector::const_iterator begin, SampleVector::const_iterator end);
 
-	unsigned int read(SampleVector::iterator begin, SampleVector::iterator end);
+	unsigned int read(SampleVector::iterator begin, SampleVector::iterator end) { return m_ring.read(begin, end); }
 
 	unsigned int readBegin(unsigned int count,
 		SampleVector::iterator* part1Begin, SampleVector::iterator* part1End,
-		SampleVector::iterator* part2Begin, SampleVector::iterator* part2End);
-	unsigned int readCommit(unsigned int count);
+		SampleVector::iterator* part2Begin, SampleVector::iterator* part2End)
+	{
+		return m_ring.readBegin(count, part1Begin, part1End, part2Begin, part2End);
+	}
+	unsigned int readCommit(unsigned int count) { return m_ring.readCommit(count); }
     static unsigned int getSizePolicy(unsigned int sampleRate);
 
+	void getStats(SampleFifoStats& stats) const { m_ring.getStats(stats); } //!< can be called from any thread
+
 signals:
 	void dataReady();
 };
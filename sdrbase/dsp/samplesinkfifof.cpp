@@ -0,0 +1,47 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "samplesinkfifof.h"
+
+SampleSinkFifoF::SampleSinkFifoF(QObject* parent) :
+	QObject(parent),
+	m_ring("SampleSinkFifoF", 0)
+{
+}
+
+SampleSinkFifoF::SampleSinkFifoF(int size, QObject* parent) :
+	QObject(parent),
+	m_ring("SampleSinkFifoF", size)
+{
+}
+
+SampleSinkFifoF::~SampleSinkFifoF()
+{
+}
+
+unsigned int SampleSinkFifoF::write(FSampleVector::const_iterator begin, FSampleVector::const_iterator end)
+{
+	unsigned int fill;
+	unsigned int total = m_ring.write(begin, end - begin, fill);
+
+	if (fill > 0) {
+		emit dataReady();
+	}
+
+	return total;
+}
@@ -0,0 +1,69 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Float samples (FSample) variant of SampleSinkFifo for the float pipeline      //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SAMPLESINKFIFOF_H_
+#define SDRBASE_DSP_SAMPLESINKFIFOF_H_
+
+#include <QObject>
+
+#include "dsp/dsptypes.h"
+#include "dsp/samplefifostats.h"
+#include "dsp/samplesinkfiforing.h"
+#include "export.h"
+
+/**
+ * Same behavior as SampleSinkFifo (overflow policy, lock free single producer single consumer mode,
+ * statistics) on FSample as both share SampleSinkFifoRing. Samples are normalized to full scale 1.0.
+ */
+class SDRBASE_API SampleSinkFifoF : public QObject {
+	Q_OBJECT
+
+public:
+	SampleSinkFifoF(QObject* parent = nullptr);
+	SampleSinkFifoF(int size, QObject* parent = nullptr);
+	~SampleSinkFifoF();
+
+	bool setSize(int size) { return m_ring.setSize(size); }
+	void reset() { m_ring.reset(); }
+	inline unsigned int size() const { return m_ring.size(); }
+	inline unsigned int fill() { return m_ring.fill(); }
+	void setLockFree(bool lockFree) { m_ring.setLockFree(lockFree); } //!< see SampleSinkFifo::setLockFree
+	bool getLockFree() const { return m_ring.getLockFree(); }
+
+	unsigned int write(FSampleVector::const_iterator begin, FSampleVector::const_iterator end);
+
+	unsigned int readBegin(unsigned int count,
+		FSampleVector::iterator* part1Begin, FSampleVector::iterator* part1End,
+		FSampleVector::iterator* part2Begin, FSampleVector::iterator* part2End)
+	{
+		return m_ring.readBegin(count, part1Begin, part1End, part2Begin, part2End);
+	}
+	unsigned int readCommit(unsigned int count) { return m_ring.readCommit(count); }
+
+	void getStats(SampleFifoStats& stats) const { m_ring.getStats(stats); } //!< can be called from any thread
+
+signals:
+	void dataReady();
+
+private:
+	SampleSinkFifoRing<FSample> m_ring;
+};
+
+#endif // SDRBASE_DSP_SAMPLESINKFIFOF_H_
@@ -0,0 +1,334 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Ring buffer of SampleSinkFifo and SampleSinkFifoF on their sample type        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SAMPLESINKFIFORING_H_
+#define SDRBASE_DSP_SAMPLESINKFIFORING_H_
+
+#include <algorithm>
+#include <vector>
+
+#include <QMutex>
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include <QDebug>
+
+#include "dsp/dspmetrics.h"
+#include "dsp/samplefifostats.h"
+
+/**
+ * Storage, overflow policy, lock free mode and statistics of the sample sink FIFOs. SampleSinkFifo
+ * (Sample) and SampleSinkFifoF (FSample) wrap it in a QObject to signal the new data as a template
+ * cannot declare Qt signals.
+ *
+ * Overflows drop the newest samples and are logged at most every 2.5s. Lock free mode is only valid
+ * with exactly one writer thread and one reader thread. The reader never takes the mutex and the writer
+ * only tries it to guard against a concurrent setSize() that must then be called from the reader thread.
+ */
+template<typename T>
+class SampleSinkFifoRing
+{
+public:
+    typedef typename std::vector<T>::iterator iterator;
+
+    SampleSinkFifoRing(const char *name, unsigned int size) :
+        m_name(name),
+        m_suppressed(-1),
+        m_lockFree(false)
+    {
+        create(size);
+    }
+
+    ~SampleSinkFifoRing()
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        m_size = 0;
+    }
+
+    bool setSize(unsigned int size)
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        create(size);
+        return m_data.size() == size;
+    }
+
+    void reset()
+    {
+        m_suppressed = -1;
+        m_fill = 0;
+        m_head = 0;
+        m_tail = 0;
+    }
+
+    unsigned int size() const { return m_size; }
+    unsigned int fill() const { return (unsigned int) m_fill.loadAcquire(); }
+    void setLockFree(bool lockFree) { m_lockFree = lockFree; }
+    bool getLockFree() const { return m_lockFree; }
+
+    /** Writes what fits of count samples and returns the number written. fill is the fill after the write. */
+    template<typename InputIterator>
+    unsigned int write(InputIterator begin, unsigned int count, unsigned int& fill);
+    unsigned int read(iterator begin, iterator end); //!< copies and commits
+    unsigned int readBegin(unsigned int count, iterator* part1Begin, iterator* part1End, iterator* part2Begin, iterator* part2End);
+    unsigned int readCommit(unsigned int count);
+    void getStats(SampleFifoStats& stats) const;
+
+private:
+    const char *m_name; //!< for the log messages
+    QMutex m_mutex;
+    QElapsedTimer m_msgRateTimer;
+    int m_suppressed;
+    bool m_lockFree;
+
+    std::vector<T> m_data;
+
+    unsigned int m_size;
+    QAtomicInt m_fill;   //!< shared between producer and consumer
+    unsigned int m_head; //!< owned by the consumer (read side)
+    unsigned int m_tail; //!< owned by the producer (write side)
+
+    QElapsedTimer m_statsTimer;
+    QAtomicInteger<quint64> m_nbWritten;   //!< written by the producer
+    QAtomicInteger<quint64> m_nbDropped;   //!< written by the producer
+    QAtomicInteger<quint64> m_nbOverflows; //!< written by the producer
+    QAtomicInt m_highWaterMark;            //!< written by the producer
+    QAtomicInteger<quint64> m_nbRead;      //!< written by the consumer
+    QAtomicInteger<qint64> m_readNsecs;    //!< written by the consumer
+    qint64 m_readStart;                    //!< owned by the consumer. Negative if the read is not timed.
+
+    void create(unsigned int size);
+    bool lockWrite();
+    void updateWriteStats(unsigned int count, unsigned int total, unsigned int fill);
+};
+
+template<typename T>
+void SampleSinkFifoRing<T>::create(unsigned int size)
+{
+    m_size = 0;
+    m_fill = 0;
+    m_head = 0;
+    m_tail = 0;
+
+    m_data.resize(size);
+    m_size = m_data.size();
+
+    m_nbWritten = 0;
+    m_nbDropped = 0;
+    m_nbOverflows = 0;
+    m_highWaterMark = 0;
+    m_nbRead = 0;
+    m_readNsecs = 0;
+    m_readStart = -1;
+    m_statsTimer.start();
+}
+
+template<typename T>
+bool SampleSinkFifoRing<T>::lockWrite()
+{
+    if (m_lockFree) {
+        return m_mutex.tryLock(); // only contended by setSize() so the writer never waits
+    }
+
+    m_mutex.lock();
+    return true;
+}
+
+template<typename T>
+template<typename InputIterator>
+unsigned int SampleSinkFifoRing<T>::write(InputIterator begin, unsigned int count, unsigned int& fill)
+{
+    if (!lockWrite()) // FIFO is being resized
+    {
+        updateWriteStats(count, 0, 0); // the samples are dropped
+        fill = 0;
+        return 0;
+    }
+
+    unsigned int total = std::min(count, m_size - this->fill());
+
+    if (total < count)
+    {
+        if (m_suppressed < 0)
+        {
+            m_suppressed = 0;
+            m_msgRateTimer.start();
+            qCritical("%s::write: overflow - dropping %u samples", m_name, count - total);
+        }
+        else if (m_msgRateTimer.elapsed() > 2500)
+        {
+            qCritical("%s::write: %u messages dropped", m_name, m_suppressed);
+            qCritical("%s::write: overflow - dropping %u samples", m_name, count - total);
+            m_suppressed = -1;
+        }
+        else
+        {
+            m_suppressed++;
+        }
+    }
+
+    unsigned int remaining = total;
+
+    while (remaining > 0)
+    {
+        unsigned int len = std::min(remaining, m_size - m_tail);
+        std::copy(begin, begin + len, m_data.begin() + m_tail);
+        m_tail += len;
+        m_tail %= m_size;
+        begin += len;
+        remaining -= len;
+    }
+
+    // publish the new samples to the reader only once they are copied
+    fill = m_fill.fetchAndAddRelease(total) + total;
+    updateWriteStats(count, total, fill);
+    m_mutex.unlock();
+
+    return total;
+}
+
+template<typename T>
+void SampleSinkFifoRing<T>::updateWriteStats(unsigned int count, unsigned int total, unsigned int fill)
+{
+    m_nbWritten.fetchAndAddRelaxed(total);
+
+    if (total < count)
+    {
+        m_nbDropped.fetchAndAddRelaxed(count - total);
+        m_nbOverflows.fetchAndAddRelaxed(1);
+    }
+
+    if ((int) fill > m_highWaterMark.loadAcquire()) {
+        m_highWaterMark.storeRelease(fill);
+    }
+}
+
+template<typename T>
+unsigned int SampleSinkFifoRing<T>::read(iterator begin, iterator end)
+{
+    QMutexLocker mutexLocker(m_lockFree ? nullptr : &m_mutex);
+    unsigned int count = end - begin;
+    unsigned int total = std::min(count, fill());
+
+    if (total < count) {
+        qCritical("%s::read: underflow - missing %u samples", m_name, count - total);
+    }
+
+    unsigned int remaining = total;
+
+    while (remaining > 0)
+    {
+        unsigned int len = std::min(remaining, m_size - m_head);
+        std::copy(m_data.begin() + m_head, m_data.begin() + m_head + len, begin);
+        m_head += len;
+        m_head %= m_size;
+        begin += len;
+        remaining -= len;
+    }
+
+    // release the slots to the writer only once they are copied
+    m_fill.fetchAndSubRelease(total);
+    m_nbRead.fetchAndAddRelaxed(total);
+
+    return total;
+}
+
+template<typename T>
+unsigned int SampleSinkFifoRing<T>::readBegin(unsigned int count,
+    iterator* part1Begin, iterator* part1End,
+    iterator* part2Begin, iterator* part2End)
+{
+    QMutexLocker mutexLocker(m_lockFree ? nullptr : &m_mutex);
+    unsigned int head = m_head;
+
+    m_readStart = DSPMetrics::isEnabled() ? m_statsTimer.nsecsElapsed() : -1;
+    unsigned int total = std::min(count, fill());
+
+    if (total < count) {
+        qCritical("%s::readBegin: underflow - missing %u samples", m_name, count - total);
+    }
+
+    unsigned int remaining = total;
+
+    if (remaining > 0)
+    {
+        unsigned int len = std::min(remaining, m_size - head);
+        *part1Begin = m_data.begin() + head;
+        *part1End = m_data.begin() + head + len;
+        head += len;
+        head %= m_size;
+        remaining -= len;
+    }
+    else
+    {
+        *part1Begin = m_data.end();
+        *part1End = m_data.end();
+    }
+
+    if (remaining > 0)
+    {
+        unsigned int len = std::min(remaining, m_size - head);
+        *part2Begin = m_data.begin() + head;
+        *part2End = m_data.begin() + head + len;
+    }
+    else
+    {
+        *part2Begin = m_data.end();
+        *part2End = m_data.end();
+    }
+
+    return total;
+}
+
+template<typename T>
+unsigned int SampleSinkFifoRing<T>::readCommit(unsigned int count)
+{
+    QMutexLocker mutexLocker(m_lockFree ? nullptr : &m_mutex);
+    unsigned int fill = this->fill();
+
+    if (count > fill)
+    {
+        qCritical("%s::readCommit: cannot commit more than available samples", m_name);
+        count = fill;
+    }
+
+    m_head = (m_head + count) % m_size;
+    m_fill.fetchAndSubRelease(count);
+    m_nbRead.fetchAndAddRelaxed(count);
+
+    if (m_readStart >= 0) {
+        m_readNsecs.fetchAndAddRelaxed(m_statsTimer.nsecsElapsed() - m_readStart);
+    }
+
+    return count;
+}
+
+template<typename T>
+void SampleSinkFifoRing<T>::getStats(SampleFifoStats& stats) const
+{
+    stats.m_size = m_size;
+    stats.m_fill = m_fill.loadAcquire();
+    stats.m_highWaterMark = m_highWaterMark.loadAcquire();
+    stats.m_nbWritten = m_nbWritten.loadAcquire();
+    stats.m_nbDropped = m_nbDropped.loadAcquire();
+    stats.m_nbOverflows = m_nbOverflows.loadAcquire();
+    stats.m_nbRead = m_nbRead.loadAcquire();
+    stats.m_readNsecs = m_readNsecs.loadAcquire();
+}
+
+#endif // SDRBASE_DSP_SAMPLESINKFIFORING_H_
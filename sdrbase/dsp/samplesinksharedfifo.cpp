@@ -0,0 +1,255 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include "dspmetrics.h"
+#include "samplesinksharedfifo.h"
+
+SampleSinkSharedFifo::SampleSinkSharedFifo(QObject* parent) :
+    QObject(parent),
+    m_size(0),
+    m_tail(0),
+    m_nbReaders(0)
+{
+    m_statsTimer.start();
+}
+
+SampleSinkSharedFifo::~SampleSinkSharedFifo()
+{}
+
+bool SampleSinkSharedFifo::setSize(unsigned int size)
+{
+    m_data.resize(size);
+    m_size = m_data.size();
+    m_tail = 0;
+
+    for (int i = 0; i < m_maxNbReaders; i++)
+    {
+        m_readers[i].m_head = 0;
+        m_readers[i].resetStats();
+    }
+
+    return m_size == size;
+}
+
+int SampleSinkSharedFifo::registerReader()
+{
+    for (int i = 0; i < m_maxNbReaders; i++)
+    {
+        if (!m_readers[i].m_active)
+        {
+            m_readers[i].m_head.storeRelease(m_tail.loadAcquire()); // start with an empty FIFO
+            m_readers[i].resetStats();
+            m_readers[i].m_active = true;
+            m_nbReaders++;
+            return i;
+        }
+    }
+
+    qWarning("SampleSinkSharedFifo::registerReader: maximum number of readers (%d) reached", m_maxNbReaders);
+    return -1;
+}
+
+void SampleSinkSharedFifo::unregisterReader(int readerIndex)
+{
+    if ((readerIndex < 0) || (readerIndex >= m_maxNbReaders) || !m_readers[readerIndex].m_active) {
+        return;
+    }
+
+    m_readers[readerIndex].m_active = false;
+    m_nbReaders--;
+}
+
+unsigned int SampleSinkSharedFifo::write(SampleVector::const_iterator begin, SampleVector::const_iterator end)
+{
+    if ((m_size == 0) || (m_nbReaders == 0)) {
+        return 0;
+    }
+
+    quint64 tail = m_tail.loadAcquire();
+    unsigned int count = end - begin;
+
+    if (count > m_size) // only the last samples fit in the FIFO
+    {
+        tail += count - m_size;
+        begin += count - m_size;
+    }
+
+    unsigned int remaining = std::min(count, m_size);
+    unsigned int index = tail % m_size;
+
+    while (remaining > 0)
+    {
+        unsigned int len = std::min(remaining, m_size - index);
+        std::copy(begin, begin + len, m_data.begin() + index);
+        index = (index + len) % m_size;
+        begin += len;
+        remaining -= len;
+    }
+
+    // publish the new samples to all readers only once they are copied
+    tail += std::min(count, m_size);
+    m_tail.storeRelease(tail);
+
+    for (int i = 0; i < m_maxNbReaders; i++)
+    {
+        if (m_readers[i].m_active)
+        {
+            Reader& reader = m_readers[i];
+            quint64 readerFill = tail - reader.m_head.loadAcquire();
+            unsigned int fill = readerFill < m_size ? (unsigned int) readerFill : m_size;
+            reader.m_nbWritten.fetchAndAddRelaxed(count);
+
+            if (fill > reader.m_highWaterMark.loadAcquire()) {
+                reader.m_highWaterMark.storeRelease(fill);
+            }
+        }
+    }
+
+    if (count > 0) {
+        emit dataReady();
+    }
+
+    return count;
+}
+
+unsigned int SampleSinkSharedFifo::maxFill() const
+{
+    unsigned int maxFill = 0;
+
+    for (int i = 0; i < m_maxNbReaders; i++)
+    {
+        if (m_readers[i].m_active) {
+            maxFill = std::max(maxFill, fill(i));
+        }
+    }
+
+    return maxFill;
+}
+
+unsigned int SampleSinkSharedFifo::readBegin(int readerIndex, unsigned int count,
+    SampleVector::iterator* part1Begin, SampleVector::iterator* part1End,
+    SampleVector::iterator* part2Begin, SampleVector::iterator* part2End)
+{
+    Reader& reader = m_readers[readerIndex];
+    quint64 tail = m_tail.loadAcquire();
+    quint64 readerHead = reader.m_head.loadAcquire();
+
+    if (tail - readerHead > m_size) // overrun by the writer: skip forward leaving half the FIFO as margin
+    {
+        quint64 skipped = tail - (m_size / 2) - readerHead;
+        reader.m_head.storeRelease(readerHead + skipped);
+        reader.m_nbDropped.fetchAndAddRelaxed(skipped);
+        reader.m_nbOverflows.fetchAndAddRelaxed(1);
+        qCritical("SampleSinkSharedFifo::readBegin: reader %d overrun - dropping %llu samples", readerIndex, skipped);
+        count = std::min(count, m_size / 2); // the count was based on the fill before skipping
+    }
+
+    unsigned int total = std::min(count, fill(readerIndex));
+    unsigned int remaining = total;
+    unsigned int head = 0;
+    unsigned int len;
+
+    m_readers[readerIndex].m_readStart = DSPMetrics::isEnabled() ? m_statsTimer.nsecsElapsed() : -1;
+
+    if (total < count) {
+        qCritical("SampleSinkSharedFifo::readBegin: underflow - missing %u samples", count - total);
+    }
+
+    m_readers[readerIndex].m_readHead = m_readers[readerIndex].m_head.loadAcquire();
+
+    if (remaining > 0)
+    {
+        head = m_readers[readerIndex].m_readHead % m_size;
+        len = std::min(remaining, m_size - head);
+        *part1Begin = m_data.begin() + head;
+        *part1End = m_data.begin() + head + len;
+        head += len;
+        head %= m_size;
+        remaining -= len;
+    }
+    else
+    {
+        *part1Begin = m_data.end();
+        *part1End = m_data.end();
+    }
+
+    if (remaining > 0)
+    {
+        len = std::min(remaining, m_size - head);
+        *part2Begin = m_data.begin() + head;
+        *part2End = m_data.begin() + head + len;
+    }
+    else
+    {
+        *part2Begin = m_data.end();
+        *part2End = m_data.end();
+    }
+
+    return total;
+}
+
+unsigned int SampleSinkSharedFifo::readCommit(int readerIndex, unsigned int count)
+{
+    unsigned int fill = this->fill(readerIndex);
+
+    if (count > fill)
+    {
+        qCritical("SampleSinkSharedFifo::readCommit: cannot commit more than available samples");
+        count = fill;
+    }
+
+    // the writer does not wait for the readers: samples of [head, head + count) it may have
+    // overwritten while they were processed are counted as dropped
+    Reader& reader = m_readers[readerIndex];
+    quint64 overwrite = m_tail.loadAcquire() - reader.m_readHead;
+
+    if (overwrite > m_size)
+    {
+        quint64 overwritten = std::min((quint64) count, overwrite - m_size);
+        reader.m_nbDropped.fetchAndAddRelaxed(overwritten);
+        reader.m_nbOverflows.fetchAndAddRelaxed(1);
+        qCritical("SampleSinkSharedFifo::readCommit: reader %d overrun while reading - %llu samples overwritten", readerIndex, overwritten);
+    }
+
+    reader.m_head.fetchAndAddRelease(count);
+    reader.m_nbRead.fetchAndAddRelaxed(count);
+
+    if (reader.m_readStart >= 0) {
+        reader.m_readNsecs.fetchAndAddRelaxed(m_statsTimer.nsecsElapsed() - reader.m_readStart);
+    }
+
+    return count;
+}
+
+void SampleSinkSharedFifo::getStats(int readerIndex, SampleFifoStats& stats) const
+{
+    if ((readerIndex < 0) || (readerIndex >= m_maxNbReaders)) {
+        return;
+    }
+
+    const Reader& reader = m_readers[readerIndex];
+    stats.m_size = m_size;
+    stats.m_fill = fill(readerIndex);
+    stats.m_highWaterMark = reader.m_highWaterMark.loadAcquire();
+    stats.m_nbWritten = reader.m_nbWritten.loadAcquire();
+    stats.m_nbDropped = reader.m_nbDropped.loadAcquire();
+    stats.m_nbOverflows = reader.m_nbOverflows.loadAcquire();
+    stats.m_nbRead = reader.m_nbRead.loadAcquire();
+    stats.m_readNsecs = reader.m_readNsecs.loadAcquire();
+}
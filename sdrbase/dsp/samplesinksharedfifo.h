@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Single writer multiple readers sample FIFO. The device engine writes the      //
+// baseband samples once and each channel reads them with its own cursor.        //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_SAMPLESINKSHAREDFIFO_H
+#define INCLUDE_SAMPLESINKSHAREDFIFO_H
+
+#include <QObject>
+#include <QAtomicInteger>
+#include <QElapsedTimer>
+
+#include "dsp/dsptypes.h"
+#include "dsp/samplefifostats.h"
+#include "export.h"
+
+/**
+ * Samples are written once in a ring buffer that is read without copy by several readers each
+ * having its own read cursor. Readers are identified by the index returned at registration.
+ * The writer never waits for the readers. A reader that falls more than the FIFO size behind
+ * is overrun: at its next readBegin() it skips forward to half the FIFO size behind the writer
+ * and counts the skipped samples as dropped in its own statistics. The other readers lose nothing.
+ * Samples that a reader is processing are only overwritten when this reader is overrun during its
+ * processing. They are then counted as dropped at readCommit() as their values are not reliable.
+ *
+ * Readers never take a lock. setSize(), registerReader() and unregisterReader() must be called
+ * from the writer thread and setSize() only when no reader is active.
+ */
+class SDRBASE_API SampleSinkSharedFifo : public QObject {
+    Q_OBJECT
+
+public:
+    SampleSinkSharedFifo(QObject* parent = nullptr);
+    ~SampleSinkSharedFifo();
+
+    bool setSize(unsigned int size);
+    unsigned int size() const { return m_size; }
+    unsigned int getNbReaders() const { return m_nbReaders; }
+
+    int registerReader();                 //!< returns reader index or -1 if no more readers can be accepted
+    void unregisterReader(int readerIndex);
+
+    unsigned int write(SampleVector::const_iterator begin, SampleVector::const_iterator end);
+
+    unsigned int fill(int readerIndex) const //!< at most the FIFO size. More has been overrun.
+    {
+        quint64 fill = m_tail.loadAcquire() - m_readers[readerIndex].m_head.loadAcquire();
+        return fill < m_size ? (unsigned int) fill : m_size;
+    }
+
+    unsigned int maxFill() const; //!< fill of the slowest active reader
+
+    unsigned int readBegin(int readerIndex, unsigned int count,
+        SampleVector::iterator* part1Begin, SampleVector::iterator* part1End,
+        SampleVector::iterator* part2Begin, SampleVector::iterator* part2End);
+    unsigned int readCommit(int readerIndex, unsigned int count);
+
+    void getStats(int readerIndex, SampleFifoStats& stats) const; //!< statistics as seen by this reader. Can be called from any thread
+
+    static const int m_maxNbReaders = 64;
+
+signals:
+    void dataReady();
+
+private:
+    struct Reader
+    {
+        bool m_active;                    //!< changed by the writer thread only
+        QAtomicInteger<quint64> m_head;   //!< monotonic read counter owned by the reader
+        QAtomicInteger<quint64> m_nbWritten;      //!< written by the writer
+        QAtomicInteger<quint64> m_nbDropped;      //!< written by the reader when overrun
+        QAtomicInteger<quint64> m_nbOverflows;    //!< written by the reader when overrun
+        QAtomicInteger<unsigned int> m_highWaterMark; //!< written by the writer
+        QAtomicInteger<quint64> m_nbRead;         //!< written by the reader
+        QAtomicInteger<qint64> m_readNsecs;       //!< written by the reader
+        qint64 m_readStart;                       //!< owned by the reader. Negative if the read is not timed.
+        quint64 m_readHead;                       //!< owned by the reader. Head at the last readBegin().
+
+        Reader() : m_active(false), m_head(0), m_nbWritten(0), m_nbDropped(0), m_nbOverflows(0), m_highWaterMark(0), m_nbRead(0), m_readNsecs(0), m_readStart(-1), m_readHead(0) {}
+
+        void resetStats()
+        {
+            m_nbWritten = 0;
+            m_nbDropped = 0;
+            m_nbOverflows = 0;
+            m_highWaterMark = 0;
+            m_nbRead = 0;
+            m_readNsecs = 0;
+        }
+    };
+
+    SampleVector m_data;
+    unsigned int m_size;
+    QAtomicInteger<quint64> m_tail;       //!< monotonic write counter owned by the writer
+    Reader m_readers[m_maxNbReaders];
+    unsigned int m_nbReaders;
+    QElapsedTimer m_statsTimer;
+};
+
+#endif // INCLUDE_SAMPLESINKSHAREDFIFO_H
@@ -0,0 +1,242 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Trigger level comparator of the scope                                         //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SCOPETRIGGERCOMPARATOR_H_
+#define SDRBASE_DSP_SCOPETRIGGERCOMPARATOR_H_
+
+#include <math.h>
+
+#include "dsp/dsptypes.h"
+#include "dsp/projector.h"
+#include "dsp/scopetriggerscanner.h"
+
+/**
+ * Compares the samples to the trigger level of a scope trigger condition. The trigger condition is
+ * ScopeVis::TriggerCondition. It is a template parameter so that the benchmark can check the block
+ * search (skippable) against the per sample comparison (triggered) without the GUI.
+ *
+ * TriggerCondition must have m_projector (Projector), m_prevCondition (bool), m_trues and m_falses
+ * (uint32_t) and m_triggerData with m_triggerLevel (Real), m_triggerHoldoff (uint32_t),
+ * m_triggerBothEdges and m_triggerPositiveEdge (bool).
+ */
+template<typename TriggerCondition>
+class ScopeTriggerComparator
+{
+public:
+    ScopeTriggerComparator() :
+        m_level(0),
+        m_reset(true),
+        m_scanLevel(0),
+        m_scanProjectionType(Projector::nbProjectionTypes),
+        m_scanSupported(false),
+        m_scanMeasure(ScopeTriggerScanner::MeasureReal),
+        m_scanLow(0),
+        m_scanHigh(0)
+    {
+        computeLevels();
+    }
+
+    bool triggered(const Sample& s, TriggerCondition& triggerCondition)
+    {
+        if (triggerCondition.m_triggerData.m_triggerLevel != m_level)
+        {
+            m_level = triggerCondition.m_triggerData.m_triggerLevel;
+            computeLevels();
+        }
+
+        bool condition, trigger;
+
+        if (triggerCondition.m_projector.getProjectionType() == Projector::ProjectionMagDB) {
+            condition = triggerCondition.m_projector.run(s) > m_levelPowerDB;
+        } else if (triggerCondition.m_projector.getProjectionType() == Projector::ProjectionMagLin) {
+            condition = triggerCondition.m_projector.run(s) > m_levelPowerLin;
+        } else {
+            condition = triggerCondition.m_projector.run(s) > m_level;
+        }
+
+        if (condition)
+        {
+            if (triggerCondition.m_trues < triggerCondition.m_triggerData.m_triggerHoldoff) {
+                condition = false;
+                triggerCondition.m_trues++;
+            } else {
+                triggerCondition.m_falses = 0;
+            }
+        }
+        else
+        {
+            if (triggerCondition.m_falses < triggerCondition.m_triggerData.m_triggerHoldoff) {
+                condition = true;
+                triggerCondition.m_falses++;
+            } else {
+                triggerCondition.m_trues = 0;
+            }
+        }
+
+        if (m_reset)
+        {
+            triggerCondition.m_prevCondition = condition;
+            m_reset = false;
+            return false;
+        }
+
+        if (triggerCondition.m_triggerData.m_triggerBothEdges) {
+            trigger = triggerCondition.m_prevCondition ? !condition : condition; // This is a XOR between bools
+        } else if (triggerCondition.m_triggerData.m_triggerPositiveEdge) {
+            trigger = !triggerCondition.m_prevCondition && condition;
+        } else {
+            trigger = triggerCondition.m_prevCondition && !condition;
+        }
+
+//            if (trigger) {
+//                qDebug("ScopeVis::triggered: %s/%s %f/%f",
+//                        triggerCondition.m_prevCondition ? "T" : "F",
+//                        condition ? "T" : "F",
+//                        triggerCondition.m_projector->run(s),
+//                        triggerCondition.m_triggerData.m_triggerLevel);
+//            }
+
+        triggerCondition.m_prevCondition = condition;
+        return trigger;
+    }
+
+    /**
+     * Number of samples from s that would not trigger and would leave the trigger condition as it is
+     * i.e. the raw condition is the same as the previous condition and the holdoff is complete.
+     * These samples can be skipped. Returns 0 when this cannot be decided on the samples values.
+     */
+    int skippable(const Sample *s, int count, TriggerCondition& triggerCondition)
+    {
+        if (m_reset || (count <= 0)) {
+            return 0;
+        }
+
+        Projector::ProjectionType projectionType = triggerCondition.m_projector.getProjectionType();
+
+        if ((triggerCondition.m_triggerData.m_triggerLevel != m_scanLevel) || (projectionType != m_scanProjectionType))
+        {
+            m_scanLevel = triggerCondition.m_triggerData.m_triggerLevel;
+            m_scanProjectionType = projectionType;
+            computeScanLevels();
+        }
+
+        if (!m_scanSupported) {
+            return 0;
+        }
+
+        bool above;
+
+        if (triggerCondition.m_prevCondition && (triggerCondition.m_trues >= triggerCondition.m_triggerData.m_triggerHoldoff)) {
+            above = true;
+        } else if (!triggerCondition.m_prevCondition && (triggerCondition.m_falses >= triggerCondition.m_triggerData.m_triggerHoldoff)) {
+            above = false;
+        } else {
+            return 0; // holdoff in progress
+        }
+
+        int n = ScopeTriggerScanner::scan(s, count, m_scanMeasure, m_scanLow, m_scanHigh, above);
+
+        if (n > 0) // what triggered() would have done on these samples
+        {
+            if (above) {
+                triggerCondition.m_falses = 0;
+            } else {
+                triggerCondition.m_trues = 0;
+            }
+        }
+
+        return n;
+    }
+
+    void reset()
+    {
+        m_reset = true;
+    }
+
+private:
+    void computeLevels()
+    {
+        m_levelPowerLin = m_level + 1.0f;
+        m_levelPowerDB = (100.0f * (m_level - 1.0f));
+    }
+
+    void computeScanLevels()
+    {
+        // levels in the sample domain. Magnitudes are not computed exactly like the projector does
+        // so a small band around the level is left to the projector.
+        const float scale = SDR_RX_SCALEF;
+        const float margin = 1e-4f;
+        float level;
+        m_scanSupported = true;
+
+        switch (m_scanProjectionType)
+        {
+        case Projector::ProjectionReal:
+            m_scanMeasure = ScopeTriggerScanner::MeasureReal;
+            m_scanLow = m_scanHigh = m_scanLevel * scale; // exact as the scale is a power of two
+            return;
+        case Projector::ProjectionImag:
+            m_scanMeasure = ScopeTriggerScanner::MeasureImag;
+            m_scanLow = m_scanHigh = m_scanLevel * scale;
+            return;
+        case Projector::ProjectionMagSq:
+            m_scanMeasure = ScopeTriggerScanner::MeasureMagSq;
+            level = m_scanLevel * scale * scale;
+            break;
+        case Projector::ProjectionMagLin:
+        {
+            m_scanMeasure = ScopeTriggerScanner::MeasureMagSq;
+            float levelPowerLin = m_scanLevel + 1.0f;
+
+            if (levelPowerLin < 0.0f) // always above
+            {
+                m_scanLow = m_scanHigh = -1.0f;
+                return;
+            }
+
+            level = levelPowerLin * levelPowerLin * scale * scale;
+        }
+            break;
+        case Projector::ProjectionMagDB:
+            m_scanMeasure = ScopeTriggerScanner::MeasureMagSq;
+            level = powf(10.0f, 10.0f * (m_scanLevel - 1.0f)) * scale * scale; // 10^(levelPowerDB/10)
+            break;
+        default: // phase based projections
+            m_scanSupported = false;
+            return;
+        }
+
+        m_scanLow = level - fabsf(level) * margin;
+        m_scanHigh = level + fabsf(level) * margin;
+    }
+
+    Real m_level;
+    Real m_levelPowerDB;
+    Real m_levelPowerLin;
+    bool m_reset;
+    Real m_scanLevel;                               //!< Trigger level of the scan levels
+    Projector::ProjectionType m_scanProjectionType; //!< Projection type of the scan levels
+    bool m_scanSupported;                           //!< Projection can be decided on samples values
+    ScopeTriggerScanner::Measure m_scanMeasure;
+    float m_scanLow;                                //!< Samples below are certainly below the level
+    float m_scanHigh;                               //!< Samples above are certainly above the level
+};
+
+#endif // SDRBASE_DSP_SCOPETRIGGERCOMPARATOR_H_
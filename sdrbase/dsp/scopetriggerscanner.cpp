@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "util/cpufeatures.h"
+#include "scopetriggerscanner.h"
+
+namespace {
+
+template<int M>
+inline float measure(const Sample& s)
+{
+    if (M == ScopeTriggerScanner::MeasureReal) {
+        return s.m_real;
+    } else if (M == ScopeTriggerScanner::MeasureImag) {
+        return s.m_imag;
+    } else {
+        return (float) s.m_real * s.m_real + (float) s.m_imag * s.m_imag;
+    }
+}
+
+template<int M>
+inline int scanMeasure(const Sample *samples, int count, float low, float high, bool above)
+{
+    const int blockSize = 64;
+    int i = 0;
+
+    // whole blocks with a branchless count so that the loops vectorize
+    for (; i + blockSize <= count; i += blockSize)
+    {
+        int n = 0;
+
+        if (above)
+        {
+            for (int j = 0; j < blockSize; j++) {
+                n += measure<M>(samples[i + j]) > high ? 1 : 0;
+            }
+        }
+        else
+        {
+            for (int j = 0; j < blockSize; j++) {
+                n += measure<M>(samples[i + j]) < low ? 1 : 0;
+            }
+        }
+
+        if (n != blockSize) {
+            break;
+        }
+    }
+
+    // first sample out of the run in the last block
+    for (; i < count; i++)
+    {
+        float v = measure<M>(samples[i]);
+
+        if (above ? !(v > high) : !(v < low)) {
+            break;
+        }
+    }
+
+    return i;
+}
+
+inline int scanBody(const Sample *samples, int count, ScopeTriggerScanner::Measure measure, float low, float high, bool above)
+{
+    switch (measure)
+    {
+    case ScopeTriggerScanner::MeasureImag:
+        return scanMeasure<ScopeTriggerScanner::MeasureImag>(samples, count, low, high, above);
+    case ScopeTriggerScanner::MeasureMagSq:
+        return scanMeasure<ScopeTriggerScanner::MeasureMagSq>(samples, count, low, high, above);
+    case ScopeTriggerScanner::MeasureReal:
+    default:
+        return scanMeasure<ScopeTriggerScanner::MeasureReal>(samples, count, low, high, above);
+    }
+}
+
+int scanGeneric(const Sample *samples, int count, ScopeTriggerScanner::Measure measure, float low, float high, bool above)
+{
+    return scanBody(samples, count, measure, low, high, above);
+}
+
+#if defined(CPUFEATURES_X86)
+CPUFEATURES_TARGET("avx2")
+int scanAVX2(const Sample *samples, int count, ScopeTriggerScanner::Measure measure, float low, float high, bool above)
+{
+    return scanBody(samples, count, measure, low, high, above);
+}
+#endif
+
+} // namespace
+
+int ScopeTriggerScanner::scan(const Sample *samples, int count, Measure measure, float low, float high, bool above)
+{
+#if defined(CPUFEATURES_X86)
+    if (CPUFeatures::hasAVX2()) {
+        return scanAVX2(samples, count, measure, low, high, above);
+    }
+#endif
+    return scanGeneric(samples, count, measure, low, high, above);
+}
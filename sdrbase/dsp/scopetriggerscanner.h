@@ -0,0 +1,51 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Block trigger level search of the scope                                       //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SCOPETRIGGERSCANNER_H_
+#define SDRBASE_DSP_SCOPETRIGGERSCANNER_H_
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+/**
+ * Finds the run of samples at the start of a block that stay on the same side of a trigger level.
+ * The comparison is done on the sample values so that no projection is needed: the level is given
+ * as a (low, high) band in the sample domain and samples falling inside the band end the run so that
+ * the caller can decide on them with the exact projection. Like SpectrumPower the loops are
+ * vectorized by the compiler and the AVX2 variant is selected at run time.
+ */
+class SDRBASE_API ScopeTriggerScanner
+{
+public:
+    enum Measure
+    {
+        MeasureReal,  //!< real part
+        MeasureImag,  //!< imaginary part
+        MeasureMagSq  //!< squared magnitude
+    };
+
+    /**
+     * Number of samples from the start of the block whose measure is above high (above true)
+     * or below low (above false)
+     */
+    static int scan(const Sample *samples, int count, Measure measure, float low, float high, bool above);
+};
+
+#endif // SDRBASE_DSP_SCOPETRIGGERSCANNER_H_
@@ -0,0 +1,68 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "spectrumframequeue.h"
+
+SpectrumFrameQueue::SpectrumFrameQueue(unsigned int nbFrames) :
+    m_frames(nbFrames < 2 ? 2 : nbFrames),
+    m_fill(0),
+    m_nbDropped(0),
+    m_head(0),
+    m_tail(0)
+{
+}
+
+bool SpectrumFrameQueue::push(const std::vector<Real>& spectrum, int fftSize)
+{
+    if ((unsigned int) m_fill.loadAcquire() >= m_frames.size())
+    {
+        m_nbDropped.fetchAndAddRelaxed(1);
+        return false;
+    }
+
+    if ((unsigned int) fftSize > spectrum.size()) {
+        fftSize = spectrum.size();
+    }
+
+    Frame& frame = m_frames[m_tail];
+    frame.m_spectrum.assign(spectrum.begin(), spectrum.begin() + fftSize);
+    frame.m_fftSize = fftSize;
+    m_tail = (m_tail + 1) % m_frames.size();
+    m_fill.fetchAndAddRelease(1); // publishes the frame
+
+    return true;
+}
+
+SpectrumFrameQueue::Frame *SpectrumFrameQueue::front()
+{
+    if (m_fill.loadAcquire() == 0) {
+        return nullptr;
+    }
+
+    return &m_frames[m_head];
+}
+
+void SpectrumFrameQueue::pop()
+{
+    if (m_fill.loadAcquire() == 0) {
+        return;
+    }
+
+    m_head = (m_head + 1) % m_frames.size();
+    m_fill.fetchAndAddRelease(-1); // gives the frame back to the producer
+}
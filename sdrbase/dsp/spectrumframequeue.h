@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Lock free queue of spectrum frames from SpectrumVis to the GUI                //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SPECTRUMFRAMEQUEUE_H_
+#define SDRBASE_DSP_SPECTRUMFRAMEQUEUE_H_
+
+#include <vector>
+
+#include <QAtomicInt>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+/**
+ * Single producer (DSP thread) single consumer (GUI thread) queue of spectrum frames. Frame buffers
+ * are allocated once and reused. When the consumer does not keep up the new frames are dropped so
+ * that the producer never waits.
+ */
+class SDRBASE_API SpectrumFrameQueue
+{
+public:
+    struct Frame
+    {
+        std::vector<Real> m_spectrum; //!< the consumer may swap it with its own buffer before pop()
+        int m_fftSize;
+
+        Frame() : m_fftSize(0) {}
+    };
+
+    SpectrumFrameQueue(unsigned int nbFrames = 8);
+
+    bool push(const std::vector<Real>& spectrum, int fftSize); //!< producer. Returns false if the frame is dropped.
+    Frame *front();                                            //!< consumer. nullptr when empty.
+    void pop();                                                //!< consumer. Releases the front frame.
+    unsigned int fill() { return (unsigned int) m_fill.loadAcquire(); }
+    unsigned int getNbDropped() { return (unsigned int) m_nbDropped.loadAcquire(); }
+
+private:
+    std::vector<Frame> m_frames;
+    QAtomicInt m_fill;      //!< shared between producer and consumer
+    QAtomicInt m_nbDropped;
+    unsigned int m_head;    //!< owned by the consumer
+    unsigned int m_tail;    //!< owned by the producer
+};
+
+#endif // SDRBASE_DSP_SPECTRUMFRAMEQUEUE_H_
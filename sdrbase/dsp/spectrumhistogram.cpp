@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "util/cpufeatures.h"
+#include "spectrumhistogram.h"
+
+namespace {
+
+inline void decayBody(quint8 *histogram, unsigned int size, quint8 decay)
+{
+    for (unsigned int i = 0; i < size; i++) {
+        histogram[i] = histogram[i] > decay ? histogram[i] - decay : 0;
+    }
+}
+
+inline void colorizeBody(const quint8 *histogram, quint32 *pixels, unsigned int size, const quint32 *palette)
+{
+    for (unsigned int i = 0; i < size; i++) {
+        pixels[i] = palette[histogram[i]];
+    }
+}
+
+inline void maxLevelsBody(const quint8 *histogram, int *levels, unsigned int fftSize)
+{
+    for (unsigned int i = 0; i < fftSize; i++) {
+        levels[i] = -1;
+    }
+
+    // from the bottom row to the top row so that the highest non zero cell is written last
+    for (int level = 0; level < (int) SpectrumHistogram::m_nbLevels; level++)
+    {
+        const quint8 *row = histogram + (SpectrumHistogram::m_nbLevels - 1 - level) * fftSize;
+
+        for (unsigned int i = 0; i < fftSize; i++) {
+            levels[i] = row[i] != 0 ? level : levels[i];
+        }
+    }
+}
+
+inline void waterfallLineBody(const Real *spectrum, quint32 *pixels, unsigned int fftSize, Real mult, Real ofs, const quint32 *palette)
+{
+    const Real top = SpectrumHistogram::m_nbColors - 1;
+
+    for (unsigned int i = 0; i < fftSize; i++)
+    {
+        Real v = spectrum[i] * mult + ofs;
+        v = v < 0.0f ? 0.0f : v > top ? top : v;
+        pixels[i] = palette[(int) v];
+    }
+}
+
+void decayGeneric(quint8 *histogram, unsigned int size, quint8 decay)
+{
+    decayBody(histogram, size, decay);
+}
+
+void colorizeGeneric(const quint8 *histogram, quint32 *pixels, unsigned int size, const quint32 *palette)
+{
+    colorizeBody(histogram, pixels, size, palette);
+}
+
+void maxLevelsGeneric(const quint8 *histogram, int *levels, unsigned int fftSize)
+{
+    maxLevelsBody(histogram, levels, fftSize);
+}
+
+void waterfallLineGeneric(const Real *spectrum, quint32 *pixels, unsigned int fftSize, Real mult, Real ofs, const quint32 *palette)
+{
+    waterfallLineBody(spectrum, pixels, fftSize, mult, ofs, palette);
+}
+
+#if defined(CPUFEATURES_X86)
+CPUFEATURES_TARGET("avx2")
+void decayAVX2(quint8 *histogram, unsigned int size, quint8 decay)
+{
+    decayBody(histogram, size, decay);
+}
+
+CPUFEATURES_TARGET("avx2")
+void colorizeAVX2(const quint8 *histogram, quint32 *pixels, unsigned int size, const quint32 *palette)
+{
+    colorizeBody(histogram, pixels, size, palette);
+}
+
+CPUFEATURES_TARGET("avx2")
+void maxLevelsAVX2(const quint8 *histogram, int *levels, unsigned int fftSize)
+{
+    maxLevelsBody(histogram, levels, fftSize);
+}
+
+CPUFEATURES_TARGET("avx2")
+void waterfallLineAVX2(const Real *spectrum, quint32 *pixels, unsigned int fftSize, Real mult, Real ofs, const quint32 *palette)
+{
+    waterfallLineBody(spectrum, pixels, fftSize, mult, ofs, palette);
+}
+#endif
+
+} // namespace
+
+void SpectrumHistogram::decay(quint8 *histogram, unsigned int size, quint8 decay)
+{
+#if defined(CPUFEATURES_X86)
+    if (CPUFeatures::hasAVX2())
+    {
+        decayAVX2(histogram, size, decay);
+        return;
+    }
+#endif
+    decayGeneric(histogram, size, decay);
+}
+
+void SpectrumHistogram::stroke(quint8 *histogram, const Real *spectrum, unsigned int fftSize, Real referenceLevel, Real powerRange, int stroke)
+{
+    const Real mult = m_nbLevels / powerRange;
+    const int top = m_nbColors - 1;
+
+    for (unsigned int i = 0; i < fftSize; i++)
+    {
+        int v = (int) ((spectrum[i] - referenceLevel) * mult + (Real) m_nbLevels);
+
+        if ((v >= 0) && (v < (int) m_nbLevels))
+        {
+            quint8 *b = histogram + (m_nbLevels - 1 - v) * fftSize + i;
+            *b = *b + stroke <= top ? *b + stroke : top;
+        }
+    }
+}
+
+void SpectrumHistogram::colorize(const quint8 *histogram, quint32 *pixels, unsigned int size, const quint32 *palette)
+{
+#if defined(CPUFEATURES_X86)
+    if (CPUFeatures::hasAVX2())
+    {
+        colorizeAVX2(histogram, pixels, size, palette);
+        return;
+    }
+#endif
+    colorizeGeneric(histogram, pixels, size, palette);
+}
+
+void SpectrumHistogram::maxLevels(const quint8 *histogram, int *levels, unsigned int fftSize)
+{
+#if defined(CPUFEATURES_X86)
+    if (CPUFeatures::hasAVX2())
+    {
+        maxLevelsAVX2(histogram, levels, fftSize);
+        return;
+    }
+#endif
+    maxLevelsGeneric(histogram, levels, fftSize);
+}
+
+void SpectrumHistogram::waterfallLine(const Real *spectrum, quint32 *pixels, unsigned int fftSize, Real referenceLevel, Real powerRange, const quint32 *palette)
+{
+    // index = (power - referenceLevel) * nbColors / powerRange + nbColors
+    const Real mult = m_nbColors / powerRange;
+    const Real ofs = m_nbColors - referenceLevel * mult;
+#if defined(CPUFEATURES_X86)
+    if (CPUFeatures::hasAVX2())
+    {
+        waterfallLineAVX2(spectrum, pixels, fftSize, mult, ofs, palette);
+        return;
+    }
+#endif
+    waterfallLineGeneric(spectrum, pixels, fftSize, mult, ofs, palette);
+}
@@ -0,0 +1,51 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Block kernels of the spectrum display histogram and waterfall                 //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SPECTRUMHISTOGRAM_H_
+#define SDRBASE_DSP_SPECTRUMHISTOGRAM_H_
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+/**
+ * The histogram (phosphor) matrix has the layout of its texture: m_nbLevels rows of fftSize cells
+ * from the top (reference level) to the bottom (reference level minus power range). Cell values
+ * are palette indexes in [0..239]. Like SpectrumPower the loops are vectorized by the compiler and
+ * the AVX2 variants are selected at run time.
+ */
+class SDRBASE_API SpectrumHistogram
+{
+public:
+    static const unsigned int m_nbLevels = 100;
+    static const unsigned int m_nbColors = 240;
+
+    /** Saturating subtraction of decay from size cells */
+    static void decay(quint8 *histogram, unsigned int size, quint8 decay);
+    /** Adds stroke to the cell of the power level of each bin capped to the last color */
+    static void stroke(quint8 *histogram, const Real *spectrum, unsigned int fftSize, Real referenceLevel, Real powerRange, int stroke);
+    /** Palette lookup of size cells */
+    static void colorize(const quint8 *histogram, quint32 *pixels, unsigned int size, const quint32 *palette);
+    /** Level (0 bottom to m_nbLevels - 1 top) of the highest non zero cell of each bin or -1 */
+    static void maxLevels(const quint8 *histogram, int *levels, unsigned int fftSize);
+    /** Waterfall line: palette color of the power over the power range in m_nbColors steps */
+    static void waterfallLine(const Real *spectrum, quint32 *pixels, unsigned int fftSize, Real referenceLevel, Real powerRange, const quint32 *palette);
+};
+
+#endif // SDRBASE_DSP_SPECTRUMHISTOGRAM_H_
@@ -0,0 +1,166 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include <cstddef>
+#include <string.h>
+
+#include "util/cpufeatures.h"
+#include "spectrumpower.h"
+
+namespace {
+
+// Complex is read as interleaved float pairs so that the loop is vectorized
+inline void magSqBody(const Real *in, Real *out, unsigned int nbBins)
+{
+    for (std::size_t i = 0; i < nbBins; i++) {
+        out[i] = in[2*i] * in[2*i] + in[2*i+1] * in[2*i+1];
+    }
+}
+
+inline float log2Approx(float x)
+{
+    uint32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    int32_t e = (int32_t) (bits >> 23) - 127;
+    bits = (bits & 0x007FFFFF) | 0x3F800000;
+    float m;
+    memcpy(&m, &bits, sizeof(m));
+    // mantissa in [sqrt(1/2), sqrt(2)) to keep the polynomial below accurate
+    bool high = m > 1.41421356f;
+    m = high ? m * 0.5f : m;
+    e = high ? e + 1 : e;
+    // log2(1+t) least squares polynomial fit for t in [-0.293, 0.414] (no division)
+    float t = m - 1.0f;
+    float p = t * (1.44270101f + t * (-0.721368393f + t * (0.480402376f + t * (-0.359203948f
+        + t * (0.298260398f + t * (-0.270926707f + t * 0.165175346f))))));
+    return (float) e + p;
+}
+
+inline void log2ScaleBody(const Real *in, Real *out, unsigned int nbBins, Real mult, Real ofs)
+{
+    for (unsigned int i = 0; i < nbBins; i++) {
+        out[i] = mult * log2Approx(in[i]) + ofs;
+    }
+}
+
+void magSqGeneric(const Real *in, Real *out, unsigned int nbBins)
+{
+    magSqBody(in, out, nbBins);
+}
+
+void log2ScaleGeneric(const Real *in, Real *out, unsigned int nbBins, Real mult, Real ofs)
+{
+    log2ScaleBody(in, out, nbBins, mult, ofs);
+}
+
+#if defined(CPUFEATURES_X86)
+CPUFEATURES_TARGET("avx2")
+void magSqAVX2(const Real *in, Real *out, unsigned int nbBins)
+{
+    magSqBody(in, out, nbBins);
+}
+
+CPUFEATURES_TARGET("avx2")
+void log2ScaleAVX2(const Real *in, Real *out, unsigned int nbBins, Real mult, Real ofs)
+{
+    log2ScaleBody(in, out, nbBins, mult, ofs);
+}
+#endif
+
+} // namespace
+
+void SpectrumPower::magSq(const Complex *in, Real *out, unsigned int nbBins)
+{
+#if defined(CPUFEATURES_X86)
+    if (CPUFeatures::hasAVX2())
+    {
+        magSqAVX2((const Real*) in, out, nbBins);
+        return;
+    }
+#endif
+    magSqGeneric((const Real*) in, out, nbBins);
+}
+
+void SpectrumPower::duplicateBins(const Real *in, Real *out, unsigned int nbInBins)
+{
+    for (unsigned int i = 0; i < nbInBins; i++)
+    {
+        Real v = in[i];
+        out[2*i] = v;
+        out[2*i+1] = v;
+    }
+}
+
+void SpectrumPower::log2Scale(const Real *in, Real *out, unsigned int nbBins, Real mult, Real ofs)
+{
+#if defined(CPUFEATURES_X86)
+    if (CPUFeatures::hasAVX2())
+    {
+        log2ScaleAVX2(in, out, nbBins, mult, ofs);
+        return;
+    }
+#endif
+    log2ScaleGeneric(in, out, nbBins, mult, ofs);
+}
+
+void SpectrumPower::linearScale(const Real *in, Real *out, unsigned int nbBins, Real mult)
+{
+    for (unsigned int i = 0; i < nbBins; i++) {
+        out[i] = mult * in[i];
+    }
+}
+
+Real SpectrumPower::max(const Real *in, unsigned int nbBins)
+{
+    Real m = 0.0f;
+
+    for (unsigned int i = 0; i < nbBins; i++) {
+        m = in[i] > m ? in[i] : m;
+    }
+
+    return m;
+}
+
+void SpectrumPower::decimateMax(const Real *in, Real *out, unsigned int nbOutBins, unsigned int factor)
+{
+    for (unsigned int i = 0; i < nbOutBins; i++, in += factor)
+    {
+        Real m = in[0];
+
+        for (unsigned int j = 1; j < factor; j++) {
+            m = in[j] > m ? in[j] : m;
+        }
+
+        out[i] = m;
+    }
+}
+
+void SpectrumPower::decimateSum(const Real *in, Real *out, unsigned int nbOutBins, unsigned int factor)
+{
+    for (unsigned int i = 0; i < nbOutBins; i++, in += factor)
+    {
+        Real s = 0.0f;
+
+        for (unsigned int j = 0; j < factor; j++) {
+            s += in[j];
+        }
+
+        out[i] = s;
+    }
+}
@@ -0,0 +1,50 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Block kernels of the spectrum power stage (power, log scale, decimated views) //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SPECTRUMPOWER_H_
+#define SDRBASE_DSP_SPECTRUMPOWER_H_
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+/**
+ * The loops have no dependency between bins so that the compiler vectorizes them. The AVX2 variants
+ * are the same code compiled for AVX2 and are selected at run time (see CPUFeatures).
+ */
+class SDRBASE_API SpectrumPower
+{
+public:
+    static void magSq(const Complex *in, Real *out, unsigned int nbBins); //!< squared magnitude
+    /** Each input bin is written twice (positive frequencies only spectrum). in may be out + nbInBins. */
+    static void duplicateBins(const Real *in, Real *out, unsigned int nbInBins);
+    /**
+     * out = mult * log2(in) + ofs. log2 is a polynomial approximation (error below 1.3e-5 dB on the power scale).
+     * in must be positive. Zero gives a large negative value (log2 ~ -127) instead of -inf.
+     */
+    static void log2Scale(const Real *in, Real *out, unsigned int nbBins, Real mult, Real ofs);
+    static void linearScale(const Real *in, Real *out, unsigned int nbBins, Real mult); //!< out = mult * in
+    static Real max(const Real *in, unsigned int nbBins);
+    /** Decimated view: each output bin is the maximum of factor input bins (peaks are kept) */
+    static void decimateMax(const Real *in, Real *out, unsigned int nbOutBins, unsigned int factor);
+    /** Lower resolution view: each output bin is the sum of the power of factor input bins like the bin of a factor times smaller FFT */
+    static void decimateSum(const Real *in, Real *out, unsigned int nbOutBins, unsigned int factor);
+};
+
+#endif // SDRBASE_DSP_SPECTRUMPOWER_H_
@@ -18,10 +18,13 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <QDateTime>
+
 #include "glspectruminterface.h"
 #include "dspcommands.h"
 #include "dspengine.h"
 #include "fftfactory.h"
+#include "spectrumpower.h"
 #include "util/messagequeue.h"
 
 #include "spectrumvis.h"
@@ -49,7 +52,10 @@ SpectrumVis::SpectrumVis(Real scalef) :
 	m_fft(nullptr),
     m_fftEngineSequence(0),
 	m_fftBuffer(MAX_FFT_SIZE),
+	m_magsq(MAX_FFT_SIZE),
 	m_powerSpectrum(MAX_FFT_SIZE),
+	m_historySpectrum(MAX_FFT_SIZE),
+	m_nbViews(0),
 	m_fftBufferFill(0),
 	m_needMoreSamples(false),
 	m_scalef(scalef),
@@ -64,6 +70,8 @@ SpectrumVis::SpectrumVis(Real scalef) :
 	setObjectName("SpectrumVis");
     applySettings(m_settings, true);
     //m_wsSpectrum.openSocket(); // FIXME: conditional
+    m_wsSpectrum.setWaterfallHistory(&m_waterfallHistory);
+    m_wsSpectrum.setSpectrumVis(this);
 }
 
 SpectrumVis::~SpectrumVis()
@@ -109,6 +117,22 @@ void SpectrumVis::configure(
 	getInputMessageQueue()->push(cmd);
 }
 
+void SpectrumVis::configureWaterfallHistory(bool enabled, int memoryMB, const QString& spillDirectory)
+{
+    // the history has its own lock so it is configured directly
+    WaterfallHistory::Settings historySettings = m_waterfallHistory.getSettings();
+
+    if ((historySettings.m_enabled != enabled)
+     || (historySettings.m_maxMemoryBytes != memoryMB * 1024LL * 1024LL)
+     || (historySettings.m_spillDirectory != spillDirectory))
+    {
+        historySettings.m_enabled = enabled;
+        historySettings.m_maxMemoryBytes = memoryMB * 1024LL * 1024LL;
+        historySettings.m_spillDirectory = spillDirectory;
+        m_waterfallHistory.configure(historySettings);
+    }
+}
+
 void SpectrumVis::setScalef(Real scalef)
 {
     MsgConfigureScalingFactor* cmd = new MsgConfigureScalingFactor(scalef);
@@ -144,7 +168,7 @@ void SpectrumVis::feedTriggered(const SampleVector::const_iterator& triggerPoint
 
 void SpectrumVis::feed(const Complex *begin, unsigned int length)
 {
-	if (!m_glSpectrum && !m_wsSpectrum.socketOpened()) {
+	if (!m_glSpectrum && !m_wsSpectrum.socketOpened() && (m_nbViews.loadAcquire() == 0) && !m_waterfallHistory.isEnabled()) {
 		return;
 	}
 
@@ -152,170 +176,10 @@ void SpectrumVis::feed(const Complex *begin, unsigned int length)
         return;
     }
 
-    Complex c;
-    Real v;
-
-    if (m_settings.m_averagingMode == GLSpectrumSettings::AvgModeNone)
-    {
-        for (unsigned int i = 0; i < m_settings.m_fftSize; i++)
-        {
-            if (i < length) {
-                c = begin[i];
-            } else {
-                c = Complex{0,0};
-            }
-
-            v = c.real() * c.real() + c.imag() * c.imag();
-            v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-            m_powerSpectrum[i] = v;
-        }
-
-        // send new data to visualisation
-        if (m_glSpectrum) {
-            m_glSpectrum->newSpectrum(m_powerSpectrum, m_settings.m_fftSize);
-        }
-
-        // web socket spectrum connections
-        if (m_wsSpectrum.socketOpened())
-        {
-            m_wsSpectrum.newSpectrum(
-                m_powerSpectrum,
-                m_settings.m_fftSize,
-                m_settings.m_refLevel,
-                m_settings.m_powerRange,
-                m_centerFrequency,
-                m_sampleRate,
-                m_settings.m_linear
-            );
-        }
-    }
-    else if (m_settings.m_averagingMode == GLSpectrumSettings::AvgModeMoving)
-    {
-        for (unsigned int i = 0; i < m_settings.m_fftSize; i++)
-        {
-            if (i < length) {
-                c = begin[i];
-            } else {
-                c = Complex{0,0};
-            }
-
-            v = c.real() * c.real() + c.imag() * c.imag();
-            v = m_movingAverage.storeAndGetAvg(v, i);
-            v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-            m_powerSpectrum[i] = v;
-        }
-
-        // send new data to visualisation
-        if (m_glSpectrum) {
-            m_glSpectrum->newSpectrum(m_powerSpectrum, m_settings.m_fftSize);
-        }
-
-        // web socket spectrum connections
-        if (m_wsSpectrum.socketOpened())
-        {
-            m_wsSpectrum.newSpectrum(
-                m_powerSpectrum,
-                m_settings.m_fftSize,
-                m_settings.m_refLevel,
-                m_settings.m_powerRange,
-                m_centerFrequency,
-                m_sampleRate,
-                m_settings.m_linear
-            );
-        }
-
-        m_movingAverage.nextAverage();
-    }
-    else if (m_settings.m_averagingMode == GLSpectrumSettings::AvgModeFixed)
-    {
-        double avg;
-
-        for (unsigned int i = 0; i < m_settings.m_fftSize; i++)
-        {
-            if (i < length) {
-                c = begin[i];
-            } else {
-                c = Complex{0,0};
-            }
-
-            v = c.real() * c.real() + c.imag() * c.imag();
-
-            // result available
-            if (m_fixedAverage.storeAndGetAvg(avg, v, i))
-            {
-                avg = m_settings.m_linear ? avg/m_powFFTDiv : m_mult * log2f(avg) + m_ofs;
-                m_powerSpectrum[i] = avg;
-            }
-        }
-
-        // result available
-        if (m_fixedAverage.nextAverage())
-        {
-            // send new data to visualisation
-            if (m_glSpectrum) {
-                m_glSpectrum->newSpectrum(m_powerSpectrum, m_settings.m_fftSize);
-            }
-
-            // web socket spectrum connections
-            if (m_wsSpectrum.socketOpened())
-            {
-                m_wsSpectrum.newSpectrum(
-                    m_powerSpectrum,
-                    m_settings.m_fftSize,
-                    m_settings.m_refLevel,
-                    m_settings.m_powerRange,
-                    m_centerFrequency,
-                    m_sampleRate,
-                    m_settings.m_linear
-                );
-            }
-        }
-    }
-    else if (m_settings.m_averagingMode == GLSpectrumSettings::AvgModeMax)
-    {
-        double max;
-
-        for (unsigned int i = 0; i < m_settings.m_fftSize; i++)
-        {
-            if (i < length) {
-                c = begin[i];
-            } else {
-                c = Complex{0,0};
-            }
-
-            v = c.real() * c.real() + c.imag() * c.imag();
-
-            // result available
-            if (m_max.storeAndGetMax(max, v, i))
-            {
-                max = m_settings.m_linear ? max/m_powFFTDiv : m_mult * log2f(max) + m_ofs;
-                m_powerSpectrum[i] = max;
-            }
-        }
-
-        // result available
-        if (m_max.nextMax())
-        {
-            // send new data to visualisation
-            if (m_glSpectrum) {
-                m_glSpectrum->newSpectrum(m_powerSpectrum, m_settings.m_fftSize);
-            }
-
-            // web socket spectrum connections
-            if (m_wsSpectrum.socketOpened())
-            {
-                m_wsSpectrum.newSpectrum(
-                    m_powerSpectrum,
-                    m_settings.m_fftSize,
-                    m_settings.m_refLevel,
-                    m_settings.m_powerRange,
-                    m_centerFrequency,
-                    m_sampleRate,
-                    m_settings.m_linear
-                );
-            }
-        }
-    }
+    unsigned int nbBins = length < m_settings.m_fftSize ? length : m_settings.m_fftSize;
+    SpectrumPower::magSq(begin, m_magsq.data(), nbBins);
+    std::fill(m_magsq.begin() + nbBins, m_magsq.begin() + m_settings.m_fftSize, 0.0f);
+    processPower(false);
 
     m_mutex.unlock();
 }
@@ -327,7 +191,7 @@ void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleV
     }
 
 	// if no visualisation is set, send the samples to /dev/null
-	if (!m_glSpectrum && !m_wsSpectrum.socketOpened()) {
+	if (!m_glSpectrum && !m_wsSpectrum.socketOpened() && (m_nbViews.loadAcquire() == 0) && !m_waterfallHistory.isEnabled()) {
 		return;
 	}
 
@@ -360,271 +224,19 @@ void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleV
 
 			// extract power spectrum and reorder buckets
 			const Complex* fftOut = m_fft->out();
-			Complex c;
-			Real v;
-			std::size_t halfSize = m_settings.m_fftSize / 2;
+			unsigned int halfSize = m_settings.m_fftSize / 2;
 
-			if (m_settings.m_averagingMode == GLSpectrumSettings::AvgModeNone)
-			{
-                m_specMax = 0.0f;
-
-                if ( positiveOnly )
-                {
-                    for (std::size_t i = 0; i < halfSize; i++)
-                    {
-                        c = fftOut[i];
-                        v = c.real() * c.real() + c.imag() * c.imag();
-                        m_specMax = v > m_specMax ? v : m_specMax;
-                        v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                        m_powerSpectrum[i * 2] = v;
-                        m_powerSpectrum[i * 2 + 1] = v;
-                    }
-                }
-                else
-                {
-                    for (std::size_t i = 0; i < halfSize; i++)
-                    {
-                        c = fftOut[i + halfSize];
-                        v = c.real() * c.real() + c.imag() * c.imag();
-                        m_specMax = v > m_specMax ? v : m_specMax;
-                        v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                        m_powerSpectrum[i] = v;
-
-                        c = fftOut[i];
-                        v = c.real() * c.real() + c.imag() * c.imag();
-                        m_specMax = v > m_specMax ? v : m_specMax;
-                        v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-                        m_powerSpectrum[i + halfSize] = v;
-                    }
-                }
-
-                // send new data to visualisation
-                if (m_glSpectrum) {
-                    m_glSpectrum->newSpectrum(m_powerSpectrum, m_settings.m_fftSize);
-                }
-
-                // web socket spectrum connections
-                if (m_wsSpectrum.socketOpened())
-                {
-                    m_wsSpectrum.newSpectrum(
-                        m_powerSpectrum,
-                        m_settings.m_fftSize,
-                        m_settings.m_refLevel,
-                        m_settings.m_powerRange,
-                        m_centerFrequency,
-                        m_sampleRate,
-                        m_settings.m_linear
-                    );
-                }
-			}
-			else if (m_settings.m_averagingMode == GLSpectrumSettings::AvgModeMoving)
-			{
-                m_specMax = 0.0f;
-
-	            if ( positiveOnly )
-	            {
-	                for (std::size_t i = 0; i < halfSize; i++)
-	                {
-	                    c = fftOut[i];
-	                    v = c.real() * c.real() + c.imag() * c.imag();
-	                    v = m_movingAverage.storeAndGetAvg(v, i);
-                        m_specMax = v > m_specMax ? v : m_specMax;
-	                    v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-	                    m_powerSpectrum[i * 2] = v;
-	                    m_powerSpectrum[i * 2 + 1] = v;
-	                }
-	            }
-	            else
-	            {
-	                for (std::size_t i = 0; i < halfSize; i++)
-	                {
-	                    c = fftOut[i + halfSize];
-	                    v = c.real() * c.real() + c.imag() * c.imag();
-	                    v = m_movingAverage.storeAndGetAvg(v, i+halfSize);
-                        m_specMax = v > m_specMax ? v : m_specMax;
-	                    v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-	                    m_powerSpectrum[i] = v;
-
-	                    c = fftOut[i];
-	                    v = c.real() * c.real() + c.imag() * c.imag();
-	                    v = m_movingAverage.storeAndGetAvg(v, i);
-                        m_specMax = v > m_specMax ? v : m_specMax;
-	                    v = m_settings.m_linear ? v/m_powFFTDiv : m_mult * log2f(v) + m_ofs;
-	                    m_powerSpectrum[i + halfSize] = v;
-	                }
-	            }
-
-	            // send new data to visualisation
-                if (m_glSpectrum) {
-    	            m_glSpectrum->newSpectrum(m_powerSpectrum, m_settings.m_fftSize);
-                }
-
-                // web socket spectrum connections
-                if (m_wsSpectrum.socketOpened())
-                {
-                    m_wsSpectrum.newSpectrum(
-                        m_powerSpectrum,
-                        m_settings.m_fftSize,
-                        m_settings.m_refLevel,
-                        m_settings.m_powerRange,
-                        m_centerFrequency,
-                        m_sampleRate,
-                        m_settings.m_linear
-                    );
-                }
-
-	            m_movingAverage.nextAverage();
-			}
-			else if (m_settings.m_averagingMode == GLSpectrumSettings::AvgModeFixed)
-			{
-			    double avg;
-                Real specMax = 0.0f;
-
-                if ( positiveOnly )
-                {
-                    for (std::size_t i = 0; i < halfSize; i++)
-                    {
-                        c = fftOut[i];
-                        v = c.real() * c.real() + c.imag() * c.imag();
-
-                        // result available
-                        if (m_fixedAverage.storeAndGetAvg(avg, v, i))
-                        {
-                            specMax = avg > specMax ? avg : specMax;
-                            avg = m_settings.m_linear ? avg/m_powFFTDiv : m_mult * log2f(avg) + m_ofs;
-                            m_powerSpectrum[i * 2] = avg;
-                            m_powerSpectrum[i * 2 + 1] = avg;
-                        }
-                    }
-                }
-                else
-                {
-                    for (std::size_t i = 0; i < halfSize; i++)
-                    {
-                        c = fftOut[i + halfSize];
-                        v = c.real() * c.real() + c.imag() * c.imag();
-
-                        // result available
-                        if (m_fixedAverage.storeAndGetAvg(avg, v, i+halfSize))
-                        {
-                            specMax = avg > specMax ? avg : specMax;
-                            avg = m_settings.m_linear ? avg/m_powFFTDiv : m_mult * log2f(avg) + m_ofs;
-                            m_powerSpectrum[i] = avg;
-                        }
-
-                        c = fftOut[i];
-                        v = c.real() * c.real() + c.imag() * c.imag();
-
-                        // result available
-                        if (m_fixedAverage.storeAndGetAvg(avg, v, i))
-                        {
-                            specMax = avg > specMax ? avg : specMax;
-                            avg = m_settings.m_linear ? avg/m_powFFTDiv : m_mult * log2f(avg) + m_ofs;
-                            m_powerSpectrum[i + halfSize] = avg;
-                        }
-                    }
-                }
-
-                // result available
-                if (m_fixedAverage.nextAverage())
-                {
-                    m_specMax = specMax;
-
-                    // send new data to visualisation
-                    if (m_glSpectrum) {
-                        m_glSpectrum->newSpectrum(m_powerSpectrum, m_settings.m_fftSize);
-                    }
-
-                    // web socket spectrum connections
-                    if (m_wsSpectrum.socketOpened())
-                    {
-                        m_wsSpectrum.newSpectrum(
-                            m_powerSpectrum,
-                            m_settings.m_fftSize,
-                            m_settings.m_refLevel,
-                            m_settings.m_powerRange,
-                            m_centerFrequency,
-                            m_sampleRate,
-                            m_settings.m_linear
-                        );
-                    }
-                }
-			}
-			else if (m_settings.m_averagingMode == GLSpectrumSettings::AvgModeMax)
-			{
-			    double max;
-                Real specMax = 0.0f;
-
-                if ( positiveOnly )
-                {
-                    for (std::size_t i = 0; i < halfSize; i++)
-                    {
-                        c = fftOut[i];
-                        v = c.real() * c.real() + c.imag() * c.imag();
-
-                        // result available
-                        if (m_max.storeAndGetMax(max, v, i))
-                        {
-                            specMax = max > specMax ? max : specMax;
-                            max = m_settings.m_linear ? max/m_powFFTDiv : m_mult * log2f(max) + m_ofs;
-                            m_powerSpectrum[i * 2] = max;
-                            m_powerSpectrum[i * 2 + 1] = max;
-                        }
-                    }
-                }
-                else
-                {
-                    for (std::size_t i = 0; i < halfSize; i++)
-                    {
-                        c = fftOut[i + halfSize];
-                        v = c.real() * c.real() + c.imag() * c.imag();
-
-                        // result available
-                        if (m_max.storeAndGetMax(max, v, i+halfSize))
-                        {
-                            specMax = max > specMax ? max : specMax;
-                            max = m_settings.m_linear ? max/m_powFFTDiv : m_mult * log2f(max) + m_ofs;
-                            m_powerSpectrum[i] = max;
-                        }
-
-                        c = fftOut[i];
-                        v = c.real() * c.real() + c.imag() * c.imag();
-
-                        // result available
-                        if (m_max.storeAndGetMax(max, v, i))
-                        {
-                            specMax = max > specMax ? max : specMax;
-                            max = m_settings.m_linear ? max/m_powFFTDiv : m_mult * log2f(max) + m_ofs;
-                            m_powerSpectrum[i + halfSize] = max;
-                        }
-                    }
-                }
-
-                // result available
-                if (m_max.nextMax())
-                {
-                    m_specMax = specMax;
-
-                    // send new data to visualisation
-                    if (m_glSpectrum) {
-                        m_glSpectrum->newSpectrum(m_powerSpectrum, m_settings.m_fftSize);
-                    }
-
-                    // web socket spectrum connections
-                    if (m_wsSpectrum.socketOpened())
-                    {
-                        m_wsSpectrum.newSpectrum(
-                            m_powerSpectrum,
-                            m_settings.m_fftSize,
-                            m_settings.m_refLevel,
-                            m_settings.m_powerRange,
-                            m_centerFrequency,
-                            m_sampleRate,
-                            m_settings.m_linear
-                        );
-                    }
-                }
-			}
+            if (positiveOnly)
+            {
+                SpectrumPower::magSq(fftOut, m_magsq.data(), halfSize);
+            }
+            else
+            {
+                SpectrumPower::magSq(fftOut + halfSize, m_magsq.data(), halfSize);
+                SpectrumPower::magSq(fftOut, m_magsq.data() + halfSize, halfSize);
+            }
+
+            processPower(positiveOnly);
 
 			// advance buffer respecting the fft overlap factor
 			std::copy(m_fftBuffer.begin() + m_refillSize, m_fftBuffer.end(), m_fftBuffer.begin());
@@ -649,6 +261,190 @@ void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleV
 	 m_mutex.unlock();
 }
 
+/**
+ * m_magsq holds the squared magnitudes of the FFT in display order. Only the positive frequencies half
+ * is present when positiveOnly is set and each bin is then displayed twice. Averaging, scaling and
+ * publication are done here once for all consumers.
+ */
+void SpectrumVis::processPower(bool positiveOnly)
+{
+    unsigned int nbBins = positiveOnly ? m_settings.m_fftSize / 2 : m_settings.m_fftSize;
+    Real *power = m_magsq.data();
+
+    if (m_settings.m_averagingMode == GLSpectrumSettings::AvgModeMoving)
+    {
+        m_movingAverage.storeAndGetAvg(power, power, nbBins);
+        m_movingAverage.nextAverage();
+    }
+    else if (m_settings.m_averagingMode == GLSpectrumSettings::AvgModeFixed)
+    {
+        bool available = m_fixedAverage.storeAndGetAvg(power, power, nbBins);
+        m_fixedAverage.nextAverage();
+
+        if (!available) {
+            return;
+        }
+    }
+    else if (m_settings.m_averagingMode == GLSpectrumSettings::AvgModeMax)
+    {
+        bool available = m_max.storeAndGetMax(power, power, nbBins);
+        m_max.nextMax();
+
+        if (!available) {
+            return;
+        }
+    }
+
+    m_specMax = SpectrumPower::max(power, nbBins);
+
+    bool published = m_glSpectrum || m_wsSpectrum.socketOpened();
+
+    if (published)
+    {
+        scalePower(power, nbBins, positiveOnly, m_settings.m_linear, m_powerSpectrum.data());
+        publishSpectrum();
+    }
+
+    if (m_views.size() != 0) {
+        publishViews(positiveOnly);
+    }
+
+    // the waterfall history is in dB whatever the display scale
+    if (m_waterfallHistory.isEnabled())
+    {
+        const Real *spectrumDb = m_powerSpectrum.data();
+
+        if (!published || m_settings.m_linear)
+        {
+            scalePower(power, nbBins, positiveOnly, false, m_historySpectrum.data());
+            spectrumDb = m_historySpectrum.data();
+        }
+
+        m_waterfallHistory.addLine(
+            spectrumDb,
+            m_settings.m_fftSize,
+            QDateTime::currentMSecsSinceEpoch(),
+            m_centerFrequency,
+            m_sampleRate
+        );
+    }
+}
+
+void SpectrumVis::scalePower(const Real *power, unsigned int nbBins, bool positiveOnly, bool linear, Real *spectrum)
+{
+    // positive frequencies only are scaled into the upper half then spread over the whole width
+    Real *scaled = positiveOnly ? spectrum + nbBins : spectrum;
+
+    if (linear) {
+        SpectrumPower::linearScale(power, scaled, nbBins, 1.0f / m_powFFTDiv);
+    } else {
+        SpectrumPower::log2Scale(power, scaled, nbBins, m_mult, m_ofs);
+    }
+
+    if (positiveOnly) {
+        SpectrumPower::duplicateBins(scaled, spectrum, nbBins);
+    }
+}
+
+void SpectrumVis::publishSpectrum()
+{
+    // send new data to visualisation
+    if (m_glSpectrum) {
+        m_glSpectrum->newSpectrum(m_powerSpectrum, m_settings.m_fftSize);
+    }
+
+    // web socket spectrum connections
+    if (m_wsSpectrum.socketOpened())
+    {
+        m_wsSpectrum.newSpectrum(
+            m_powerSpectrum,
+            m_settings.m_fftSize,
+            m_settings.m_refLevel,
+            m_settings.m_powerRange,
+            m_centerFrequency,
+            m_sampleRate,
+            m_settings.m_linear
+        );
+    }
+}
+
+void SpectrumVis::publishViews(bool positiveOnly)
+{
+    const Real *power = m_magsq.data();
+
+    for (unsigned int i = 0; i < m_views.size(); i++)
+    {
+        SpectrumView& view = m_views[i];
+        unsigned int viewBins = view.m_nbBins < m_settings.m_fftSize ? view.m_nbBins : m_settings.m_fftSize;
+        const std::vector<Real> *viewSpectrum = nullptr;
+
+        // reuse a view already computed with the same parameters
+        for (unsigned int j = 0; j < i; j++)
+        {
+            if ((m_views[j].m_nbBins == view.m_nbBins) && (m_views[j].m_viewMode == view.m_viewMode))
+            {
+                viewSpectrum = &m_views[j].m_spectrum;
+                break;
+            }
+        }
+
+        if (!viewSpectrum)
+        {
+            unsigned int factor = m_settings.m_fftSize / viewBins;
+            unsigned int nbOut = positiveOnly ? viewBins / 2 : viewBins;
+            view.m_spectrum.resize(viewBins);
+            Real *spectrum = positiveOnly ? view.m_spectrum.data() + nbOut : view.m_spectrum.data();
+
+            if (view.m_viewMode == ViewModePeak) {
+                SpectrumPower::decimateMax(power, spectrum, nbOut, factor);
+            } else {
+                SpectrumPower::decimateSum(power, spectrum, nbOut, factor);
+            }
+
+            if (m_settings.m_linear) {
+                SpectrumPower::linearScale(spectrum, spectrum, nbOut, 1.0f / m_powFFTDiv);
+            } else {
+                SpectrumPower::log2Scale(spectrum, spectrum, nbOut, m_mult, m_ofs);
+            }
+
+            if (positiveOnly) {
+                SpectrumPower::duplicateBins(spectrum, view.m_spectrum.data(), nbOut);
+            }
+
+            viewSpectrum = &view.m_spectrum;
+        }
+
+        view.m_view->newSpectrum(*viewSpectrum, viewBins);
+    }
+}
+
+void SpectrumVis::addSpectrumView(GLSpectrumInterface* view, unsigned int nbBins, ViewMode viewMode)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    SpectrumView spectrumView;
+    spectrumView.m_view = view;
+    spectrumView.m_nbBins = nbBins < 64 ? 64 : nbBins > MAX_FFT_SIZE ? MAX_FFT_SIZE : nbBins;
+    spectrumView.m_viewMode = viewMode;
+    m_views.push_back(spectrumView);
+    m_nbViews.storeRelease(m_views.size());
+}
+
+void SpectrumVis::removeSpectrumView(GLSpectrumInterface* view)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    for (std::vector<SpectrumView>::iterator it = m_views.begin(); it != m_views.end(); ++it)
+    {
+        if (it->m_view == view)
+        {
+            m_views.erase(it);
+            break;
+        }
+    }
+
+    m_nbViews.storeRelease(m_views.size());
+}
+
 void SpectrumVis::start()
 {
     setRunning(true);
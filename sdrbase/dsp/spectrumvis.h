@@ -22,6 +22,7 @@
 #define INCLUDE_SPECTRUMVIS_H
 
 #include <QMutex>
+#include <QAtomicInt>
 
 #include "dsp/basebandsamplesink.h"
 #include "dsp/fftengine.h"
@@ -32,6 +33,7 @@
 #include "util/movingaverage2d.h"
 #include "util/fixedaverage2d.h"
 #include "util/max2d.h"
+#include "dsp/waterfallhistory.h"
 #include "websockets/wsspectrum.h"
 
 class GLSpectrumInterface;
@@ -90,6 +92,12 @@ public:
         AvgModeMax
     };
 
+    enum ViewMode
+    {
+        ViewModePeak,  //!< each bin of the view is the maximum of the FFT bins it covers
+        ViewModePower  //!< each bin of the view is the power sum of the FFT bins it covers like a smaller FFT
+    };
+
 	SpectrumVis(Real scalef);
 	virtual ~SpectrumVis();
 
@@ -107,10 +115,19 @@ public:
         FFTWindow::Function window,
         bool m_linear
     );
+    void configureWaterfallHistory(bool enabled, int memoryMB, const QString& spillDirectory);
     void setScalef(Real scalef);
     void configureWSSpectrum(const QString& address, uint16_t port);
     const GLSpectrumSettings& getSettings() const { return m_settings; }
     Real getSpecMax() const { return m_specMax / m_powFFTDiv; }
+    /**
+     * Additional consumer of a lower resolution view of the spectrum computed from the same FFT
+     * and averaging pass. Views with the same number of bins and mode are computed once per frame.
+     * The view is called from the DSP thread and is not called anymore when removeSpectrumView() returns.
+     */
+    void addSpectrumView(GLSpectrumInterface* view, unsigned int nbBins, ViewMode viewMode);
+    void removeSpectrumView(GLSpectrumInterface* view);
+    WaterfallHistory& getWaterfallHistory() { return m_waterfallHistory; } //!< history of the spectrum in dB (disabled by default)
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
     virtual void feed(const Complex *begin, unsigned int length); //!< direct FFT feed
@@ -176,8 +193,20 @@ private:
 	FFTWindow m_window;
     unsigned int m_fftEngineSequence;
 
+    struct SpectrumView
+    {
+        GLSpectrumInterface* m_view;
+        unsigned int m_nbBins;
+        ViewMode m_viewMode;
+        std::vector<Real> m_spectrum;
+    };
+
 	std::vector<Complex> m_fftBuffer;
-	std::vector<Real> m_powerSpectrum;
+	std::vector<Real> m_magsq;         //!< squared magnitudes then averaged power in display order
+	std::vector<Real> m_powerSpectrum; //!< last published frame
+	std::vector<Real> m_historySpectrum; //!< dB frame for the waterfall history when not published in dB
+	std::vector<SpectrumView> m_views;
+	QAtomicInt m_nbViews;              //!< number of views read without locking by the feed quick exit
 
     GLSpectrumSettings m_settings;
 	std::size_t m_overlapSize;
@@ -187,6 +216,7 @@ private:
 
 	Real m_scalef;
 	GLSpectrumInterface* m_glSpectrum;
+    WaterfallHistory m_waterfallHistory; //!< declared before m_wsSpectrum that queries it
     WSSpectrum m_wsSpectrum;
 	MovingAverage2D<double> m_movingAverage;
 	FixedAverage2D<double> m_fixedAverage;
@@ -203,6 +233,10 @@ private:
 	QMutex m_mutex;
 
     void setRunning(bool running) { m_running = running; }
+    void processPower(bool positiveOnly);
+    void scalePower(const Real *power, unsigned int nbBins, bool positiveOnly, bool linear, Real *spectrum);
+    void publishSpectrum();
+    void publishViews(bool positiveOnly);
     void applySettings(const GLSpectrumSettings& settings, bool force = false);
     void handleConfigureDSP(uint64_t centerFrequency, int sampleRate);
     void handleScalef(Real scalef);
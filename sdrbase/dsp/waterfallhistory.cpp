@@ -0,0 +1,482 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+
+#include <QDebug>
+#include <QFile>
+#include <QDir>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "waterfallhistory.h"
+
+bool WaterfallHistory::Request::deserialize(const QString& message)
+{
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(message.toUtf8(), &error);
+
+    if (error.error != QJsonParseError::NoError || !doc.isObject() || !doc.object().contains("history")) {
+        return false;
+    }
+
+    QJsonObject jsonObject = doc.object()["history"].toObject();
+    m_fromMs = (qint64) jsonObject["from"].toDouble(0);
+    m_toMs = (qint64) jsonObject["to"].toDouble(0);
+    m_startFrequency = (qint64) jsonObject["fmin"].toDouble(0);
+    m_endFrequency = (qint64) jsonObject["fmax"].toDouble(0);
+    setSize(jsonObject["lines"].toInt(512), jsonObject["bins"].toInt(1024));
+
+    return true;
+}
+
+void WaterfallHistory::Request::setSize(int lines, int bins)
+{
+    m_maxLines = lines < 1 ? 1 : lines > 4096 ? 4096 : lines;
+    m_nbBins = bins < 1 ? 1 : bins > 16384 ? 16384 : bins;
+}
+
+WaterfallHistory::WaterfallHistory() :
+    m_enabled(0),
+    m_lineStartMs(0),
+    m_lineStarted(false),
+    m_memoryBytes(0),
+    m_diskBytes(0)
+{
+    m_current.m_fftSize = 0;
+    m_current.m_centerFrequency = 0;
+    m_current.m_bandwidth = 0;
+    m_current.m_size = 0;
+}
+
+WaterfallHistory::~WaterfallHistory()
+{
+    clear();
+}
+
+void WaterfallHistory::configure(const Settings& settings)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    qDebug() << "WaterfallHistory::configure:"
+        << " m_enabled: " << settings.m_enabled
+        << " m_linePeriodMs: " << settings.m_linePeriodMs
+        << " m_tileLines: " << settings.m_tileLines
+        << " m_maxMemoryBytes: " << settings.m_maxMemoryBytes
+        << " m_spillDirectory: " << settings.m_spillDirectory
+        << " m_maxDiskBytes: " << settings.m_maxDiskBytes
+        << " m_minDb: " << settings.m_minDb
+        << " m_maxDb: " << settings.m_maxDb;
+
+    // stored lines would not be consistent with the new settings
+    if (!settings.m_enabled
+     || (settings.m_tileLines != m_settings.m_tileLines)
+     || (settings.m_minDb != m_settings.m_minDb)
+     || (settings.m_maxDb != m_settings.m_maxDb))
+    {
+        clear();
+    }
+
+    m_settings = settings;
+    m_settings.m_linePeriodMs = settings.m_linePeriodMs < 1 ? 1 : settings.m_linePeriodMs;
+    m_settings.m_tileLines = settings.m_tileLines < 1 ? 1 : settings.m_tileLines;
+    m_settings.m_maxDb = settings.m_maxDb > settings.m_minDb ? settings.m_maxDb : settings.m_minDb + 1.0f;
+
+    if (!m_settings.m_spillDirectory.isEmpty()) {
+        QDir().mkpath(m_settings.m_spillDirectory);
+    }
+
+    enforceLimits();
+    m_enabled.storeRelease(m_settings.m_enabled ? 1 : 0);
+}
+
+WaterfallHistory::Settings WaterfallHistory::getSettings()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_settings;
+}
+
+void WaterfallHistory::addLine(const Real *spectrumDb, unsigned int fftSize, qint64 timestampMs, qint64 centerFrequency, int bandwidth)
+{
+    if (!isEnabled()) {
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    // a tile has a single FFT geometry
+    if ((fftSize != m_current.m_fftSize)
+     || (centerFrequency != m_current.m_centerFrequency)
+     || (bandwidth != m_current.m_bandwidth))
+    {
+        if (m_lineStarted) {
+            completeLine();
+        }
+
+        completeTile();
+        m_current.m_fftSize = fftSize;
+        m_current.m_centerFrequency = centerFrequency;
+        m_current.m_bandwidth = bandwidth;
+    }
+
+    if (m_lineStarted)
+    {
+        for (unsigned int i = 0; i < fftSize; i++) {
+            m_line[i] = spectrumDb[i] > m_line[i] ? spectrumDb[i] : m_line[i];
+        }
+    }
+    else
+    {
+        m_line.assign(spectrumDb, spectrumDb + fftSize);
+        m_lineStartMs = timestampMs;
+        m_lineStarted = true;
+    }
+
+    if (timestampMs - m_lineStartMs >= m_settings.m_linePeriodMs) {
+        completeLine();
+    }
+}
+
+void WaterfallHistory::quantize(const Real *in, quint8 *out, unsigned int nbBins) const
+{
+    Real offset = m_settings.m_minDb;
+    Real invScale = 255.0f / (m_settings.m_maxDb - m_settings.m_minDb);
+
+    for (unsigned int i = 0; i < nbBins; i++)
+    {
+        Real q = (in[i] - offset) * invScale + 0.5f;
+        q = q < 0.0f ? 0.0f : q > 255.0f ? 255.0f : q;
+        out[i] = (quint8) q;
+    }
+}
+
+void WaterfallHistory::completeLine()
+{
+    std::size_t size = m_currentData.size();
+    m_currentData.resize(size + m_current.m_fftSize);
+    quantize(m_line.data(), m_currentData.data() + size, m_current.m_fftSize);
+    m_current.m_timestamps.push_back(m_lineStartMs);
+    m_lineStarted = false;
+
+    if (m_current.m_timestamps.size() >= m_settings.m_tileLines) {
+        completeTile();
+    }
+}
+
+void WaterfallHistory::completeTile()
+{
+    if (m_current.m_timestamps.size() == 0) {
+        return;
+    }
+
+    // difference with previous line from the last line so that the previous line is still intact
+    unsigned int fftSize = m_current.m_fftSize;
+
+    for (std::size_t line = m_current.m_timestamps.size() - 1; line > 0; line--)
+    {
+        quint8 *data = m_currentData.data() + line * fftSize;
+        const quint8 *previous = data - fftSize;
+
+        for (unsigned int i = 0; i < fftSize; i++) {
+            data[i] -= previous[i];
+        }
+    }
+
+    Tile tile = m_current;
+    tile.m_data = qCompress(m_currentData.data(), (int) m_currentData.size());
+    tile.m_size = tile.m_data.size();
+    m_memoryBytes += tile.m_size;
+    m_tiles.push_back(tile);
+
+    m_current.m_timestamps.clear();
+    m_currentData.clear();
+    enforceLimits();
+}
+
+void WaterfallHistory::enforceLimits()
+{
+    // tiles are spilled oldest first so in memory tiles follow the spilled ones
+    std::deque<Tile>::iterator it = m_tiles.begin();
+
+    while ((m_memoryBytes > m_settings.m_maxMemoryBytes) && (it != m_tiles.end()))
+    {
+        if (it->m_data.size() == 0)
+        {
+            ++it;
+            continue;
+        }
+
+        m_memoryBytes -= it->m_size;
+
+        if (!m_settings.m_spillDirectory.isEmpty())
+        {
+            QString fileName = QString("%1/waterfall_%2_%3.wfh")
+                .arg(m_settings.m_spillDirectory)
+                .arg(it->m_timestamps.front())
+                .arg(it->m_centerFrequency);
+            QFile file(fileName);
+
+            if (file.open(QIODevice::WriteOnly) && (file.write(it->m_data) == it->m_size))
+            {
+                it->m_spillFile = fileName;
+                it->m_data.clear();
+                m_diskBytes += it->m_size;
+                ++it;
+                continue;
+            }
+
+            qWarning("WaterfallHistory::enforceLimits: cannot write %s", qPrintable(fileName));
+            file.remove();
+        }
+
+        it = m_tiles.erase(it);
+    }
+
+    while ((m_diskBytes > m_settings.m_maxDiskBytes) && (m_tiles.size() != 0) && !m_tiles.front().m_spillFile.isEmpty())
+    {
+        QFile::remove(m_tiles.front().m_spillFile);
+        m_diskBytes -= m_tiles.front().m_size;
+        m_tiles.pop_front();
+    }
+}
+
+bool WaterfallHistory::decodeTile(const Tile& tile, std::vector<quint8>& data)
+{
+    QByteArray compressed;
+
+    if (tile.m_data.size() != 0)
+    {
+        compressed = tile.m_data;
+    }
+    else
+    {
+        QFile file(tile.m_spillFile);
+
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            qWarning("WaterfallHistory::decodeTile: cannot read %s", qPrintable(tile.m_spillFile));
+            return false;
+        }
+
+        compressed = file.readAll();
+    }
+
+    QByteArray bytes = qUncompress(compressed);
+    unsigned int fftSize = tile.m_fftSize;
+
+    if ((std::size_t) bytes.size() != tile.m_timestamps.size() * fftSize) {
+        return false;
+    }
+
+    data.assign((const quint8*) bytes.constData(), (const quint8*) bytes.constData() + bytes.size());
+
+    for (std::size_t i = fftSize; i < data.size(); i++) {
+        data[i] += data[i - fftSize];
+    }
+
+    return true;
+}
+
+bool WaterfallHistory::getWindow(const Request& request, Window& window)
+{
+    // Tiles in the window are copied under the lock (the compressed data is implicitly shared) then
+    // decoded outside of it so that addLine() in the DSP thread does not wait for the decompression
+    // or the disk. The current tile is the last one with its complete lines if currentTile is set.
+    std::vector<Tile> tiles;
+    std::vector<quint8> currentData;
+    bool currentTile = false;
+    qint64 toMs;
+
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+
+        if ((m_tiles.size() == 0) && (m_current.m_timestamps.size() == 0)) {
+            return false;
+        }
+
+        const Tile& lastTile = m_current.m_timestamps.size() != 0 ? m_current : m_tiles.back();
+        toMs = request.m_toMs > 0 ? request.m_toMs : lastTile.m_timestamps.back();
+        window.m_nbBins = request.m_nbBins;
+        window.m_startFrequency = request.m_startFrequency;
+        window.m_endFrequency = request.m_endFrequency;
+
+        if (window.m_endFrequency <= window.m_startFrequency) // defaults to the last FFT band
+        {
+            window.m_startFrequency = lastTile.m_centerFrequency - lastTile.m_bandwidth / 2;
+            window.m_endFrequency = window.m_startFrequency + lastTile.m_bandwidth;
+        }
+
+        window.m_offset = m_settings.m_minDb;
+        window.m_scale = (m_settings.m_maxDb - m_settings.m_minDb) / 255.0f;
+
+        for (const Tile& tile : m_tiles)
+        {
+            if ((tile.m_timestamps.back() >= request.m_fromMs) && (tile.m_timestamps.front() <= toMs)) {
+                tiles.push_back(tile);
+            }
+        }
+
+        if ((m_current.m_timestamps.size() != 0)
+         && (m_current.m_timestamps.back() >= request.m_fromMs)
+         && (m_current.m_timestamps.front() <= toMs))
+        {
+            tiles.push_back(m_current);
+            currentData = m_currentData;
+            currentTile = true;
+        }
+    }
+
+    std::size_t nbLines = 0;
+
+    for (const Tile& tile : tiles)
+    {
+        for (qint64 timestamp : tile.m_timestamps) {
+            nbLines += (timestamp >= request.m_fromMs) && (timestamp <= toMs) ? 1 : 0;
+        }
+    }
+
+    // lines above the requested number are peak held together
+    std::size_t group = (nbLines + request.m_maxLines - 1) / request.m_maxLines;
+    group = group < 1 ? 1 : group;
+    std::size_t nbOutLines = (nbLines + group - 1) / group;
+    window.m_timestamps.resize(nbOutLines);
+    window.m_values.assign(nbOutLines * window.m_nbBins, 0);
+
+    std::size_t lineIndex = 0;
+    std::vector<quint8> data;
+    std::vector<unsigned int> binStart(window.m_nbBins);
+    std::vector<unsigned int> binEnd(window.m_nbBins);
+    double outBinWidth = (double) (window.m_endFrequency - window.m_startFrequency) / window.m_nbBins;
+
+    for (std::size_t t = 0; t < tiles.size(); t++)
+    {
+        const Tile *tile = &tiles[t];
+        const quint8 *tileData;
+
+        if (currentTile && (t == tiles.size() - 1))
+        {
+            tileData = currentData.data();
+        }
+        else
+        {
+            if (!decodeTile(*tile, data))
+            {
+                for (qint64 timestamp : tile->m_timestamps) {
+                    lineIndex += (timestamp >= request.m_fromMs) && (timestamp <= toMs) ? 1 : 0;
+                }
+
+                continue;
+            }
+
+            tileData = data.data();
+        }
+
+        // FFT bins covered by each output bin
+        double binWidth = (double) tile->m_bandwidth / tile->m_fftSize;
+        double tileStart = tile->m_centerFrequency - tile->m_bandwidth / 2.0;
+
+        for (unsigned int b = 0; b < window.m_nbBins; b++)
+        {
+            double f0 = window.m_startFrequency + b * outBinWidth;
+            double i0 = std::floor((f0 - tileStart) / binWidth);
+            double i1 = std::ceil((f0 + outBinWidth - tileStart) / binWidth);
+            i1 = i1 <= i0 ? i0 + 1 : i1;
+            i0 = i0 < 0 ? 0 : i0;
+            i1 = i1 > tile->m_fftSize ? tile->m_fftSize : i1;
+            binStart[b] = i0 < i1 ? (unsigned int) i0 : 0;
+            binEnd[b] = i0 < i1 ? (unsigned int) i1 : 0;
+        }
+
+        for (std::size_t line = 0; line < tile->m_timestamps.size(); line++)
+        {
+            qint64 timestamp = tile->m_timestamps[line];
+
+            if ((timestamp < request.m_fromMs) || (timestamp > toMs)) {
+                continue;
+            }
+
+            std::size_t outLine = lineIndex / group;
+
+            if (lineIndex % group == 0) {
+                window.m_timestamps[outLine] = timestamp;
+            }
+
+            const quint8 *in = tileData + line * tile->m_fftSize;
+            quint8 *out = window.m_values.data() + outLine * window.m_nbBins;
+
+            for (unsigned int b = 0; b < window.m_nbBins; b++)
+            {
+                quint8 m = out[b];
+
+                for (unsigned int i = binStart[b]; i < binEnd[b]; i++) {
+                    m = in[i] > m ? in[i] : m;
+                }
+
+                out[b] = m;
+            }
+
+            lineIndex++;
+        }
+    }
+
+    return nbLines != 0;
+}
+
+void WaterfallHistory::getTimeRange(qint64& fromMs, qint64& toMs)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    fromMs = 0;
+    toMs = 0;
+
+    if (m_tiles.size() != 0) {
+        fromMs = m_tiles.front().m_timestamps.front();
+    } else if (m_current.m_timestamps.size() != 0) {
+        fromMs = m_current.m_timestamps.front();
+    }
+
+    if (m_current.m_timestamps.size() != 0) {
+        toMs = m_current.m_timestamps.back();
+    } else if (m_tiles.size() != 0) {
+        toMs = m_tiles.back().m_timestamps.back();
+    }
+}
+
+qint64 WaterfallHistory::getMemoryUsage()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_memoryBytes + m_currentData.size();
+}
+
+void WaterfallHistory::clear()
+{
+    for (const Tile& tile : m_tiles)
+    {
+        if (!tile.m_spillFile.isEmpty()) {
+            QFile::remove(tile.m_spillFile);
+        }
+    }
+
+    m_tiles.clear();
+    m_current.m_timestamps.clear();
+    m_current.m_fftSize = 0;
+    m_currentData.clear();
+    m_lineStarted = false;
+    m_memoryBytes = 0;
+    m_diskBytes = 0;
+}
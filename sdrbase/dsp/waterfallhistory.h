@@ -0,0 +1,152 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Waterfall history store fed by SpectrumVis                                    //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_WATERFALLHISTORY_H_
+#define SDRBASE_DSP_WATERFALLHISTORY_H_
+
+#include <vector>
+#include <deque>
+
+#include <QMutex>
+#include <QAtomicInt>
+#include <QByteArray>
+#include <QString>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+/**
+ * Waterfall lines are peak held over the line period and quantized on 8 bits over a fixed dB range.
+ * Lines are grouped in tiles of the same FFT geometry. Complete tiles are stored as the difference
+ * with the previous line compressed with zlib. Tiles are kept in a ring bounded in memory. The oldest
+ * tiles are either dropped or spilled to disk (also bounded) when the memory limit is exceeded.
+ * Any time and frequency window can be retrieved without reprocessing the samples.
+ */
+class SDRBASE_API WaterfallHistory
+{
+public:
+    struct Settings
+    {
+        bool m_enabled;
+        int m_linePeriodMs;         //!< time covered by one line (peak hold)
+        unsigned int m_tileLines;   //!< number of lines in a tile
+        qint64 m_maxMemoryBytes;    //!< memory limit of the compressed tiles
+        QString m_spillDirectory;   //!< tiles over the memory limit are written there. Empty to drop them.
+        qint64 m_maxDiskBytes;      //!< disk limit of the spilled tiles
+        float m_minDb;              //!< quantization lower bound
+        float m_maxDb;              //!< quantization upper bound
+
+        Settings() :
+            m_enabled(false),
+            m_linePeriodMs(100),
+            m_tileLines(64),
+            m_maxMemoryBytes(64*1024*1024),
+            m_maxDiskBytes(1024LL*1024*1024),
+            m_minDb(-150.0f),
+            m_maxDb(0.0f)
+        {}
+    };
+
+    struct Request
+    {
+        qint64 m_fromMs;          //!< Unix time in milliseconds
+        qint64 m_toMs;            //!< Unix time in milliseconds
+        qint64 m_startFrequency;  //!< Hz
+        qint64 m_endFrequency;    //!< Hz
+        unsigned int m_maxLines;  //!< lines are peak held together above this number
+        unsigned int m_nbBins;
+
+        Request() :
+            m_fromMs(0),
+            m_toMs(0),
+            m_startFrequency(0),
+            m_endFrequency(0),
+            m_maxLines(512),
+            m_nbBins(1024)
+        {}
+
+        bool deserialize(const QString& message); //!< from JSON {"history": {"from": .., "to": .., "fmin": .., "fmax": .., "lines": .., "bins": ..}}
+        void setSize(int lines, int bins); //!< clamped to the accepted ranges
+    };
+
+    struct Window
+    {
+        unsigned int m_nbBins;
+        qint64 m_startFrequency;
+        qint64 m_endFrequency;
+        float m_offset;                   //!< dB value = offset + q * scale
+        float m_scale;
+        std::vector<qint64> m_timestamps; //!< one per line oldest first
+        std::vector<quint8> m_values;     //!< lines of m_nbBins quantized values. Zero where there is no data.
+
+        Window() :
+            m_nbBins(0),
+            m_startFrequency(0),
+            m_endFrequency(0),
+            m_offset(0.0f),
+            m_scale(1.0f)
+        {}
+    };
+
+    WaterfallHistory();
+    ~WaterfallHistory();
+
+    void configure(const Settings& settings);
+    Settings getSettings();
+    bool isEnabled() const { return m_enabled.loadAcquire() != 0; }
+    /** spectrumDb: fftSize log power values in display order */
+    void addLine(const Real *spectrumDb, unsigned int fftSize, qint64 timestampMs, qint64 centerFrequency, int bandwidth);
+    bool getWindow(const Request& request, Window& window);
+    void getTimeRange(qint64& fromMs, qint64& toMs);
+    qint64 getMemoryUsage();
+
+private:
+    struct Tile
+    {
+        unsigned int m_fftSize;
+        qint64 m_centerFrequency;
+        int m_bandwidth;
+        std::vector<qint64> m_timestamps;
+        QByteArray m_data;      //!< compressed line differences. Empty when spilled.
+        QString m_spillFile;
+        qint64 m_size;          //!< compressed size
+    };
+
+    Settings m_settings;
+    QAtomicInt m_enabled;
+    QMutex m_mutex;
+    std::deque<Tile> m_tiles;   //!< complete tiles oldest first
+    Tile m_current;             //!< tile being filled
+    std::vector<quint8> m_currentData; //!< quantized lines of the current tile
+    std::vector<Real> m_line;   //!< peak hold of the line being built
+    qint64 m_lineStartMs;
+    bool m_lineStarted;
+    qint64 m_memoryBytes;
+    qint64 m_diskBytes;
+
+    void quantize(const Real *in, quint8 *out, unsigned int nbBins) const;
+    void completeLine();
+    void completeTile();
+    void enforceLimits();
+    static bool decodeTile(const Tile& tile, std::vector<quint8>& data);
+    void clear();
+};
+
+#endif // SDRBASE_DSP_WATERFALLHISTORY_H_
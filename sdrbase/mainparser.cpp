@@ -34,12 +34,32 @@ MainParser::MainParser() :
     m_fftwfWisdomOption(QStringList() << "w" << "fftwf-wisdom",
         "FFTW Wisdom file.",
         "file",
-        "")
+        ""),
+    m_benchChannelOption(QStringList() << "bench-channel",
+        "Server only: run the pipeline benchmark with channels of this type (ex: NFMDemod) on a test source then exit.",
+        "channel",
+        ""),
+    m_benchNbChannelsOption(QStringList() << "bench-nb-channels",
+        "Pipeline benchmark number of channels.",
+        "channels",
+        "1"),
+    m_benchDurationOption(QStringList() << "bench-duration",
+        "Pipeline benchmark duration in seconds.",
+        "seconds",
+        "10"),
+    m_benchSampleRateOption(QStringList() << "bench-sample-rate",
+        "Pipeline benchmark test source sample rate in S/s.",
+        "rate",
+        "2048000")
 {
     m_serverAddress = "127.0.0.1";
     m_serverPort = 8091;
     m_mimoSupport = false;
     m_fftwfWindowFileName = "";
+    m_benchChannel = "";
+    m_benchNbChannels = 1;
+    m_benchDuration = 10;
+    m_benchSampleRate = 2048000;
 
     m_parser.setApplicationDescription("Software Defined Radio application");
     m_parser.addHelpOption();
@@ -48,6 +68,10 @@ MainParser::MainParser() :
     m_parser.addOption(m_serverAddressOption);
     m_parser.addOption(m_serverPortOption);
     m_parser.addOption(m_fftwfWisdomOption);
+    m_parser.addOption(m_benchChannelOption);
+    m_parser.addOption(m_benchNbChannelsOption);
+    m_parser.addOption(m_benchDurationOption);
+    m_parser.addOption(m_benchSampleRateOption);
 }
 
 MainParser::~MainParser()
@@ -92,6 +116,34 @@ void MainParser::parse(const QCoreApplication& app)
 
     m_fftwfWindowFileName = m_parser.value(m_fftwfWisdomOption);
 
+    // pipeline benchmark
+
+    m_benchChannel = m_parser.value(m_benchChannelOption);
+
+    int benchNbChannels = m_parser.value(m_benchNbChannelsOption).toInt(&ok);
+
+    if (ok && (benchNbChannels > 0) && (benchNbChannels <= 64)) {
+        m_benchNbChannels = benchNbChannels;
+    } else {
+        qWarning() << "MainParser::parse: benchmark number of channels invalid. Defaulting to " << m_benchNbChannels;
+    }
+
+    int benchDuration = m_parser.value(m_benchDurationOption).toInt(&ok);
+
+    if (ok && (benchDuration > 0)) {
+        m_benchDuration = benchDuration;
+    } else {
+        qWarning() << "MainParser::parse: benchmark duration invalid. Defaulting to " << m_benchDuration;
+    }
+
+    int benchSampleRate = m_parser.value(m_benchSampleRateOption).toInt(&ok);
+
+    if (ok && (benchSampleRate > 0)) {
+        m_benchSampleRate = benchSampleRate;
+    } else {
+        qWarning() << "MainParser::parse: benchmark sample rate invalid. Defaulting to " << m_benchSampleRate;
+    }
+
     // MIMO - from version
 
     QStringList versionParts = app.applicationVersion().split(".");
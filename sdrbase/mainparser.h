@@ -36,17 +36,29 @@ public:
     uint16_t getServerPort() const { return m_serverPort; }
     bool getMIMOSupport() const { return m_mimoSupport; }
     const QString& getFFTWFWisdomFileName() const { return m_fftwfWindowFileName; }
+    const QString& getBenchChannel() const { return m_benchChannel; }
+    int getBenchNbChannels() const { return m_benchNbChannels; }
+    int getBenchDuration() const { return m_benchDuration; }
+    int getBenchSampleRate() const { return m_benchSampleRate; }
 
 private:
     QString  m_serverAddress;
     uint16_t m_serverPort;
     QString  m_fftwfWindowFileName;
     bool m_mimoSupport; //!< obtained from major version
+    QString  m_benchChannel;   //!< channel type of the pipeline benchmark. Empty if no benchmark.
+    int      m_benchNbChannels;
+    int      m_benchDuration;  //!< seconds
+    int      m_benchSampleRate;
 
     QCommandLineParser m_parser;
     QCommandLineOption m_serverAddressOption;
     QCommandLineOption m_serverPortOption;
     QCommandLineOption m_fftwfWisdomOption;
+    QCommandLineOption m_benchChannelOption;
+    QCommandLineOption m_benchNbChannelsOption;
+    QCommandLineOption m_benchDurationOption;
+    QCommandLineOption m_benchSampleRateOption;
 };
 
 
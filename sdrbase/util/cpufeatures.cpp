@@ -0,0 +1,131 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CPUFEATURES_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+#include <QByteArray>
+#include <QDebug>
+
+#include "cpufeatures.h"
+
+QAtomicInt CPUFeatures::m_maxLevel(CPUFeatures::LevelNEON); // no cap
+
+CPUFeatures::Level CPUFeatures::getDetectedLevel()
+{
+    static const Level detectedLevel = detect(); // thread safe initialization
+    return detectedLevel;
+}
+
+CPUFeatures::Level CPUFeatures::getLevel()
+{
+    Level detectedLevel = getDetectedLevel();
+    Level maxLevel = (Level) m_maxLevel.load();
+
+    if (detectedLevel == LevelNEON) { // not comparable to the x86 levels
+        return maxLevel == LevelNEON ? LevelNEON : LevelGeneric;
+    } else {
+        return detectedLevel < maxLevel ? detectedLevel : maxLevel;
+    }
+}
+
+void CPUFeatures::setMaxLevel(Level level)
+{
+    m_maxLevel.store((int) level);
+    qDebug("CPUFeatures::setMaxLevel: %s: kernels use %s", getLevelName(level), getLevelName(getLevel()));
+}
+
+const char *CPUFeatures::getLevelName(Level level)
+{
+    switch (level)
+    {
+    case LevelSSE2:
+        return "SSE2";
+    case LevelSSE4_1:
+        return "SSE4.1";
+    case LevelAVX2:
+        return "AVX2";
+    case LevelAVX512:
+        return "AVX512";
+    case LevelNEON:
+        return "NEON";
+    case LevelGeneric:
+    default:
+        return "generic";
+    }
+}
+
+CPUFeatures::Level CPUFeatures::detect()
+{
+    Level level = LevelGeneric;
+
+#if defined(CPUFEATURES_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int nbIds = info[0];
+    __cpuid(info, 1);
+    bool sse2 = (info[3] & (1<<26)) != 0;
+    bool sse4_1 = (info[2] & (1<<19)) != 0;
+    bool osxsave = (info[2] & (1<<27)) != 0;
+    unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+    bool avx2 = false;
+    bool avx512 = false;
+
+    if (nbIds >= 7)
+    {
+        __cpuidex(info, 7, 0);
+        avx2 = ((info[1] & (1<<5)) != 0) && ((xcr0 & 0x06) == 0x06);      // with OS support of the YMM registers
+        avx512 = ((info[1] & (1<<16)) != 0) && ((xcr0 & 0xe6) == 0xe6);   // with OS support of the ZMM registers
+    }
+
+    level = avx512 ? LevelAVX512 : avx2 ? LevelAVX2 : sse4_1 ? LevelSSE4_1 : sse2 ? LevelSSE2 : LevelGeneric;
+#elif defined(CPUFEATURES_X86)
+    __builtin_cpu_init(); // the OS support of the wider registers is checked as well
+
+    if (__builtin_cpu_supports("avx512f")) {
+        level = LevelAVX512;
+    } else if (__builtin_cpu_supports("avx2")) {
+        level = LevelAVX2;
+    } else if (__builtin_cpu_supports("sse4.1")) {
+        level = LevelSSE4_1;
+    } else if (__builtin_cpu_supports("sse2")) {
+        level = LevelSSE2;
+    }
+#elif defined(__aarch64__) || defined(USE_NEON)
+    level = LevelNEON;
+#endif
+
+    qDebug("CPUFeatures::detect: %s", getLevelName(level));
+    QByteArray maxLevelName = qgetenv("SDRANGEL_SIMD");
+
+    if (!maxLevelName.isEmpty())
+    {
+        for (int l = LevelGeneric; l <= LevelNEON; l++)
+        {
+            if (qstricmp(maxLevelName.constData(), getLevelName((Level) l)) == 0)
+            {
+                m_maxLevel.store(l);
+                qDebug("CPUFeatures::detect: limited to %s by SDRANGEL_SIMD", maxLevelName.constData());
+            }
+        }
+    }
+
+    return level;
+}
@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Run time detection of the SIMD instruction sets so that a single binary can   //
+// select the best variant of the DSP kernels on the machine it runs on.         //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_UTIL_CPUFEATURES_H_
+#define SDRBASE_UTIL_CPUFEATURES_H_
+
+#include <QAtomicInt>
+
+#include "export.h"
+
+// On x86 the kernels of every instruction set are compiled whatever the compiler flags. Each one is
+// a separate function with the target attribute (not needed with MSVC) and is called only when the
+// CPU supports its instruction set.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CPUFEATURES_X86 1
+#define CPUFEATURES_TARGET(isa) __attribute__((target(isa)))
+#elif (defined(_M_X64) || defined(_M_IX86)) && defined(_MSC_VER)
+#define CPUFEATURES_X86 1
+#define CPUFEATURES_TARGET(isa)
+#endif
+
+/**
+ * NEON is mandatory on 64 bit ARM. On 32 bit ARM it is used only when the build enables it (USE_NEON).
+ * The level can be lowered to compare the kernel variants (benchmarks) or to work around a faulty one
+ * with the SDRANGEL_SIMD environment variable set to one of the level names (ex: SDRANGEL_SIMD=sse2).
+ */
+class SDRBASE_API CPUFeatures
+{
+public:
+    enum Level
+    {
+        LevelGeneric, //!< plain C++
+        LevelSSE2,
+        LevelSSE4_1,
+        LevelAVX2,
+        LevelAVX512,  //!< AVX-512 F
+        LevelNEON
+    };
+
+    static Level getLevel();            //!< level in use by the kernels
+    static Level getDetectedLevel();    //!< best level supported by the CPU
+    static void setMaxLevel(Level level); //!< caps the level in use to the detected one at most
+    static const char *getLevelName(Level level);
+
+    static bool hasSSE2() { Level level = getLevel(); return (level >= LevelSSE2) && (level != LevelNEON); }
+    static bool hasSSE4_1() { Level level = getLevel(); return (level >= LevelSSE4_1) && (level != LevelNEON); }
+    static bool hasAVX2() { Level level = getLevel(); return (level >= LevelAVX2) && (level != LevelNEON); }
+    static bool hasAVX512() { return getLevel() == LevelAVX512; }
+    static bool hasNEON() { return getLevel() == LevelNEON; }
+
+private:
+    static QAtomicInt m_maxLevel;
+
+    static Level detect();
+};
+
+#endif // SDRBASE_UTIL_CPUFEATURES_H_
@@ -73,6 +73,39 @@ public:
         }
     }
 
+    /**
+     * Block version of storeAndGetAvg on indexes 0 to nbBins-1. out is written only when the result
+     * is available. out may be the same as in.
+     */
+    template<typename U>
+    bool storeAndGetAvg(const U *in, U *out, unsigned int nbBins)
+    {
+        if (m_size <= 1)
+        {
+            std::copy(in, in + nbBins, out);
+            return true;
+        }
+
+        for (unsigned int i = 0; i < nbBins; i++) {
+            m_sum[i] += in[i];
+        }
+
+        if (m_maxIndex == m_size - 1)
+        {
+            T size = m_size;
+
+            for (unsigned int i = 0; i < nbBins; i++) {
+                out[i] = m_sum[i] / size;
+            }
+
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
     bool storeAndGetSum(T& sum, T v, unsigned int index)
     {
         if (m_size <= 1)
@@ -78,6 +78,40 @@ public:
         }
     }
 
+    /**
+     * Block version of storeAndGetMax on indexes 0 to nbBins-1. out is written only when the result
+     * is available. out may be the same as in.
+     */
+    template<typename U>
+    bool storeAndGetMax(const U *in, U *out, unsigned int nbBins)
+    {
+        if (m_size <= 1)
+        {
+            std::copy(in, in + nbBins, out);
+            return true;
+        }
+
+        if (m_maxIndex == 0)
+        {
+            std::copy(in, in + nbBins, m_max);
+            return false;
+        }
+
+        for (unsigned int i = 0; i < nbBins; i++) {
+            m_max[i] = std::max(m_max[i], (T) in[i]);
+        }
+
+        if (m_maxIndex == m_size - 1)
+        {
+            std::copy(m_max, m_max + nbBins, out);
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
     bool nextMax()
     {
         if (m_size <= 1) {
@@ -18,13 +18,17 @@
 
 #include <QDebug>
 #include <QMutexLocker>
+
+#include <algorithm>
+
 #include "util/messagequeue.h"
 #include "util/message.h"
 
 MessageQueue::MessageQueue(QObject* parent) :
 	QObject(parent),
 	m_lock(QMutex::Recursive),
-	m_queue()
+	m_queue(),
+	m_highWaterMark(0)
 {
 }
 
@@ -45,6 +49,7 @@ void MessageQueue::push(Message* message, bool emitSignal)
 	{
 		m_lock.lock();
 		m_queue.append(message);
+		m_highWaterMark = std::max(m_highWaterMark, m_queue.size());
 		m_lock.unlock();
 	}
 
@@ -75,6 +80,13 @@ int MessageQueue::size()
 	return m_queue.size();
 }
 
+int MessageQueue::getHighWaterMark()
+{
+	QMutexLocker locker(&m_lock);
+
+	return m_highWaterMark;
+}
+
 void MessageQueue::clear()
 {
 	QMutexLocker locker(&m_lock);
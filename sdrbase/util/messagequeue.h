@@ -37,6 +37,7 @@ public:
 	Message* pop(); //!< Pop message from queue
 
 	int size(); //!< Returns queue size
+	int getHighWaterMark(); //!< Returns the largest queue size seen
 	void clear(); //!< Empty queue
 
 signals:
@@ -45,6 +46,7 @@ signals:
 private:
 	QMutex m_lock;
 	QQueue<Message*> m_queue;
+	int m_highWaterMark;
 };
 
 #endif // INCLUDE_MESSAGEQUEUE_H
@@ -105,6 +105,28 @@ public:
         }
     }
 
+    /** Block version of storeAndGetAvg on indexes 0 to nbBins-1. out may be the same as in. */
+    template<typename U>
+    void storeAndGetAvg(const U *in, U *out, unsigned int nbBins)
+    {
+        if (m_depth <= 1)
+        {
+            std::copy(in, in + nbBins, out);
+            return;
+        }
+
+        T *data = m_data + m_avgIndex*m_width;
+        T depth = m_depth;
+
+        for (unsigned int i = 0; i < nbBins; i++)
+        {
+            T v = in[i];
+            m_sum[i] += (v - data[i]);
+            data[i] = v;
+            out[i] = m_sum[i] / depth;
+        }
+    }
+
     void nextAverage() {
         m_avgIndex = m_avgIndex == m_depth-1 ? 0 : m_avgIndex+1;
     }
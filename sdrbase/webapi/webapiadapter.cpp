@@ -35,6 +35,12 @@
 #include "dsp/dspdevicesinkengine.h"
 #include "dsp/dspdevicemimoengine.h"
 #include "dsp/dspengine.h"
+#include "dsp/dspmetrics.h"
+#include "dsp/spectrumvis.h"
+#include "dsp/waterfallhistory.h"
+#include "dsp/basebandsamplesink.h"
+#include "dsp/samplesinkfifo.h"
+#include "dsp/samplefifostats.h"
 #include "plugin/pluginapi.h"
 #include "plugin/pluginmanager.h"
 #include "channel/channelapi.h"
@@ -48,6 +54,7 @@
 #include "SWGDeviceListItem.h"
 #include "SWGAudioDevices.h"
 #include "SWGLocationInformation.h"
+#include "SWGMetricsSettings.h"
 #include "SWGDVSerialDevices.h"
 #include "SWGDVSerialDevice.h"
 #include "SWGAMBEDevices.h"
@@ -64,6 +71,11 @@
 #include "SWGChannelSettings.h"
 #include "SWGChannelReport.h"
 #include "SWGChannelActions.h"
+#include "SWGDeviceSetMetrics.h"
+#include "SWGChannelMetrics.h"
+#include "SWGFifoMetrics.h"
+#include "SWGWaterfallHistorySettings.h"
+#include "SWGWaterfallHistoryWindow.h"
 #include "SWGSuccessResponse.h"
 #include "SWGErrorResponse.h"
 #include "SWGDeviceState.h"
@@ -708,6 +720,121 @@ int WebAPIAdapter::instanceLocationPut(
     return 200;
 }
 
+int WebAPIAdapter::instanceMetricsGet(
+        SWGSDRangel::SWGMetricsSettings& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    (void) error;
+    response.init();
+    response.setEnabled(DSPMetrics::isEnabled() ? 1 : 0);
+
+    return 200;
+}
+
+int WebAPIAdapter::instanceMetricsPut(
+        SWGSDRangel::SWGMetricsSettings& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    (void) error;
+    DSPMetrics::setEnabled(response.getEnabled() != 0);
+    response.setEnabled(DSPMetrics::isEnabled() ? 1 : 0);
+
+    return 200;
+}
+
+int WebAPIAdapter::instanceOpenMetricsGet(
+        QString& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    (void) error;
+    QStringList deviceSampleRate, deviceQueueDepth, deviceQueueHighWaterMark;
+    QStringList channelQueueDepth, channelQueueHighWaterMark, channelSquelch;
+    std::vector<QStringList> deviceFifo(m_nbOpenMetricsFifoFamilies);
+    std::vector<QStringList> channelFifo(m_nbOpenMetricsFifoFamilies);
+
+    for (int i = 0; i < (int) m_mainCore->m_deviceSets.size(); i++)
+    {
+        DeviceSet *deviceSet = m_mainCore->m_deviceSets[i];
+
+        if (!deviceSet->m_deviceSourceEngine) { // Single Rx only
+            continue;
+        }
+
+        QString labels = QString("{deviceset=\"%1\",hwtype=\"%2\"}").arg(i).arg(deviceSet->m_deviceAPI->getHardwareId());
+        DeviceSampleSource *source = deviceSet->m_deviceAPI->getSampleSource();
+
+        if (source)
+        {
+            SampleFifoStats stats;
+            source->getSampleFifo()->getStats(stats);
+            deviceSampleRate.append(labels + QString(" %1").arg(source->getSampleRate()));
+            appendOpenMetricsFifoSamples(deviceFifo, labels, stats);
+        }
+
+        MessageQueue *engineQueue = deviceSet->m_deviceSourceEngine->getInputMessageQueue();
+        deviceQueueDepth.append(labels + QString(" %1").arg(engineQueue->size()));
+        deviceQueueHighWaterMark.append(labels + QString(" %1").arg(engineQueue->getHighWaterMark()));
+
+        for (int j = 0; j < deviceSet->m_deviceAPI->getNbSinkChannels(); j++)
+        {
+            ChannelAPI *channel = deviceSet->m_deviceAPI->getChanelSinkAPIAt(j);
+            BasebandSampleSink *sink = dynamic_cast<BasebandSampleSink*>(channel);
+
+            if (!sink) {
+                continue;
+            }
+
+            QString channelType;
+            channel->getIdentifier(channelType);
+            QString channelLabels = QString("{deviceset=\"%1\",channel=\"%2\",type=\"%3\"}").arg(i).arg(j).arg(channelType);
+            SampleFifoStats stats;
+            bool squelchOpen;
+
+            if (sink->getFifoStats(stats)) {
+                appendOpenMetricsFifoSamples(channelFifo, channelLabels, stats);
+            }
+
+            if (sink->getSquelchState(squelchOpen)) {
+                channelSquelch.append(channelLabels + (squelchOpen ? " 1" : " 0"));
+            }
+
+            channelQueueDepth.append(channelLabels + QString(" %1").arg(sink->getInputMessageQueue()->size()));
+            channelQueueHighWaterMark.append(channelLabels + QString(" %1").arg(sink->getInputMessageQueue()->getHighWaterMark()));
+        }
+    }
+
+    response.clear();
+    appendOpenMetricsFamily(response, "sdrangel_metrics_enabled", "gauge", "Processing times are measured (1) or not (0)",
+        QStringList() << QString(DSPMetrics::isEnabled() ? " 1" : " 0"));
+    appendOpenMetricsFamily(response, "sdrangel_device_sample_rate", "gauge", "Device sample rate in S/s", deviceSampleRate);
+
+    for (int k = 0; k < m_nbOpenMetricsFifoFamilies; k++)
+    {
+        appendOpenMetricsFamily(response, QString("sdrangel_device_%1").arg(m_openMetricsFifoFamilies[k].m_name),
+            m_openMetricsFifoFamilies[k].m_type, QString("Device FIFO: %1").arg(m_openMetricsFifoFamilies[k].m_help), deviceFifo[k]);
+    }
+
+    appendOpenMetricsFamily(response, "sdrangel_device_message_queue_depth", "gauge",
+        "Messages waiting in the device engine input queue", deviceQueueDepth);
+    appendOpenMetricsFamily(response, "sdrangel_device_message_queue_high_water_mark", "gauge",
+        "Largest number of messages seen in the device engine input queue", deviceQueueHighWaterMark);
+
+    for (int k = 0; k < m_nbOpenMetricsFifoFamilies; k++)
+    {
+        appendOpenMetricsFamily(response, QString("sdrangel_channel_%1").arg(m_openMetricsFifoFamilies[k].m_name),
+            m_openMetricsFifoFamilies[k].m_type, QString("Channel FIFO: %1").arg(m_openMetricsFifoFamilies[k].m_help), channelFifo[k]);
+    }
+
+    appendOpenMetricsFamily(response, "sdrangel_channel_message_queue_depth", "gauge",
+        "Messages waiting in the channel input queue", channelQueueDepth);
+    appendOpenMetricsFamily(response, "sdrangel_channel_message_queue_high_water_mark", "gauge",
+        "Largest number of messages seen in the channel input queue", channelQueueHighWaterMark);
+    appendOpenMetricsFamily(response, "sdrangel_channel_squelch_open", "gauge", "Squelch open (1) or closed (0)", channelSquelch);
+    response += "# EOF\n";
+
+    return 200;
+}
+
 int WebAPIAdapter::instanceDVSerialGet(
             SWGSDRangel::SWGDVSerialDevices& response,
             SWGSDRangel::SWGErrorResponse& error)
@@ -2072,6 +2199,157 @@ int WebAPIAdapter::devicesetChannelsReportGet(
     }
 }
 
+int WebAPIAdapter::devicesetMetricsGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGDeviceSetMetrics& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine) // Single Rx
+        {
+            getDeviceSetMetrics(&response, deviceSet);
+            return 200;
+        }
+        else
+        {
+            *error.getMessage() = QString("Metrics are only available for single Rx device sets");
+            return 501;
+        }
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapter::devicesetSpectrumHistoryGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGWaterfallHistorySettings& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+        response.init();
+        getWaterfallHistorySettings(&response, deviceSet->m_spectrumVis->getWaterfallHistory());
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapter::devicesetSpectrumHistoryPatch(
+        int deviceSetIndex,
+        const QStringList& historySettingsKeys,
+        SWGSDRangel::SWGWaterfallHistorySettings& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+        WaterfallHistory& history = deviceSet->m_spectrumVis->getWaterfallHistory();
+        WaterfallHistory::Settings historySettings = history.getSettings();
+        bool enabled = historySettings.m_enabled;
+        int memoryMB = historySettings.m_maxMemoryBytes / (1024*1024);
+        QString spillDirectory = historySettings.m_spillDirectory;
+
+        if (historySettingsKeys.contains("enabled")) {
+            enabled = response.getEnabled() != 0;
+        }
+        if (historySettingsKeys.contains("memory")) {
+            memoryMB = response.getMemory();
+        }
+        if (historySettingsKeys.contains("spillDirectory")) {
+            spillDirectory = *response.getSpillDirectory();
+        }
+
+        if ((memoryMB < 1) || (memoryMB > 4096))
+        {
+            *error.getMessage() = QString("Waterfall history memory must be between 1 and 4096 MB");
+            return 400;
+        }
+
+        deviceSet->m_spectrumVis->configureWaterfallHistory(enabled, memoryMB, spillDirectory);
+        getWaterfallHistorySettings(&response, history);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapter::devicesetSpectrumHistoryWindowGet(
+        int deviceSetIndex,
+        qint64 fromMs,
+        qint64 toMs,
+        qint64 startFrequency,
+        qint64 endFrequency,
+        int maxLines,
+        int nbBins,
+        SWGSDRangel::SWGWaterfallHistoryWindow& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+        WaterfallHistory& history = deviceSet->m_spectrumVis->getWaterfallHistory();
+
+        if (!history.isEnabled())
+        {
+            *error.getMessage() = QString("Waterfall history of device set %1 is disabled").arg(deviceSetIndex);
+            return 404;
+        }
+
+        WaterfallHistory::Request request;
+        request.m_fromMs = fromMs;
+        request.m_toMs = toMs;
+        request.m_startFrequency = startFrequency;
+        request.m_endFrequency = endFrequency;
+        request.setSize(maxLines, nbBins);
+        WaterfallHistory::Window window;
+        history.getWindow(request, window); // no lines if there is no history in the window
+
+        response.init();
+        response.setNbLines(window.m_timestamps.size());
+        response.setNbBins(window.m_nbBins);
+        response.setStartFrequency(window.m_startFrequency);
+        response.setEndFrequency(window.m_endFrequency);
+        response.setOffset(window.m_offset);
+        response.setScale(window.m_scale);
+
+        for (qint64 timestamp : window.m_timestamps) {
+            response.getTimestamps()->append(timestamp);
+        }
+
+        // same encoding as the values of the websocket history window
+        QByteArray values = qCompress(window.m_values.data(), (int) window.m_values.size());
+        *response.getValues() = QString(values.toBase64());
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
 int WebAPIAdapter::devicesetChannelPost(
             int deviceSetIndex,
             SWGSDRangel::SWGChannelSettings& query,
@@ -2440,6 +2718,46 @@ int WebAPIAdapter::devicesetChannelReportGet(
     }
 }
 
+int WebAPIAdapter::devicesetChannelMetricsGet(
+            int deviceSetIndex,
+            int channelIndex,
+            SWGSDRangel::SWGChannelMetrics& response,
+            SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine) // Single Rx
+        {
+            ChannelAPI *channelAPI = deviceSet->m_deviceAPI->getChanelSinkAPIAt(channelIndex);
+
+            if (channelAPI == nullptr)
+            {
+                *error.getMessage() = QString("There is no channel with index %1").arg(channelIndex);
+                return 404;
+            }
+            else
+            {
+                getChannelMetrics(&response, channelAPI, channelIndex);
+                return 200;
+            }
+        }
+        else
+        {
+            *error.getMessage() = QString("Metrics are only available for single Rx device sets");
+            return 501;
+        }
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
 int WebAPIAdapter::devicesetChannelActionsPost(
         int deviceSetIndex,
         int channelIndex,
@@ -3389,6 +3707,127 @@ int WebAPIAdapter::featuresetGet(
     }
 }
 
+void WebAPIAdapter::getDeviceSetMetrics(SWGSDRangel::SWGDeviceSetMetrics *deviceSetMetrics, DeviceSet* deviceSet)
+{
+    deviceSetMetrics->init();
+    deviceSetMetrics->setMetricsEnabled(DSPMetrics::isEnabled() ? 1 : 0);
+    DeviceSampleSource *source = deviceSet->m_deviceAPI->getSampleSource();
+
+    if (source)
+    {
+        SampleFifoStats stats;
+        source->getSampleFifo()->getStats(stats);
+        deviceSetMetrics->setSampleRate(source->getSampleRate());
+        getFifoMetrics(deviceSetMetrics->getDeviceFifo(), stats);
+    }
+
+    MessageQueue *engineQueue = deviceSet->m_deviceSourceEngine->getInputMessageQueue();
+    deviceSetMetrics->setMessageQueueDepth(engineQueue->size());
+    deviceSetMetrics->setMessageQueueHighWaterMark(engineQueue->getHighWaterMark());
+    QList<SWGSDRangel::SWGChannelMetrics*> *channels = deviceSetMetrics->getChannels();
+
+    for (int i = 0; i < deviceSet->m_deviceAPI->getNbSinkChannels(); i++)
+    {
+        channels->append(new SWGSDRangel::SWGChannelMetrics);
+        getChannelMetrics(channels->back(), deviceSet->m_deviceAPI->getChanelSinkAPIAt(i), i);
+    }
+}
+
+void WebAPIAdapter::getChannelMetrics(SWGSDRangel::SWGChannelMetrics *channelMetrics, ChannelAPI *channel, int channelIndex)
+{
+    channelMetrics->init();
+    channelMetrics->setIndex(channelIndex);
+    channel->getIdentifier(*channelMetrics->getChannelType());
+    BasebandSampleSink *sink = dynamic_cast<BasebandSampleSink*>(channel);
+
+    if (sink)
+    {
+        SampleFifoStats stats;
+
+        if (sink->getFifoStats(stats)) {
+            getFifoMetrics(channelMetrics->getFifo(), stats);
+        }
+
+        channelMetrics->setMessageQueueDepth(sink->getInputMessageQueue()->size());
+        channelMetrics->setMessageQueueHighWaterMark(sink->getInputMessageQueue()->getHighWaterMark());
+        bool squelchOpen;
+
+        if (sink->getSquelchState(squelchOpen)) {
+            channelMetrics->setSquelch(squelchOpen ? 1 : 0);
+        }
+    }
+}
+
+void WebAPIAdapter::getFifoMetrics(SWGSDRangel::SWGFifoMetrics *fifoMetrics, const SampleFifoStats& stats)
+{
+    fifoMetrics->setSize(stats.m_size);
+    fifoMetrics->setFill(stats.m_fill);
+    fifoMetrics->setHighWaterMark(stats.m_highWaterMark);
+    fifoMetrics->setNbWritten(stats.m_nbWritten);
+    fifoMetrics->setNbDropped(stats.m_nbDropped);
+    fifoMetrics->setNbOverflows(stats.m_nbOverflows);
+    fifoMetrics->setNbRead(stats.m_nbRead);
+    fifoMetrics->setProcessingTime(stats.m_readNsecs);
+}
+
+void WebAPIAdapter::getWaterfallHistorySettings(SWGSDRangel::SWGWaterfallHistorySettings *historySettings, WaterfallHistory& history)
+{
+    WaterfallHistory::Settings settings = history.getSettings();
+    qint64 fromMs, toMs;
+    history.getTimeRange(fromMs, toMs);
+    historySettings->setEnabled(settings.m_enabled ? 1 : 0);
+    historySettings->setMemory(settings.m_maxMemoryBytes / (1024*1024));
+
+    if (historySettings->getSpillDirectory()) {
+        *historySettings->getSpillDirectory() = settings.m_spillDirectory;
+    } else {
+        historySettings->setSpillDirectory(new QString(settings.m_spillDirectory));
+    }
+
+    historySettings->setFromTime(fromMs);
+    historySettings->setToTime(toMs);
+    historySettings->setMemoryUsage(history.getMemoryUsage());
+}
+
+const WebAPIAdapter::OpenMetricsFamily WebAPIAdapter::m_openMetricsFifoFamilies[WebAPIAdapter::m_nbOpenMetricsFifoFamilies] = {
+    {"fifo_size_samples", "gauge", "size in samples"},
+    {"fifo_fill_samples", "gauge", "samples waiting to be read"},
+    {"fifo_high_water_mark_samples", "gauge", "largest fill seen in samples"},
+    {"fifo_written_samples", "counter", "samples written"},
+    {"fifo_dropped_samples", "counter", "samples dropped on overflow"},
+    {"fifo_overflows", "counter", "overflow events"},
+    {"fifo_read_samples", "counter", "samples read"},
+    {"processing_seconds", "counter", "time spent processing the samples read when metrics are enabled"}
+};
+
+void WebAPIAdapter::appendOpenMetricsFifoSamples(std::vector<QStringList>& samples, const QString& labels, const SampleFifoStats& stats)
+{
+    samples[0].append(labels + QString(" %1").arg(stats.m_size));
+    samples[1].append(labels + QString(" %1").arg(stats.m_fill));
+    samples[2].append(labels + QString(" %1").arg(stats.m_highWaterMark));
+    samples[3].append(labels + QString(" %1").arg(stats.m_nbWritten));
+    samples[4].append(labels + QString(" %1").arg(stats.m_nbDropped));
+    samples[5].append(labels + QString(" %1").arg(stats.m_nbOverflows));
+    samples[6].append(labels + QString(" %1").arg(stats.m_nbRead));
+    samples[7].append(labels + QString(" %1").arg(QString::number(stats.m_readNsecs / 1e9, 'f', 9)));
+}
+
+void WebAPIAdapter::appendOpenMetricsFamily(QString& text, const QString& name, const char *type, const QString& help, const QStringList& samples)
+{
+    if (samples.size() == 0) {
+        return;
+    }
+
+    // counter samples are suffixed by _total
+    QString sampleName = QString(type) == "counter" ? name + "_total" : name;
+    text += QString("# TYPE %1 %2\n").arg(name).arg(type);
+    text += QString("# HELP %1 %2\n").arg(name).arg(help);
+
+    for (const QString& sample : samples) {
+        text += sampleName + sample + "\n";
+    }
+}
+
 void WebAPIAdapter::getFeatureSetList(SWGSDRangel::SWGFeatureSetList* featureSetList)
 {
     featureSetList->init();
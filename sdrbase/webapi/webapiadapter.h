@@ -28,6 +28,9 @@
 class MainCore;
 class DeviceSet;
 class FeatureSet;
+class ChannelAPI;
+struct SampleFifoStats;
+class WaterfallHistory;
 
 class SDRBASE_API WebAPIAdapter: public WebAPIAdapterInterface
 {
@@ -111,6 +114,18 @@ public:
             SWGSDRangel::SWGLocationInformation& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int instanceMetricsGet(
+            SWGSDRangel::SWGMetricsSettings& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int instanceMetricsPut(
+            SWGSDRangel::SWGMetricsSettings& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int instanceOpenMetricsGet(
+            QString& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int instanceDVSerialGet(
             SWGSDRangel::SWGDVSerialDevices& response,
             SWGSDRangel::SWGErrorResponse& error);
@@ -286,6 +301,33 @@ public:
             SWGSDRangel::SWGChannelsDetail& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int devicesetMetricsGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGDeviceSetMetrics& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumHistoryGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGWaterfallHistorySettings& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumHistoryPatch(
+            int deviceSetIndex,
+            const QStringList& historySettingsKeys,
+            SWGSDRangel::SWGWaterfallHistorySettings& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumHistoryWindowGet(
+            int deviceSetIndex,
+            qint64 fromMs,
+            qint64 toMs,
+            qint64 startFrequency,
+            qint64 endFrequency,
+            int maxLines,
+            int nbBins,
+            SWGSDRangel::SWGWaterfallHistoryWindow& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int devicesetChannelPost(
             int deviceSetIndex,
             SWGSDRangel::SWGChannelSettings& query,
@@ -326,6 +368,12 @@ public:
             SWGSDRangel::SWGChannelReport& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int devicesetChannelMetricsGet(
+            int deviceSetIndex,
+            int channelIndex,
+            SWGSDRangel::SWGChannelMetrics& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int featuresetGet(
             int deviceSetIndex,
             SWGSDRangel::SWGFeatureSet& response,
@@ -395,6 +443,22 @@ private:
     void getDeviceSetList(SWGSDRangel::SWGDeviceSetList* deviceSetList);
     void getDeviceSet(SWGSDRangel::SWGDeviceSet *swgDeviceSet, const DeviceSet* deviceSet, int deviceSetIndex);
     void getChannelsDetail(SWGSDRangel::SWGChannelsDetail *channelsDetail, const DeviceSet* deviceSet);
+    void getDeviceSetMetrics(SWGSDRangel::SWGDeviceSetMetrics *deviceSetMetrics, DeviceSet* deviceSet);
+    void getChannelMetrics(SWGSDRangel::SWGChannelMetrics *channelMetrics, ChannelAPI *channel, int channelIndex);
+    static void getFifoMetrics(SWGSDRangel::SWGFifoMetrics *fifoMetrics, const SampleFifoStats& stats);
+    static void getWaterfallHistorySettings(SWGSDRangel::SWGWaterfallHistorySettings *historySettings, WaterfallHistory& history);
+
+    struct OpenMetricsFamily
+    {
+        const char *m_name;
+        const char *m_type; //!< gauge or counter
+        const char *m_help;
+    };
+
+    static const int m_nbOpenMetricsFifoFamilies = 8;
+    static const OpenMetricsFamily m_openMetricsFifoFamilies[m_nbOpenMetricsFifoFamilies]; //!< FIFO statistics in SampleFifoStats order
+    static void appendOpenMetricsFifoSamples(std::vector<QStringList>& samples, const QString& labels, const SampleFifoStats& stats);
+    static void appendOpenMetricsFamily(QString& text, const QString& name, const char *type, const QString& help, const QStringList& samples);
     void getFeatureSetList(SWGSDRangel::SWGFeatureSetList* featureSetList);
     void getFeatureSet(SWGSDRangel::SWGFeatureSet *swgFeatureSet, const FeatureSet* featureSet, int featureSetIndex);
     static QtMsgType getMsgTypeFromString(const QString& msgTypeString);
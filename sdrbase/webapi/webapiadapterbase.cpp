@@ -165,6 +165,9 @@ void WebAPIAdapterBase::webapiFormatPreset(
         swgSpectrumConfig->setAveragingMode((int) m_spectrumSettings.m_averagingMode);
         swgSpectrumConfig->setAveragingValue(GLSpectrumSettings::getAveragingValue(m_spectrumSettings.m_averagingIndex, m_spectrumSettings.m_averagingMode));
         swgSpectrumConfig->setLinear(m_spectrumSettings.m_linear ? 1 : 0);
+        swgSpectrumConfig->setWaterfallHistory(m_spectrumSettings.m_waterfallHistory ? 1 : 0);
+        swgSpectrumConfig->setWaterfallHistoryMemory(m_spectrumSettings.m_waterfallHistoryMemoryMB);
+        swgSpectrumConfig->setWaterfallHistorySpillDirectory(new QString(m_spectrumSettings.m_waterfallHistorySpillDirectory));
     }
 
     int nbChannels = preset.getChannelCount();
@@ -373,6 +376,15 @@ void WebAPIAdapterBase::webapiUpdatePreset(
         if (spectrumIt->contains("refLevel")) {
             spectrumSettings.m_refLevel = apiPreset->getSpectrumConfig()->getRefLevel();
         }
+        if (spectrumIt->contains("waterfallHistory")) {
+            spectrumSettings.m_waterfallHistory = apiPreset->getSpectrumConfig()->getWaterfallHistory() != 0;
+        }
+        if (spectrumIt->contains("waterfallHistoryMemory")) {
+            spectrumSettings.m_waterfallHistoryMemoryMB = apiPreset->getSpectrumConfig()->getWaterfallHistoryMemory();
+        }
+        if (spectrumIt->contains("waterfallHistorySpillDirectory")) {
+            spectrumSettings.m_waterfallHistorySpillDirectory = *apiPreset->getSpectrumConfig()->getWaterfallHistorySpillDirectory();
+        }
         if (spectrumIt->contains("waterfallShare")) {
             spectrumSettings.m_waterfallShare = apiPreset->getSpectrumConfig()->getWaterfallShare();
         }
@@ -30,6 +30,8 @@ QString WebAPIAdapterInterface::instanceAudioOutputParametersURL = "/sdrangel/au
 QString WebAPIAdapterInterface::instanceAudioInputCleanupURL = "/sdrangel/audio/input/cleanup";
 QString WebAPIAdapterInterface::instanceAudioOutputCleanupURL = "/sdrangel/audio/output/cleanup";
 QString WebAPIAdapterInterface::instanceLocationURL = "/sdrangel/location";
+QString WebAPIAdapterInterface::instanceMetricsURL = "/sdrangel/metrics";
+QString WebAPIAdapterInterface::instanceOpenMetricsURL = "/metrics";
 QString WebAPIAdapterInterface::instanceAMBESerialURL = "/sdrangel/ambe/serial";
 QString WebAPIAdapterInterface::instanceAMBEDevicesURL = "/sdrangel/ambe/devices";
 QString WebAPIAdapterInterface::instanceLimeRFESerialURL = "/sdrangel/limerfe/serial";
@@ -50,12 +52,16 @@ std::regex WebAPIAdapterInterface::devicesetDeviceRunURLRe("^/sdrangel/deviceset
 std::regex WebAPIAdapterInterface::devicesetDeviceSubsystemRunURLRe("^/sdrangel/deviceset/([0-9]{1,2})/subdevice/([0-9]{1,2})/run$");
 std::regex WebAPIAdapterInterface::devicesetDeviceReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/report$");
 std::regex WebAPIAdapterInterface::devicesetDeviceActionsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/actions$");
+std::regex WebAPIAdapterInterface::devicesetMetricsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/metrics$");
+std::regex WebAPIAdapterInterface::devicesetSpectrumHistoryURLRe("^/sdrangel/deviceset/([0-9]{1,2})/spectrum/history$");
+std::regex WebAPIAdapterInterface::devicesetSpectrumHistoryWindowURLRe("^/sdrangel/deviceset/([0-9]{1,2})/spectrum/history/window$");
 std::regex WebAPIAdapterInterface::devicesetChannelsReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channels/report$");
 std::regex WebAPIAdapterInterface::devicesetChannelURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel$");
 std::regex WebAPIAdapterInterface::devicesetChannelIndexURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})$");
 std::regex WebAPIAdapterInterface::devicesetChannelSettingsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/settings$");
 std::regex WebAPIAdapterInterface::devicesetChannelReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/report");
 std::regex WebAPIAdapterInterface::devicesetChannelActionsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/actions");
+std::regex WebAPIAdapterInterface::devicesetChannelMetricsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/metrics$");
 
 std::regex WebAPIAdapterInterface::featuresetURLRe("^/sdrangel/featureset/([0-9]{1,2})$");
 std::regex WebAPIAdapterInterface::featuresetFeatureURLRe("^/sdrangel/featureset/([0-9]{1,2})/feature$");
@@ -40,6 +40,7 @@ namespace SWGSDRangel
     class SWGAudioInputDevice;
     class SWGAudioOutputDevice;
     class SWGLocationInformation;
+    class SWGMetricsSettings;
     class SWGDVSerialDevices;
     class SWGAMBEDevices;
     class SWGLimeRFEDevices;
@@ -57,10 +58,15 @@ namespace SWGSDRangel
     class SWGDeviceState;
     class SWGDeviceReport;
     class SWGDeviceActions;
+    class SWGDeviceSetMetrics;
+    class SWGWaterfallHistorySettings;
+    class SWGWaterfallHistoryWindow;
     class SWGChannelsDetail;
     class SWGChannelSettings;
     class SWGChannelReport;
     class SWGChannelActions;
+    class SWGChannelMetrics;
+    class SWGFifoMetrics;
     class SWGSuccessResponse;
     class SWGFeatureSetList;
     class SWGFeatureSet;
@@ -372,6 +378,49 @@ public:
     	return 501;
     }
 
+    /**
+     * Handler of /sdrangel/metrics (GET)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int instanceMetricsGet(
+            SWGSDRangel::SWGMetricsSettings& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/metrics (PUT)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int instanceMetricsPut(
+            SWGSDRangel::SWGMetricsSettings& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /metrics (GET) for Prometheus scrapers
+     * response is the metrics in OpenMetrics text exposition format
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int instanceOpenMetricsGet(
+            QString& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
     /**
      * Handler of /sdrangel/ambe/serial (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
      * returns the Http status code (default 501: not implemented)
@@ -880,6 +929,84 @@ public:
         return 501;
     }
 
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/metrics (GET)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetMetricsGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGDeviceSetMetrics& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/history (GET)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumHistoryGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGWaterfallHistorySettings& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/history (PATCH)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumHistoryPatch(
+            int deviceSetIndex,
+            const QStringList& historySettingsKeys,
+            SWGSDRangel::SWGWaterfallHistorySettings& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) historySettingsKeys;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/spectrum/history/window (GET)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumHistoryWindowGet(
+            int deviceSetIndex,
+            qint64 fromMs,
+            qint64 toMs,
+            qint64 startFrequency,
+            qint64 endFrequency,
+            int maxLines,
+            int nbBins,
+            SWGSDRangel::SWGWaterfallHistoryWindow& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) fromMs;
+        (void) toMs;
+        (void) startFrequency;
+        (void) endFrequency;
+        (void) maxLines;
+        (void) nbBins;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
     /**
      * Handler of /sdrangel/deviceset/{devicesetIndex}/channels/report (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
      * returns the Http status code (default 501: not implemented)
@@ -1013,6 +1140,24 @@ public:
         return 501;
     }
 
+    /**
+     * Handler of /sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/metrics (GET)
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetChannelMetricsGet(
+            int deviceSetIndex,
+            int channelIndex,
+            SWGSDRangel::SWGChannelMetrics& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) channelIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
     /**
      * Handler of /sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/actions (POST)
      * posts an action on the channel (default 501: not implemented)
@@ -1236,6 +1381,8 @@ public:
     static QString instanceAudioInputCleanupURL;
     static QString instanceAudioOutputCleanupURL;
     static QString instanceLocationURL;
+    static QString instanceMetricsURL;
+    static QString instanceOpenMetricsURL;
     static QString instanceAMBESerialURL;
     static QString instanceAMBEDevicesURL;
     static QString instanceLimeRFESerialURL;
@@ -1255,11 +1402,15 @@ public:
     static std::regex devicesetDeviceSubsystemRunURLRe;
     static std::regex devicesetDeviceReportURLRe;
     static std::regex devicesetDeviceActionsURLRe;
+    static std::regex devicesetMetricsURLRe;
+    static std::regex devicesetSpectrumHistoryURLRe;
+    static std::regex devicesetSpectrumHistoryWindowURLRe;
     static std::regex devicesetChannelURLRe;
     static std::regex devicesetChannelIndexURLRe;
     static std::regex devicesetChannelSettingsURLRe;
     static std::regex devicesetChannelReportURLRe;
     static std::regex devicesetChannelActionsURLRe;
+    static std::regex devicesetChannelMetricsURLRe;
     static std::regex devicesetChannelsReportURLRe;
     static std::regex featuresetURLRe;
     static std::regex featuresetFeatureURLRe;
@@ -19,13 +19,22 @@
 #include <QHostAddress>
 #include <QDebug>
 
+#include "dsp/spectrumvis.h"
+
 #include "wsspectrum.h"
 
 WSSpectrum::WSSpectrum(QObject *parent) :
     QObject(parent),
     m_listeningAddress(QHostAddress::LocalHost),
     m_port(8887),
-    m_webSocketServer(nullptr)
+    m_webSocketServer(nullptr),
+    m_waterfallHistory(nullptr),
+    m_spectrumVis(nullptr),
+    m_refLevel(0.0f),
+    m_powerRange(100.0f),
+    m_centerFrequency(0),
+    m_bandwidth(0),
+    m_linear(false)
 {
     m_timer.start();
 }
@@ -33,6 +42,10 @@ WSSpectrum::WSSpectrum(QObject *parent) :
 WSSpectrum::~WSSpectrum()
 {
     closeSocket();
+    QMutexLocker mutexLocker(&m_mutex);
+    qDeleteAll(m_streams);
+    qDeleteAll(m_streamViews); // the spectrum does not feed its views anymore
+    qDeleteAll(m_removedViews);
 }
 
 void WSSpectrum::openSocket()
@@ -81,12 +94,142 @@ void WSSpectrum::onNewConnection()
     connect(pSocket, &QWebSocket::textMessageReceived, this, &WSSpectrum::processClientMessage);
     connect(pSocket, &QWebSocket::disconnected, this, &WSSpectrum::socketDisconnected);
 
+    QMutexLocker mutexLocker(&m_mutex);
     m_clients << pSocket;
 }
 
 void WSSpectrum::processClientMessage(const QString &message)
 {
-     qDebug() << "WSSpectrum::processClientMessage: " << message;
+    qDebug() << "WSSpectrum::processClientMessage: " << message;
+    QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
+
+    if (!pClient) {
+        return;
+    }
+
+    // waterfall history window: {"history": {"from": 1600000000000, "to": 1600000060000, "lines": 512, "bins": 1024}}
+    WaterfallHistory::Request request;
+
+    if (m_waterfallHistory && request.deserialize(message))
+    {
+        sendWaterfallHistory(pClient, request);
+        return;
+    }
+
+    // stream negotiation: {"fps": 10, "bins": 1024, "encoding": "uint8delta", "compress": true, "view": "power"}
+    QMutexLocker mutexLocker(&m_mutex);
+    WSSpectrumStream *stream = m_clientStreams.value(pClient, nullptr);
+    WSSpectrumStream::Config config = stream ? stream->getConfig() : WSSpectrumStream::Config();
+
+    if (config.deserialize(message))
+    {
+        attachClientStream(pClient, config);
+        pClient->sendTextMessage(config.serialize());
+    }
+    else
+    {
+        qWarning() << "WSSpectrum::processClientMessage: invalid message from " << getWebSocketIdentifier(pClient);
+    }
+
+    mutexLocker.unlock();
+    updateSpectrumViews();
+}
+
+void WSSpectrum::sendWaterfallHistory(QWebSocket *client, const WaterfallHistory::Request& request)
+{
+    WaterfallHistory::Window window;
+    m_waterfallHistory->getWindow(request, window); // no lines if there is no history in the window
+
+    QByteArray values = qCompress(window.m_values.data(), (int) window.m_values.size());
+    qint32 nbLines = window.m_timestamps.size();
+    qint32 nbBins = window.m_nbBins;
+    QByteArray payload;
+    QBuffer buffer(&payload);
+    buffer.open(QIODevice::WriteOnly);
+    buffer.write("WFH1", 4);
+    buffer.write((char*) &nbLines, sizeof(qint32));
+    buffer.write((char*) &nbBins, sizeof(qint32));
+    buffer.write((char*) &window.m_startFrequency, sizeof(qint64));
+    buffer.write((char*) &window.m_endFrequency, sizeof(qint64));
+    buffer.write((char*) &window.m_offset, sizeof(float));
+    buffer.write((char*) &window.m_scale, sizeof(float));
+    buffer.write((char*) window.m_timestamps.data(), nbLines*sizeof(qint64));
+    buffer.write(values);
+    buffer.close();
+
+    client->sendBinaryMessage(payload);
+}
+
+void WSSpectrum::attachClientStream(QWebSocket *client, const WSSpectrumStream::Config& config)
+{
+    detachClientStream(client);
+    WSSpectrumStream *stream = nullptr;
+
+    for (WSSpectrumStream *s : qAsConst(m_streams))
+    {
+        if (s->getConfig() == config)
+        {
+            stream = s;
+            break;
+        }
+    }
+
+    if (!stream)
+    {
+        stream = new WSSpectrumStream(config);
+        m_streams.append(stream);
+
+        if (m_spectrumVis && config.isSpectrumView())
+        {
+            StreamView *view = new StreamView(this, stream);
+            m_streamViews.insert(stream, view);
+            m_addedViews.append(view);
+        }
+    }
+
+    stream->requestKeyFrame(); // the new client needs a reference for the differences
+    m_clientStreams.insert(client, stream);
+}
+
+void WSSpectrum::detachClientStream(QWebSocket *client)
+{
+    WSSpectrumStream *stream = m_clientStreams.take(client);
+
+    if (stream && !m_clientStreams.values().contains(stream))
+    {
+        StreamView *view = m_streamViews.take(stream);
+
+        if (view)
+        {
+            view->m_stream = nullptr;
+            m_addedViews.removeAll(view);
+            m_removedViews.append(view);
+        }
+
+        m_streams.removeAll(stream);
+        delete stream;
+    }
+}
+
+void WSSpectrum::updateSpectrumViews()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    QList<StreamView*> addedViews;
+    QList<StreamView*> removedViews;
+    addedViews.swap(m_addedViews);
+    removedViews.swap(m_removedViews);
+    mutexLocker.unlock();
+
+    // the spectrum calls its views with its own lock held then newStreamView() takes m_mutex
+    for (StreamView *view : qAsConst(addedViews)) {
+        m_spectrumVis->addSpectrumView(view, view->m_nbBins, SpectrumVis::ViewModePower);
+    }
+
+    for (StreamView *view : qAsConst(removedViews))
+    {
+        m_spectrumVis->removeSpectrumView(view); // not called anymore when it returns
+        delete view;
+    }
 }
 
 void WSSpectrum::socketDisconnected()
@@ -96,8 +239,12 @@ void WSSpectrum::socketDisconnected()
 
     if (pClient)
     {
+        QMutexLocker mutexLocker(&m_mutex);
         m_clients.removeAll(pClient);
-        pClient->deleteLater();
+        detachClientStream(pClient);
+        mutexLocker.unlock();
+        updateSpectrumViews();
+        pClient->deleteLater(); // newSpectrum() cannot see it anymore
     }
 }
 
@@ -111,12 +258,29 @@ void WSSpectrum::newSpectrum(
     bool linear
 )
 {
-    if (m_timer.elapsed() < 200) { // Max 5 frames per second
+    // called from the DSP thread while clients connect, negotiate and disconnect in the socket thread
+    QMutexLocker mutexLocker(&m_mutex);
+    m_refLevel = refLevel;
+    m_powerRange = powerRange;
+    m_centerFrequency = centerFrequency;
+    m_bandwidth = bandwidth;
+    m_linear = linear;
+
+    // negotiated streams: encoded once per stream for all its clients. Power views come with newStreamView().
+    for (WSSpectrumStream *stream : qAsConst(m_streams))
+    {
+        if (!stream->getConfig().isSpectrumView()
+         && stream->newSpectrum(spectrum, fftSize, refLevel, powerRange, centerFrequency, bandwidth, linear)) {
+            sendStream(stream);
+        }
+    }
+
+    // legacy format for the other clients
+    if ((m_clients.size() == m_clientStreams.size()) || (m_timer.elapsed() < 200)) { // Max 5 frames per second
         return;
     }
 
     qint64 elapsed = m_timer.restart();
-    QWebSocket *pSender = qobject_cast<QWebSocket *>(sender());
     QByteArray payload;
 
     buildPayload(
@@ -132,8 +296,32 @@ void WSSpectrum::newSpectrum(
     );
     //qDebug() << "WSSpectrum::newSpectrum: " << payload.size() << " bytes in " << elapsed << " ms";
 
-    for (QWebSocket *pClient : qAsConst(m_clients)) {
-        pClient->sendBinaryMessage(payload);
+    for (QWebSocket *pClient : qAsConst(m_clients))
+    {
+        if (!m_clientStreams.contains(pClient)) {
+            pClient->sendBinaryMessage(payload);
+        }
+    }
+}
+
+void WSSpectrum::newStreamView(StreamView *view, const std::vector<Real>& spectrum, int fftSize)
+{
+    // called from the DSP thread right after newSpectrum() for the same frame
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (view->m_stream
+     && view->m_stream->newSpectrum(spectrum, fftSize, m_refLevel, m_powerRange, m_centerFrequency, m_bandwidth, m_linear)) {
+        sendStream(view->m_stream);
+    }
+}
+
+void WSSpectrum::sendStream(WSSpectrumStream *stream)
+{
+    for (QHash<QWebSocket*, WSSpectrumStream*>::const_iterator it = m_clientStreams.begin(); it != m_clientStreams.end(); ++it)
+    {
+        if (it.value() == stream) {
+            it.key()->sendBinaryMessage(stream->getPayload());
+        }
     }
 }
 
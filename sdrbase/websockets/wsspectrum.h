@@ -22,15 +22,21 @@
 
 #include <QObject>
 #include <QList>
+#include <QHash>
 #include <QElapsedTimer>
+#include <QMutex>
 #include <QHostAddress>
 
 #include "dsp/dsptypes.h"
+#include "dsp/glspectruminterface.h"
+#include "websockets/wsspectrumstream.h"
+#include "dsp/waterfallhistory.h"
 
 #include "export.h"
 
 class QWebSocketServer;
 class QWebSocket;
+class SpectrumVis;
 
 class SDRBASE_API WSSpectrum : public QObject
 {
@@ -44,6 +50,8 @@ public:
     bool socketOpened();
     void setListeningAddress(const QString& address) { m_listeningAddress.setAddress(address); }
     void setPort(quint16 port) { m_port = port; }
+    void setWaterfallHistory(WaterfallHistory *waterfallHistory) { m_waterfallHistory = waterfallHistory; }
+    void setSpectrumVis(SpectrumVis *spectrumVis) { m_spectrumVis = spectrumVis; } //!< provides the power views of the streams
     void newSpectrum(
         const std::vector<Real>& spectrum,
         int fftSize,
@@ -60,13 +68,50 @@ private slots:
     void socketDisconnected();
 
 private:
+    class StreamView : public GLSpectrumInterface //!< spectrum view feeding a stream
+    {
+    public:
+        StreamView(WSSpectrum *wsSpectrum, WSSpectrumStream *stream) :
+            m_wsSpectrum(wsSpectrum),
+            m_stream(stream),
+            m_nbBins(stream->getConfig().m_nbBins)
+        {}
+        virtual void newSpectrum(const std::vector<Real>& spectrum, int fftSize) {
+            m_wsSpectrum->newStreamView(this, spectrum, fftSize);
+        }
+
+        WSSpectrum *m_wsSpectrum;
+        WSSpectrumStream *m_stream; //!< nullptr once the stream is deleted
+        unsigned int m_nbBins;
+    };
+
     QHostAddress m_listeningAddress;
     quint16 m_port;
     QWebSocketServer* m_webSocketServer;
     QList<QWebSocket*> m_clients;
-    QElapsedTimer m_timer;
+    QElapsedTimer m_timer;                                //!< legacy format clients frame rate
+    QHash<QWebSocket*, WSSpectrumStream*> m_clientStreams; //!< clients that negotiated a stream
+    QList<WSSpectrumStream*> m_streams;                   //!< one per distinct client configuration
+    QMutex m_mutex;                                       //!< clients and streams are used by the DSP thread in newSpectrum()
+    WaterfallHistory *m_waterfallHistory;
+    SpectrumVis *m_spectrumVis;
+    QHash<WSSpectrumStream*, StreamView*> m_streamViews; //!< views of the streams fed by the spectrum views
+    QList<StreamView*> m_addedViews;                      //!< to register to the spectrum out of m_mutex
+    QList<StreamView*> m_removedViews;                    //!< to unregister from the spectrum out of m_mutex then delete
+    // last published frame parameters for the stream views
+    float m_refLevel;
+    float m_powerRange;
+    uint64_t m_centerFrequency;
+    int m_bandwidth;
+    bool m_linear;
 
     static QString getWebSocketIdentifier(QWebSocket *peer);
+    void attachClientStream(QWebSocket *client, const WSSpectrumStream::Config& config); //!< call with m_mutex locked
+    void detachClientStream(QWebSocket *client); //!< call with m_mutex locked
+    void updateSpectrumViews(); //!< call with m_mutex unlocked
+    void newStreamView(StreamView *view, const std::vector<Real>& spectrum, int fftSize);
+    void sendStream(WSSpectrumStream *stream); //!< call with m_mutex locked
+    void sendWaterfallHistory(QWebSocket *client, const WaterfallHistory::Request& request);
     void buildPayload(
         QByteArray& bytes,
         const std::vector<Real>& spectrum,
@@ -0,0 +1,239 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "dsp/spectrumpower.h"
+
+#include "wsspectrumstream.h"
+
+bool WSSpectrumStream::Config::deserialize(const QString& message)
+{
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(message.toUtf8(), &error);
+
+    if (error.error != QJsonParseError::NoError || !doc.isObject()) {
+        return false;
+    }
+
+    QJsonObject jsonObject = doc.object();
+
+    if (jsonObject.contains("fps"))
+    {
+        int fps = jsonObject["fps"].toInt(5);
+        m_fps = fps < 1 ? 1 : fps > m_maxFps ? m_maxFps : fps;
+    }
+
+    if (jsonObject.contains("bins"))
+    {
+        int bins = jsonObject["bins"].toInt(0);
+        unsigned int nbBins = 0;
+
+        // round down to a power of two
+        if (bins > 0) {
+            for (nbBins = 1; 2*nbBins <= (unsigned int) bins; nbBins *= 2);
+        }
+
+        m_nbBins = nbBins;
+    }
+
+    if (jsonObject.contains("encoding"))
+    {
+        QString encoding = jsonObject["encoding"].toString();
+
+        if (encoding == "uint8") {
+            m_encoding = EncodingUInt8;
+        } else if (encoding == "uint8delta") {
+            m_encoding = EncodingUInt8Delta;
+        } else {
+            m_encoding = EncodingFloat;
+        }
+    }
+
+    if (jsonObject.contains("compress")) {
+        m_compress = jsonObject["compress"].toBool(false);
+    }
+
+    if (jsonObject.contains("view")) {
+        m_view = jsonObject["view"].toString() == "power" ? ViewPower : ViewPeak;
+    }
+
+    return true;
+}
+
+QString WSSpectrumStream::Config::serialize() const
+{
+    QJsonObject jsonObject;
+    jsonObject["fps"] = m_fps;
+    jsonObject["bins"] = (int) m_nbBins;
+    jsonObject["encoding"] = m_encoding == EncodingUInt8 ?
+        "uint8" :
+        m_encoding == EncodingUInt8Delta ?
+            "uint8delta" :
+            "float";
+    jsonObject["compress"] = m_compress;
+    jsonObject["view"] = m_view == ViewPower ? "power" : "peak";
+
+    return QString(QJsonDocument(jsonObject).toJson(QJsonDocument::Compact));
+}
+
+WSSpectrumStream::WSSpectrumStream(const Config& config) :
+    m_config(config),
+    m_keyFrame(true),
+    m_framesSinceKeyFrame(0)
+{
+    m_timer.start();
+}
+
+bool WSSpectrumStream::newSpectrum(
+    const std::vector<Real>& spectrum,
+    int fftSize,
+    float refLevel,
+    float powerRange,
+    uint64_t centerFrequency,
+    int bandwidth,
+    bool linear
+)
+{
+    if (m_timer.elapsed() < 1000 / m_config.m_fps) {
+        return false;
+    }
+
+    qint64 elapsed = m_timer.restart();
+
+    // peak preserving decimation
+
+    unsigned int nbBins = (m_config.m_nbBins == 0) || (m_config.m_nbBins > (unsigned int) fftSize) ?
+        fftSize :
+        m_config.m_nbBins;
+    const Real *values = spectrum.data();
+
+    if (nbBins < (unsigned int) fftSize)
+    {
+        m_bins.resize(nbBins);
+        SpectrumPower::decimateMax(spectrum.data(), m_bins.data(), nbBins, fftSize / nbBins);
+        values = m_bins.data();
+    }
+
+    // values: value = offset + q * scale with q in [0, 255]
+
+    const char *data;
+    unsigned int dataSize;
+    float offset = 0.0f;
+    float scale = 1.0f;
+    quint8 flags = 0;
+
+    if (m_config.m_encoding == EncodingFloat)
+    {
+        data = (const char*) values;
+        dataSize = nbBins * sizeof(Real);
+    }
+    else
+    {
+        if (linear)
+        {
+            Real max = SpectrumPower::max(values, nbBins);
+            scale = max > 0.0f ? max / 255.0f : 1.0f;
+        }
+        else
+        {
+            offset = refLevel - powerRange;
+            scale = powerRange > 0.0f ? powerRange / 255.0f : 1.0f;
+        }
+
+        m_quantized.resize(nbBins);
+        Real invScale = 1.0f / scale;
+
+        for (unsigned int i = 0; i < nbBins; i++)
+        {
+            Real q = (values[i] - offset) * invScale + 0.5f;
+            q = q < 0.0f ? 0.0f : q > 255.0f ? 255.0f : q;
+            m_quantized[i] = (quint8) q;
+        }
+
+        if (m_config.m_encoding == EncodingUInt8Delta)
+        {
+            if (m_previous.size() != nbBins) {
+                m_keyFrame = true;
+            }
+
+            if (m_keyFrame || (m_framesSinceKeyFrame >= m_keyFrameInterval))
+            {
+                m_previous = m_quantized;
+                m_keyFrame = false;
+                m_framesSinceKeyFrame = 0;
+                flags |= 2;
+            }
+            else
+            {
+                for (unsigned int i = 0; i < nbBins; i++)
+                {
+                    quint8 q = m_quantized[i];
+                    m_quantized[i] = q - m_previous[i];
+                    m_previous[i] = q;
+                }
+
+                m_framesSinceKeyFrame++;
+            }
+        }
+
+        data = (const char*) m_quantized.data();
+        dataSize = nbBins;
+    }
+
+    if (m_config.m_encoding != EncodingUInt8Delta) {
+        flags |= 2; // every frame is a key frame
+    }
+
+    QByteArray compressed;
+
+    if (m_config.m_compress)
+    {
+        compressed = qCompress((const uchar*) data, dataSize, 1);
+        data = compressed.constData();
+        dataSize = compressed.size();
+        flags |= 1;
+    }
+
+    // header then values
+
+    m_payload.resize(m_headerSize + dataSize);
+    char *p = m_payload.data();
+    quint8 encoding = (quint8) m_config.m_encoding;
+    qint32 nbBinsInt = nbBins;
+    qint32 indicators = linear ? 1 : 0;
+    memcpy(p, "SPC2", 4);
+    memcpy(p + 4, &encoding, 1);
+    memcpy(p + 5, &flags, 1);
+    memset(p + 6, 0, 2);
+    memcpy(p + 8, &nbBinsInt, 4);
+    memcpy(p + 12, &elapsed, 8);
+    memcpy(p + 20, &refLevel, 4);
+    memcpy(p + 24, &powerRange, 4);
+    memcpy(p + 28, &centerFrequency, 8);
+    memcpy(p + 36, &bandwidth, 4);
+    memcpy(p + 40, &indicators, 4);
+    memcpy(p + 44, &offset, 4);
+    memcpy(p + 48, &scale, 4);
+    memcpy(p + m_headerSize, data, dataSize);
+
+    return true;
+}
@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Spectrum stream of the websocket spectrum server for one client configuration //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_WEBSOCKETS_WSSPECTRUMSTREAM_H_
+#define SDRBASE_WEBSOCKETS_WSSPECTRUMSTREAM_H_
+
+#include <vector>
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QString>
+
+#include "dsp/dsptypes.h"
+
+#include "export.h"
+
+/**
+ * Clients negotiating the same configuration share the same stream so that the payload of a frame
+ * is encoded once for all of them. Frames are sent at the negotiated rate and decimated to the
+ * negotiated number of bins keeping the peaks or as a power sum view computed by the spectrum. Power
+ * values can be quantized on 8 bits and sent as differences with the previous frame of the stream
+ * which makes them very compressible.
+ */
+class SDRBASE_API WSSpectrumStream
+{
+public:
+    enum Encoding
+    {
+        EncodingFloat,     //!< 32 bit float values
+        EncodingUInt8,     //!< 8 bit quantized values
+        EncodingUInt8Delta //!< 8 bit quantized values difference with previous frame (modulo 256) except in key frames
+    };
+
+    enum View
+    {
+        ViewPeak,  //!< decimated keeping the peaks of the published frame
+        ViewPower  //!< power sum view of the FFT bins like a smaller FFT (from the spectrum views)
+    };
+
+    struct Config
+    {
+        int m_fps;              //!< frames per second
+        unsigned int m_nbBins;  //!< number of bins (power of two) 0 for FFT size
+        Encoding m_encoding;
+        bool m_compress;        //!< zlib compression of the values
+        View m_view;
+
+        Config() :
+            m_fps(5),
+            m_nbBins(0),
+            m_encoding(EncodingFloat),
+            m_compress(false),
+            m_view(ViewPeak)
+        {}
+
+        bool operator==(const Config& other) const {
+            return (m_fps == other.m_fps) && (m_nbBins == other.m_nbBins)
+                && (m_encoding == other.m_encoding) && (m_compress == other.m_compress)
+                && (m_view == other.m_view);
+        }
+        bool isSpectrumView() const { return (m_view == ViewPower) && (m_nbBins != 0); } //!< fed by a spectrum view instead of the published frame
+
+        bool deserialize(const QString& message); //!< from client JSON message. Values are capped.
+        QString serialize() const;                //!< JSON message sent back to the client
+    };
+
+    WSSpectrumStream(const Config& config);
+
+    const Config& getConfig() const { return m_config; }
+    void requestKeyFrame() { m_keyFrame = true; }
+    /** Encodes the frame if the stream is due. Returns true if the payload is to be sent. */
+    bool newSpectrum(
+        const std::vector<Real>& spectrum,
+        int fftSize,
+        float refLevel,
+        float powerRange,
+        uint64_t centerFrequency,
+        int bandwidth,
+        bool linear
+    );
+    const QByteArray& getPayload() const { return m_payload; }
+
+    static const int m_maxFps = 50;
+    static const unsigned int m_keyFrameInterval = 50; //!< frames between delta encoding key frames
+    static const unsigned int m_headerSize = 52;
+
+private:
+    Config m_config;
+    QElapsedTimer m_timer;
+    std::vector<Real> m_bins;
+    std::vector<quint8> m_quantized;
+    std::vector<quint8> m_previous;  //!< quantized values of previous frame for delta encoding
+    QByteArray m_payload;
+    bool m_keyFrame;
+    unsigned int m_framesSinceKeyFrame;
+};
+
+#endif // SDRBASE_WEBSOCKETS_WSSPECTRUMSTREAM_H_
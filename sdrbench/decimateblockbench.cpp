@@ -0,0 +1,34 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Block mode against sample by sample decimators                              //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "dsp/decimatorsu.h"
+
+#include "decimateblockbench.h"
+
+bool DecimateBlockBench::isUAccelerated()
+{
+    return DecimatorsU<qint32, quint8, SDR_RX_SAMP_SZ, 8, 127, true>::isBlockModeAccelerated();
+}
+
+void DecimateBlockBench::compareU(const quint8 *buf, int len, unsigned int repetition, std::vector<Result>& results)
+{
+    compare<DecimatorsU<qint32, quint8, SDR_RX_SAMP_SZ, 8, 127, true>>("U8 IQ", buf, len, repetition, results);
+    compare<DecimatorsU<qint32, quint8, SDR_RX_SAMP_SZ, 8, 127, false>>("U8 QI", buf, len, repetition, results);
+}
@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Block mode against sample by sample decimators                              //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBENCH_DECIMATEBLOCKBENCH_H_
+#define SDRBENCH_DECIMATEBLOCKBENCH_H_
+
+#include <QString>
+#include <QElapsedTimer>
+#include <vector>
+#include <algorithm>
+
+#include "dsp/dsptypes.h"
+
+/**
+ * Runs all decimations of a decimators class in sample by sample and block modes on the same input.
+ * Decimators and DecimatorsU cannot be included in the same translation unit so the unsigned
+ * decimators are compared in their own unit with compareU().
+ */
+class DecimateBlockBench
+{
+public:
+    struct Result
+    {
+        QString m_name;        //!< class, decimation and position
+        qint64 m_nsecs[2];     //!< sample by sample then block mode
+        bool m_identical;      //!< block mode gives the same samples
+    };
+
+    template<typename DecimatorsType, typename T>
+    static void compare(const QString& name, const T *buf, int len, unsigned int repetition, std::vector<Result>& results);
+    static bool isUAccelerated(); //!< SIMD block filters of the unsigned decimators
+    static void compareU(const quint8 *buf, int len, unsigned int repetition, std::vector<Result>& results); //!< I/Q and Q/I unsigned 8 bit decimators
+};
+
+template<typename DecimatorsType, typename T>
+void DecimateBlockBench::compare(const QString& name, const T *buf, int len, unsigned int repetition, std::vector<Result>& results)
+{
+    typedef void (DecimatorsType::*Decimate)(SampleVector::iterator*, const T*, qint32);
+    static const char *positionNames[3] = {"inf", "sup", "cen"};
+    static const Decimate functions[3][6] = {
+        {
+            &DecimatorsType::decimate2_inf, &DecimatorsType::decimate4_inf, &DecimatorsType::decimate8_inf,
+            &DecimatorsType::decimate16_inf, &DecimatorsType::decimate32_inf, &DecimatorsType::decimate64_inf
+        },
+        {
+            &DecimatorsType::decimate2_sup, &DecimatorsType::decimate4_sup, &DecimatorsType::decimate8_sup,
+            &DecimatorsType::decimate16_sup, &DecimatorsType::decimate32_sup, &DecimatorsType::decimate64_sup
+        },
+        {
+            &DecimatorsType::decimate2_cen, &DecimatorsType::decimate4_cen, &DecimatorsType::decimate8_cen,
+            &DecimatorsType::decimate16_cen, &DecimatorsType::decimate32_cen, &DecimatorsType::decimate64_cen
+        }
+    };
+    QElapsedTimer timer;
+    SampleVector outputs[2]; // sample by sample then block mode
+    outputs[0].resize(len/4);
+    outputs[1].resize(len/4);
+
+    // all decimation factors for the infradyne, supradyne (stages rotate the spectrum) and center positions
+    for (unsigned int log2Decim = 1; log2Decim <= 6; log2Decim++)
+    {
+        for (int position = 0; position < 3; position++)
+        {
+            Decimate decimate = functions[position][log2Decim - 1];
+            DecimatorsType decimators[2];
+            Result result;
+            result.m_name = QString("%1 decimation %2 %3").arg(name).arg(1<<log2Decim).arg(positionNames[position]);
+            result.m_nsecs[0] = 0;
+            result.m_nsecs[1] = 0;
+            result.m_identical = true;
+            decimators[0].setBlockMode(false);
+            decimators[1].setBlockMode(true);
+
+            for (unsigned int i = 0; i < repetition; i++)
+            {
+                for (int mode = 0; mode < 2; mode++)
+                {
+                    SampleVector::iterator it = outputs[mode].begin();
+                    timer.start();
+                    (decimators[mode].*decimate)(&it, buf, len);
+                    result.m_nsecs[mode] += timer.nsecsElapsed();
+                }
+
+                result.m_identical = result.m_identical && std::equal(outputs[0].begin(), outputs[0].end(), outputs[1].begin(),
+                    [](const Sample& a, const Sample& b) { return (a.real() == b.real()) && (a.imag() == b.imag()); });
+            }
+
+            results.push_back(result);
+        }
+    }
+}
+
+#endif // SDRBENCH_DECIMATEBLOCKBENCH_H_
@@ -19,9 +19,43 @@
 
 #include <QDebug>
 #include <QElapsedTimer>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QDateTime>
+#include <QSysInfo>
+
+#include <thread>
+#include <cmath>
+#include <complex>
 
 #include "ambe/ambeengine.h"
+#include "dsp/samplesinkfifo.h"
+#include "dsp/downchannelizer.h"
+#include "dsp/pfbchannelizer.h"
+#include "dsp/interpolator.h"
+#include "dsp/upchannelizer.h"
+#include "dsp/channelsamplesource.h"
+#include "dsp/fftfilt.h"
+#include "dsp/kissengine.h"
+#ifdef USE_FFTW
+#include "dsp/fftwengine.h"
+#endif
+#include "dsp/nco.h"
+#include "dsp/ncof.h"
+#include "dsp/agc.h"
+#include "dsp/phasediscri.h"
+#include "dsp/samplesimplefifo.h"
+#include "dsp/samplesourcefifo.h"
+#include "dsp/iqcodec.h"
+#include "dsp/spectrumpower.h"
+#include "dsp/spectrumhistogram.h"
+#include "dsp/projector.h"
+#include "dsp/scopetriggercomparator.h"
+#include "audio/audiofifo.h"
+#include "util/cpufeatures.h"
 
+#include "decimateblockbench.h"
 #include "mainbench.h"
 
 MainBench *MainBench::m_instance = 0;
@@ -48,27 +82,85 @@ void MainBench::run()
         << " testType: " << (int) m_parser.getTestType()
         << " nsamples: " << m_parser.getNbSamples()
         << " repet: " << m_parser.getRepetition()
-        << " log2f: " << m_parser.getLog2Factor();
+        << " log2f: " << m_parser.getLog2Factor()
+        << " json: " << m_parser.getJsonFileName();
+    qDebug() << "MainBench::run: SIMD kernels:" << CPUFeatures::getLevelName(CPUFeatures::getLevel())
+        << " detected: " << CPUFeatures::getLevelName(CPUFeatures::getDetectedLevel());
+
+    if (m_parser.getTestType() == ParserBench::TestAll)
+    {
+        for (int testType = 0; testType < (int) ParserBench::TestAll; testType++)
+        {
+            if (testType != ParserBench::TestAMBE) { // needs hardware
+                runTest((ParserBench::TestType) testType);
+            }
+        }
+    }
+    else
+    {
+        runTest(m_parser.getTestType());
+    }
 
-    if (m_parser.getTestType() == ParserBench::TestDecimatorsII) {
+    if (!m_parser.getJsonFileName().isEmpty()) {
+        writeJsonResults();
+    }
+
+    emit finished();
+}
+
+void MainBench::runTest(ParserBench::TestType testType)
+{
+    m_testStr = ParserBench::getTestStr(testType);
+
+    if (testType == ParserBench::TestDecimatorsII) {
         testDecimateII();
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsInfII) {
+    } else if (testType == ParserBench::TestDecimatorsInfII) {
         testDecimateII(ParserBench::TestDecimatorsInfII);
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsSupII) {
+    } else if (testType == ParserBench::TestDecimatorsSupII) {
         testDecimateII(ParserBench::TestDecimatorsSupII);
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsIF) {
+    } else if (testType == ParserBench::TestDecimatorsIF) {
         testDecimateIF();
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsFI) {
+    } else if (testType == ParserBench::TestDecimatorsFI) {
         testDecimateFI();
-    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsFF) {
+    } else if (testType == ParserBench::TestDecimatorsFF) {
         testDecimateFF();
-    } else if (m_parser.getTestType() == ParserBench::TestAMBE) {
+    } else if (testType == ParserBench::TestAMBE) {
         testAMBE();
+    } else if (testType == ParserBench::TestSampleSinkFifo) {
+        testSampleSinkFifo();
+    } else if (testType == ParserBench::TestChannelizer) {
+        testChannelizer();
+    } else if (testType == ParserBench::TestPFBChannelizer) {
+        testPFBChannelizer();
+    } else if (testType == ParserBench::TestInterpolator) {
+        testInterpolator();
+    } else if (testType == ParserBench::TestUpChannelizer) {
+        testUpChannelizer();
+    } else if (testType == ParserBench::TestFFTFilter) {
+        testFFTFilter();
+    } else if (testType == ParserBench::TestFFTEngine) {
+        testFFTEngine();
+    } else if (testType == ParserBench::TestNCO) {
+        testNCO();
+    } else if (testType == ParserBench::TestAGC) {
+        testAGC();
+    } else if (testType == ParserBench::TestDiscriminators) {
+        testDiscriminators();
+    } else if (testType == ParserBench::TestFifos) {
+        testFifos();
+    } else if (testType == ParserBench::TestIQCodec) {
+        testIQCodec();
+    } else if (testType == ParserBench::TestDecimatorsBlockII) {
+        testDecimateBlockII();
+    } else if (testType == ParserBench::TestSpectrumPower) {
+        testSpectrumPower();
+    } else if (testType == ParserBench::TestSpectrumHistogram) {
+        testSpectrumHistogram();
+    } else if (testType == ParserBench::TestScopeTrigger) {
+        testScopeTrigger();
     } else {
-        qDebug() << "MainBench::run: unknown test type: " << m_parser.getTestType();
+        qDebug() << "MainBench::runTest: unknown test type: " << testType;
     }
-
-    emit finished();
 }
 
 void MainBench::testDecimateII(ParserBench::TestType testType)
@@ -207,6 +299,1122 @@ void MainBench::testAMBE()
     }
 }
 
+void MainBench::testSampleSinkFifo()
+{
+    qDebug() << "MainBench::testSampleSinkFifo: create test data";
+
+    SampleVector block(4096); // typical device engine block
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (auto& sample : block) {
+        sample.setReal(my_rand());
+        sample.setImag(my_rand());
+    }
+
+    qDebug() << "MainBench::testSampleSinkFifo: run test";
+
+    qint64 nsecs = transferSampleSinkFifo(false, block);
+    printResults("MainBench::testSampleSinkFifo: mutex", nsecs);
+    nsecs = transferSampleSinkFifo(true, block);
+    printResults("MainBench::testSampleSinkFifo: lock free", nsecs);
+}
+
+class ChannelizerNullSink : public ChannelSampleSink
+{
+public:
+    virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+    {
+        (void) begin;
+        (void) end;
+    }
+};
+
+/** Trigger condition with the members of ScopeVis::TriggerCondition used by ScopeTriggerComparator */
+struct BenchTriggerCondition
+{
+    struct TriggerData
+    {
+        Real m_triggerLevel;
+        uint32_t m_triggerHoldoff;
+        bool m_triggerBothEdges;
+        bool m_triggerPositiveEdge;
+    };
+
+    Projector m_projector;
+    TriggerData m_triggerData;
+    bool m_prevCondition;
+    uint32_t m_trues;
+    uint32_t m_falses;
+
+    BenchTriggerCondition(Projector::ProjectionType projectionType, Real level, uint32_t holdoff, bool bothEdges, bool positiveEdge) :
+        m_projector(projectionType),
+        m_triggerData{level, holdoff, bothEdges, positiveEdge},
+        m_prevCondition(false),
+        m_trues(0),
+        m_falses(0)
+    {}
+};
+
+class ChannelizerCaptureSink : public ChannelSampleSink
+{
+public:
+    virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+    {
+        m_samples.insert(m_samples.end(), begin, end);
+    }
+
+    /** Power in dB relative to full scale and frequency in cycles per sample of a tone skipping the filters transient */
+    void measureTone(unsigned int skip, double& powerDB, double& frequency) const
+    {
+        double power = 0.0;
+        double phase = 0.0;
+        unsigned int nbSamples = 0;
+
+        for (unsigned int i = skip + 1; i < m_samples.size(); i++, nbSamples++)
+        {
+            std::complex<double> c(m_samples[i].m_real / SDR_RX_SCALED, m_samples[i].m_imag / SDR_RX_SCALED);
+            std::complex<double> p(m_samples[i-1].m_real / SDR_RX_SCALED, m_samples[i-1].m_imag / SDR_RX_SCALED);
+            power += std::norm(c);
+            phase += std::arg(c * std::conj(p));
+        }
+
+        powerDB = nbSamples == 0 ? -200.0 : 10.0 * log10(power / nbSamples + 1e-20);
+        frequency = nbSamples == 0 ? 0.0 : phase / (2.0 * M_PI * nbSamples);
+    }
+
+    SampleVector m_samples;
+};
+
+void MainBench::testChannelizer()
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+
+    qDebug() << "MainBench::testChannelizer: create test data";
+
+    SampleVector buf(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (auto& sample : buf) {
+        sample.setReal(my_rand());
+        sample.setImag(my_rand());
+    }
+
+    // decimation by 2^log2 factor with all lower half stages so that every stage rotates the spectrum
+    ChannelizerNullSink sink;
+    DownChannelizer channelizer(&sink);
+    channelizer.setBasebandSampleRate(1000000, true);
+    channelizer.setDecimation(m_parser.getLog2Factor(), 0);
+
+    qDebug() << "MainBench::testChannelizer: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+        channelizer.feed(buf.begin(), buf.end());
+        nsecs += timer.nsecsElapsed();
+    }
+
+    printResults(QString("MainBench::testChannelizer: decimation %1").arg(1<<m_parser.getLog2Factor()), nsecs);
+}
+
+void MainBench::testPFBChannelizer()
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+    unsigned int nbChannels = 1<<std::max(1U, m_parser.getLog2Factor());
+
+    qDebug() << "MainBench::testPFBChannelizer: create test data";
+
+    SampleVector buf(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (auto& sample : buf) {
+        sample.setReal(my_rand());
+        sample.setImag(my_rand());
+    }
+
+    // 2^log2 factor channels all in use
+    std::vector<ChannelizerNullSink> sinks(nbChannels);
+    PFBChannelizer channelizer;
+    channelizer.configure(nbChannels, 8, 1000000);
+
+    for (unsigned int bin = 0; bin < nbChannels; bin++) {
+        channelizer.attach(bin, &sinks[bin]);
+    }
+
+    qDebug() << "MainBench::testPFBChannelizer: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+        channelizer.feed(buf.begin(), buf.end());
+        nsecs += timer.nsecsElapsed();
+    }
+
+    printResults(QString("MainBench::testPFBChannelizer: %1 channels").arg(nbChannels), nsecs);
+
+    // channel 0 output against DownChannelizer with all center stages for a tone in the pass band
+    // and a tone in the farthest channel. Both have unity gain in the pass band.
+    unsigned int log2Channels = std::max(1U, m_parser.getLog2Factor());
+    unsigned int centerHash = 0;
+
+    for (unsigned int i = 0, p = 1; i < log2Channels; i++, p *= 3) {
+        centerHash += p; // base 3 digit 1 (center) for every stage
+    }
+
+    const double toneFrequencies[] = {0.1 / nbChannels, 0.5}; // cycles per baseband sample
+    const double amplitude = 0.5 * SDR_RX_SCALED;
+    SampleVector tone(std::max(m_parser.getNbSamples(), 1024 * nbChannels));
+    unsigned int nbMismatches = 0;
+
+    for (unsigned int t = 0; t < sizeof(toneFrequencies)/sizeof(toneFrequencies[0]); t++)
+    {
+        for (unsigned int n = 0; n < tone.size(); n++)
+        {
+            double phi = 2.0 * M_PI * toneFrequencies[t] * n;
+            tone[n] = Sample((FixReal) (amplitude * cos(phi)), (FixReal) (amplitude * sin(phi)));
+        }
+
+        ChannelizerCaptureSink refSink;
+        DownChannelizer refChannelizer(&refSink);
+        refChannelizer.setBasebandSampleRate(1000000, true);
+        refChannelizer.setDecimation(log2Channels, centerHash);
+        refChannelizer.feed(tone.begin(), tone.end());
+
+        ChannelizerCaptureSink pfbSink;
+        PFBChannelizer pfbChannelizer;
+        pfbChannelizer.configure(nbChannels, 8, 1000000);
+        pfbChannelizer.attach(0, &pfbSink);
+        pfbChannelizer.feed(tone.begin(), tone.end());
+
+        double refPower, refFrequency, pfbPower, pfbFrequency;
+        refSink.measureTone(64, refPower, refFrequency);
+        pfbSink.measureTone(64, pfbPower, pfbFrequency);
+        bool passBand = t == 0;
+
+        qDebug("MainBench::testPFBChannelizer: tone %.4f: DownChannelizer: %u samples %.2f dB %.5f PFB: %u samples %.2f dB %.5f",
+            toneFrequencies[t],
+            (unsigned int) refSink.m_samples.size(), refPower, refFrequency,
+            (unsigned int) pfbSink.m_samples.size(), pfbPower, pfbFrequency);
+
+        if (pfbSink.m_samples.size() != refSink.m_samples.size())
+        {
+            qWarning("MainBench::testPFBChannelizer: mismatch: %u PFB samples for %u DownChannelizer samples",
+                (unsigned int) pfbSink.m_samples.size(), (unsigned int) refSink.m_samples.size());
+            nbMismatches++;
+        }
+
+        if (passBand && ((std::fabs(pfbPower - refPower) > 1.0) || (std::fabs(pfbFrequency - refFrequency) > 1e-3)))
+        {
+            qWarning("MainBench::testPFBChannelizer: mismatch: pass band tone differs by %.2f dB and %.5f cycles per sample",
+                pfbPower - refPower, pfbFrequency - refFrequency);
+            nbMismatches++;
+        }
+        else if (!passBand && (pfbPower > -60.0))
+        {
+            qWarning("MainBench::testPFBChannelizer: mismatch: stop band tone rejected to %.2f dB only", pfbPower);
+            nbMismatches++;
+        }
+    }
+
+    qDebug() << "MainBench::testPFBChannelizer: output check mismatches:" << nbMismatches;
+}
+
+void MainBench::testInterpolator()
+{
+    qDebug() << "MainBench::testInterpolator: create test data";
+
+    ComplexVector buf(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+
+    for (auto& c : buf) {
+        c = Complex(my_rand(), my_rand());
+    }
+
+    // channel rate to 48 kHz audio (decimation) and low rate channels up to 48 kHz (interpolation)
+    static const int inputRates[] = {96000, 75000, 62500, 50000, 24000, 8000};
+    static const int outputRate = 48000;
+
+    qDebug() << "MainBench::testInterpolator: run test";
+
+    for (unsigned int i = 0; i < sizeof(inputRates)/sizeof(inputRates[0]); i++)
+    {
+        qint64 nsecs = resampleInterpolator(false, inputRates[i], outputRate, buf);
+        printResults(QString("MainBench::testInterpolator: %1 to %2 sample").arg(inputRates[i]).arg(outputRate), nsecs);
+        nsecs = resampleInterpolator(true, inputRates[i], outputRate, buf);
+        printResults(QString("MainBench::testInterpolator: %1 to %2 buffer").arg(inputRates[i]).arg(outputRate), nsecs);
+    }
+}
+
+qint64 MainBench::resampleInterpolator(bool buffer, int inputRate, int outputRate, const ComplexVector& in)
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+    Interpolator interpolator;
+    interpolator.create(16, std::max(inputRate, outputRate), std::min(inputRate, outputRate) / 2.2f);
+    Real distance = (Real) inputRate / (Real) outputRate;
+    Real distanceRemain = 0;
+    ComplexVector out;
+    out.reserve(in.size() * (outputRate / inputRate + 2));
+    Complex ci;
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        out.clear();
+        timer.start();
+
+        if (buffer)
+        {
+            if (distance < 1.0f) {
+                interpolator.interpolate(&distanceRemain, distance, in.data(), in.size(), out);
+            } else {
+                interpolator.decimate(&distanceRemain, distance, in.data(), in.size(), out);
+            }
+        }
+        else
+        {
+            for (ComplexVector::const_iterator it = in.begin(); it != in.end(); ++it)
+            {
+                if (distance < 1.0f)
+                {
+                    while (!interpolator.interpolate(&distanceRemain, *it, &ci))
+                    {
+                        out.push_back(ci);
+                        distanceRemain += distance;
+                    }
+                }
+                else if (interpolator.decimate(&distanceRemain, *it, &ci))
+                {
+                    out.push_back(ci);
+                    distanceRemain += distance;
+                }
+            }
+        }
+
+        nsecs += timer.nsecsElapsed();
+    }
+
+    return nsecs;
+}
+
+class UpChannelizerSource : public ChannelSampleSource
+{
+public:
+    UpChannelizerSource(const SampleVector& samples) :
+        m_samples(samples),
+        m_index(0)
+    {}
+
+    virtual void pull(SampleVector::iterator begin, unsigned int nbSamples)
+    {
+        for (unsigned int i = 0; i < nbSamples; i++) {
+            pullOne(*begin++);
+        }
+    }
+
+    virtual void pullOne(Sample& sample)
+    {
+        sample = m_samples[m_index];
+        m_index = m_index + 1 < m_samples.size() ? m_index + 1 : 0;
+    }
+
+    virtual void prefetch(unsigned int nbSamples) { (void) nbSamples; }
+
+private:
+    const SampleVector& m_samples;
+    unsigned int m_index;
+};
+
+void MainBench::testUpChannelizer()
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+
+    qDebug() << "MainBench::testUpChannelizer: create test data";
+
+    SampleVector channelBuf(4096);
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (auto& sample : channelBuf) {
+        sample.setReal(my_rand());
+        sample.setImag(my_rand());
+    }
+
+    // interpolation by 2^log2 factor with center stages
+    UpChannelizerSource source(channelBuf);
+    UpChannelizer channelizer(&source);
+    channelizer.setBasebandSampleRate(1000000, true);
+    channelizer.setInterpolation(m_parser.getLog2Factor(), 0);
+    SampleVector buf(m_parser.getNbSamples());
+
+    qDebug() << "MainBench::testUpChannelizer: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+        channelizer.pull(buf.begin(), buf.size());
+        nsecs += timer.nsecsElapsed();
+    }
+
+    printResults(QString("MainBench::testUpChannelizer: interpolation %1").arg(1<<m_parser.getLog2Factor()), nsecs);
+}
+
+void MainBench::testFFTFilter()
+{
+    QElapsedTimer timer;
+    qint64 nsecsFilt = 0;
+    qint64 nsecsSSB = 0;
+
+    qDebug() << "MainBench::testFFTFilter: create test data";
+
+    std::vector<fftfilt::cmplx> buf(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+
+    for (auto& c : buf) {
+        c = fftfilt::cmplx(my_rand(), my_rand());
+    }
+
+    // SSB demodulator settings at 48 kHz: 300 Hz to 3 kHz with 1024 points FFT
+    fftfilt bandFilter(300.0f / 48000.0f, 3000.0f / 48000.0f, 1024);
+    fftfilt ssbFilter(300.0f / 48000.0f, 3000.0f / 48000.0f, 1024);
+    fftfilt::cmplx *out;
+    int count = 0;
+
+    qDebug() << "MainBench::testFFTFilter: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+
+        for (const auto& c : buf) {
+            count += bandFilter.runFilt(c, &out);
+        }
+
+        nsecsFilt += timer.nsecsElapsed();
+        timer.start();
+
+        for (const auto& c : buf) {
+            count += ssbFilter.runSSB(c, &out, true);
+        }
+
+        nsecsSSB += timer.nsecsElapsed();
+    }
+
+    qDebug() << "MainBench::testFFTFilter: output samples: " << count;
+    printResults("MainBench::testFFTFilter: runFilt 1024", nsecsFilt);
+    printResults("MainBench::testFFTFilter: runSSB 1024", nsecsSSB);
+}
+
+void MainBench::testFFTEngine()
+{
+    static const int fftSizes[] = {256, 1024, 4096, 16384};
+
+    qDebug() << "MainBench::testFFTEngine: run test";
+
+    for (unsigned int i = 0; i < sizeof(fftSizes)/sizeof(fftSizes[0]); i++)
+    {
+        quint64 nbSamples;
+        KissEngine kissEngine;
+        qint64 nsecs = transformFFTEngine(&kissEngine, fftSizes[i], nbSamples);
+        printResults(QString("MainBench::testFFTEngine: kiss %1").arg(fftSizes[i]), nsecs, nbSamples);
+#ifdef USE_FFTW
+        FFTWEngine fftwEngine("");
+        nsecs = transformFFTEngine(&fftwEngine, fftSizes[i], nbSamples);
+        printResults(QString("MainBench::testFFTEngine: fftw %1").arg(fftSizes[i]), nsecs, nbSamples);
+#endif
+    }
+}
+
+qint64 MainBench::transformFFTEngine(FFTEngine *engine, int fftSize, quint64& nbSamples)
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+    uint32_t nbTransforms = std::max(1U, m_parser.getNbSamples() / fftSize);
+
+    engine->configure(fftSize, false);
+
+    for (int i = 0; i < fftSize; i++) {
+        engine->in()[i] = Complex(my_rand(), my_rand());
+    }
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+
+        for (uint32_t j = 0; j < nbTransforms; j++) {
+            engine->transform();
+        }
+
+        nsecs += timer.nsecsElapsed();
+    }
+
+    nbSamples = (quint64) nbTransforms * fftSize * m_parser.getRepetition();
+    return nsecs;
+}
+
+void MainBench::testNCO()
+{
+    QElapsedTimer timer;
+    qint64 nsecsNCO = 0;
+    qint64 nsecsNCOF = 0;
+
+    qDebug() << "MainBench::testNCO: create test data";
+
+    ComplexVector buf(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+
+    for (auto& c : buf) {
+        c = Complex(my_rand(), my_rand());
+    }
+
+    // mix as in the channel sinks
+    NCO nco;
+    nco.setFreq(12345.0f, 1000000.0f);
+    NCOF ncof;
+    ncof.setFreq(12345.0f, 1000000.0f);
+
+    qDebug() << "MainBench::testNCO: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+
+        for (auto& c : buf) {
+            c *= nco.nextIQ();
+        }
+
+        nsecsNCO += timer.nsecsElapsed();
+        timer.start();
+
+        for (auto& c : buf) {
+            c *= ncof.nextIQ();
+        }
+
+        nsecsNCOF += timer.nsecsElapsed();
+    }
+
+    printResults("MainBench::testNCO: NCO", nsecsNCO);
+    printResults("MainBench::testNCO: NCOF", nsecsNCOF);
+}
+
+void MainBench::testAGC()
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+
+    qDebug() << "MainBench::testAGC: create test data";
+
+    ComplexVector buf(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+
+    for (auto& c : buf) {
+        c = Complex(my_rand() * SDR_RX_SCALEF, my_rand() * SDR_RX_SCALEF);
+    }
+
+    // SSB demodulator settings
+    MagAGC agc(12000, 3276, 1e-2);
+    agc.setClampMax(SDR_RX_SCALED/100.0);
+    double sum = 0.0;
+
+    qDebug() << "MainBench::testAGC: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+
+        for (const auto& c : buf) {
+            sum += agc.feedAndGetValue(c);
+        }
+
+        nsecs += timer.nsecsElapsed();
+    }
+
+    qDebug() << "MainBench::testAGC: sum: " << sum;
+    printResults("MainBench::testAGC: MagAGC", nsecs);
+}
+
+void MainBench::testDiscriminators()
+{
+    QElapsedTimer timer;
+    qint64 nsecs[3] = {0, 0, 0};
+
+    qDebug() << "MainBench::testDiscriminators: create test data";
+
+    ComplexVector buf(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+
+    for (auto& c : buf) {
+        c = Complex(my_rand(), my_rand());
+    }
+
+    PhaseDiscriminators phaseDiscri;
+    phaseDiscri.setFMScaling(1.0f);
+    Real sum = 0.0f;
+    double magsq;
+    Real fmDev;
+
+    qDebug() << "MainBench::testDiscriminators: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+
+        for (const auto& c : buf) {
+            sum += phaseDiscri.phaseDiscriminator(c);
+        }
+
+        nsecs[0] += timer.nsecsElapsed();
+        timer.start();
+
+        for (const auto& c : buf) {
+            sum += phaseDiscri.phaseDiscriminatorDelta(c, magsq, fmDev);
+        }
+
+        nsecs[1] += timer.nsecsElapsed();
+        timer.start();
+
+        for (const auto& c : buf) {
+            sum += phaseDiscri.phaseDiscriminator2(c);
+        }
+
+        nsecs[2] += timer.nsecsElapsed();
+    }
+
+    qDebug() << "MainBench::testDiscriminators: sum: " << sum;
+    printResults("MainBench::testDiscriminators: phaseDiscriminator", nsecs[0]);
+    printResults("MainBench::testDiscriminators: phaseDiscriminatorDelta", nsecs[1]);
+    printResults("MainBench::testDiscriminators: phaseDiscriminator2", nsecs[2]);
+}
+
+void MainBench::testFifos()
+{
+    QElapsedTimer timer;
+    qint64 nsecs;
+    quint64 nbTotal = (quint64) m_parser.getNbSamples() * m_parser.getRepetition();
+
+    qDebug() << "MainBench::testFifos: create test data";
+
+    SampleVector block(4096); // typical device engine block
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (auto& sample : block) {
+        sample.setReal(my_rand());
+        sample.setImag(my_rand());
+    }
+
+    qDebug() << "MainBench::testFifos: run test";
+
+    // write and read back one block at a time in the same thread so that only the FIFO overhead is measured
+
+    SampleSimpleFifo simpleFifo(8*block.size());
+    SampleVector::iterator part1begin, part1end, part2begin, part2end;
+    timer.start();
+
+    for (quint64 nbDone = 0; nbDone < nbTotal; nbDone += block.size())
+    {
+        simpleFifo.write(block.begin(), block.end());
+        unsigned int count = simpleFifo.readBegin(block.size(), &part1begin, &part1end, &part2begin, &part2end);
+        simpleFifo.readCommit(count);
+    }
+
+    nsecs = timer.nsecsElapsed();
+    printResults("MainBench::testFifos: SampleSimpleFifo", nsecs);
+
+    SampleSourceFifo sourceFifo(8*block.size());
+    unsigned int ipart1Begin, ipart1End, ipart2Begin, ipart2End;
+    timer.start();
+
+    for (quint64 nbDone = 0; nbDone < nbTotal; nbDone += block.size())
+    {
+        sourceFifo.read(block.size(), ipart1Begin, ipart1End, ipart2Begin, ipart2End);
+        sourceFifo.write(block.size(), ipart1Begin, ipart1End, ipart2Begin, ipart2End);
+        std::copy(block.begin(), block.begin() + (ipart1End - ipart1Begin), sourceFifo.getData().begin() + ipart1Begin);
+        std::copy(block.begin(), block.begin() + (ipart2End - ipart2Begin), sourceFifo.getData().begin() + ipart2Begin);
+    }
+
+    nsecs = timer.nsecsElapsed();
+    printResults("MainBench::testFifos: SampleSourceFifo", nsecs);
+
+    AudioVector audioBlock(block.size());
+    AudioFifo audioFifo(8*block.size());
+    timer.start();
+
+    for (quint64 nbDone = 0; nbDone < nbTotal; nbDone += block.size())
+    {
+        audioFifo.write((const quint8*) audioBlock.data(), audioBlock.size());
+        audioFifo.read((quint8*) audioBlock.data(), audioBlock.size());
+    }
+
+    nsecs = timer.nsecsElapsed();
+    printResults("MainBench::testFifos: AudioFifo", nsecs);
+}
+
+void MainBench::testIQCodec()
+{
+    QElapsedTimer timer;
+    qint64 nsecs[2];
+    quint64 nbTotal = (quint64) m_parser.getNbSamples() * m_parser.getRepetition();
+
+    qDebug() << "MainBench::testIQCodec: create test data";
+
+    // a tone over a noise floor in a block the size of a File Sink writer buffer
+    SampleVector block((4*1024*1024) / sizeof(Sample));
+    SampleVector decoded(block.size());
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (unsigned int i = 0; i < block.size(); i++)
+    {
+        block[i].setReal(1000.0 * cos(0.01 * i) + my_rand() / 16);
+        block[i].setImag(1000.0 * sin(0.01 * i) + my_rand() / 16);
+    }
+
+    qDebug() << "MainBench::testIQCodec: run test";
+
+    IQCodec codec;
+    std::vector<quint8> coded;
+    unsigned int effectiveBits[2] = {0, 8}; // lossless then lossy
+
+    for (unsigned int j = 0; j < 2; j++)
+    {
+        codec.configure(sizeof(Sample) / 2, effectiveBits[j]);
+        nsecs[0] = 0;
+        nsecs[1] = 0;
+        quint64 nbCoded = 0;
+        quint64 nbBlocks = 0;
+        bool ok = true;
+
+        for (quint64 nbDone = 0; nbDone < nbTotal; nbDone += block.size(), nbBlocks++)
+        {
+            timer.start();
+            nbCoded += codec.encode((const quint8*) block.data(), block.size(), coded);
+            nsecs[0] += timer.nsecsElapsed();
+            timer.start();
+            ok &= IQCodec::decode(coded.data(), coded.size(), sizeof(Sample) / 2, (quint8*) decoded.data());
+            nsecs[1] += timer.nsecsElapsed();
+        }
+
+        qDebug() << "MainBench::testIQCodec: effective bits:" << effectiveBits[j]
+            << "decode:" << (ok ? "OK" : "failed")
+            << "lossless:" << (std::equal(block.begin(), block.end(), decoded.begin(),
+                [](const Sample& a, const Sample& b) { return (a.real() == b.real()) && (a.imag() == b.imag()); }) ? "yes" : "no")
+            << "ratio:" << (double) nbCoded / (nbBlocks * block.size() * sizeof(Sample));
+        printResults(QString("MainBench::testIQCodec: encode %1 bits").arg(effectiveBits[j]), nsecs[0], nbBlocks * block.size());
+        printResults(QString("MainBench::testIQCodec: decode %1 bits").arg(effectiveBits[j]), nsecs[1], nbBlocks * block.size());
+    }
+}
+
+void MainBench::testDecimateBlockII()
+{
+    int len = m_parser.getNbSamples()*2;
+
+    qDebug() << "MainBench::testDecimateBlockII: create test data";
+
+    qint16 *buf = new qint16[len];
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+    std::generate(buf, buf + len, my_rand);
+    quint8 *bufU = new quint8[len];
+    std::uniform_int_distribution<int> uniform_distribution_u8(0, 255);
+    auto my_rand_u8 = std::bind(uniform_distribution_u8, m_generator);
+    std::generate(bufU, bufU + len, my_rand_u8);
+    std::vector<DecimateBlockBench::Result> results;
+
+    qDebug() << "MainBench::testDecimateBlockII: run test. SIMD block filters:"
+        << Decimators<qint32, qint16, SDR_RX_SAMP_SZ, 12, true>::isBlockModeAccelerated()
+        << "unsigned:" << DecimateBlockBench::isUAccelerated();
+
+    // the I/Q orders and the unsigned inputs share the block filters but not the final I/Q swap and the shifts
+    DecimateBlockBench::compare<Decimators<qint32, qint16, SDR_RX_SAMP_SZ, 12, true>>("IQ", buf, len, m_parser.getRepetition(), results);
+    DecimateBlockBench::compare<Decimators<qint32, qint16, SDR_RX_SAMP_SZ, 12, false>>("QI", buf, len, m_parser.getRepetition(), results);
+    DecimateBlockBench::compareU(bufU, len, m_parser.getRepetition(), results);
+
+    for (const auto& result : results)
+    {
+        QString prefix = QString("MainBench::testDecimateBlockII: %1").arg(result.m_name);
+        printResults(prefix + " sample by sample", result.m_nsecs[0]);
+        printResults(prefix + " block", result.m_nsecs[1]);
+
+        if (!result.m_identical) {
+            qWarning() << "MainBench::testDecimateBlockII:" << result.m_name << "block mode results differ";
+        }
+    }
+
+    qDebug() << "MainBench::testDecimateBlockII: cleanup test data";
+    delete[] bufU;
+    delete[] buf;
+}
+
+void MainBench::testSpectrumPower()
+{
+    static const unsigned int fftSizes[] = {1024, 4096};
+    QElapsedTimer timer;
+
+    qDebug() << "MainBench::testSpectrumPower: create test data";
+
+    ComplexVector fftOut(4096);
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+
+    for (auto& c : fftOut) {
+        c = Complex(my_rand(), my_rand());
+    }
+
+    std::vector<Real> spectrum[2]; // per bin log2f as before then block kernels
+    spectrum[0].resize(4096);
+    spectrum[1].resize(4096);
+    std::vector<Real> view(4096);
+    const Real mult = 10.0f / log2f(10.0f);
+
+    qDebug() << "MainBench::testSpectrumPower: run test. AVX2:" << CPUFeatures::hasAVX2();
+
+    for (unsigned int i = 0; i < sizeof(fftSizes)/sizeof(fftSizes[0]); i++)
+    {
+        unsigned int fftSize = fftSizes[i];
+        uint32_t nbFrames = std::max(1U, m_parser.getNbSamples() / fftSize);
+        Real ofs = 20.0f * log10f(1.0f / fftSize);
+        qint64 nsecs[3] = {0, 0, 0};
+        Real maxError = 0.0f;
+
+        for (uint32_t r = 0; r < m_parser.getRepetition(); r++)
+        {
+            timer.start();
+
+            for (uint32_t j = 0; j < nbFrames; j++)
+            {
+                for (unsigned int k = 0; k < fftSize; k++)
+                {
+                    const Complex& c = fftOut[k];
+                    Real v = c.real() * c.real() + c.imag() * c.imag();
+                    spectrum[0][k] = mult * log2f(v) + ofs;
+                }
+            }
+
+            nsecs[0] += timer.nsecsElapsed();
+            timer.start();
+
+            for (uint32_t j = 0; j < nbFrames; j++)
+            {
+                SpectrumPower::magSq(fftOut.data(), spectrum[1].data(), fftSize);
+                SpectrumPower::log2Scale(spectrum[1].data(), spectrum[1].data(), fftSize, mult, ofs);
+            }
+
+            nsecs[1] += timer.nsecsElapsed();
+            timer.start();
+
+            // lower resolution view of a 4 times smaller FFT from the same power spectrum
+            for (uint32_t j = 0; j < nbFrames; j++)
+            {
+                SpectrumPower::magSq(fftOut.data(), spectrum[1].data(), fftSize);
+                SpectrumPower::decimateSum(spectrum[1].data(), view.data(), fftSize / 4, 4);
+                SpectrumPower::log2Scale(view.data(), view.data(), fftSize / 4, mult, ofs);
+            }
+
+            nsecs[2] += timer.nsecsElapsed();
+        }
+
+        SpectrumPower::magSq(fftOut.data(), spectrum[1].data(), fftSize);
+        SpectrumPower::log2Scale(spectrum[1].data(), spectrum[1].data(), fftSize, mult, ofs);
+
+        for (unsigned int k = 0; k < fftSize; k++) {
+            maxError = std::max(maxError, std::fabs(spectrum[0][k] - spectrum[1][k]));
+        }
+
+        quint64 nbBins = (quint64) nbFrames * fftSize * m_parser.getRepetition();
+        QString prefix = QString("MainBench::testSpectrumPower: FFT %1").arg(fftSize);
+        printResults(prefix + " log2f per bin", nsecs[0], nbBins);
+        printResults(prefix + " block", nsecs[1], nbBins);
+        printResults(prefix + " block with 1/4 power view", nsecs[2], nbBins);
+        qDebug() << "MainBench::testSpectrumPower: FFT" << fftSize << "max error (dB):" << maxError;
+    }
+}
+
+void MainBench::testSpectrumHistogram()
+{
+    static const unsigned int fftSizes[] = {1024, 8192};
+    static const unsigned int nbLevels = SpectrumHistogram::m_nbLevels;
+    const Real referenceLevel = 0.0f;
+    const Real powerRange = 100.0f;
+    const int stroke = 30;
+    const quint8 decay = 1;
+    QElapsedTimer timer;
+
+    qDebug() << "MainBench::testSpectrumHistogram: create test data";
+
+    std::vector<Real> spectrum(8192);
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+
+    for (auto& v : spectrum) {
+        v = -60.0f + 40.0f * my_rand(); // my_rand in [-1, 1]
+    }
+
+    quint32 palette[SpectrumHistogram::m_nbColors];
+
+    for (unsigned int i = 0; i < SpectrumHistogram::m_nbColors; i++) {
+        palette[i] = 0xFF000000 | (i << 16) | (i << 8) | i;
+    }
+
+    std::vector<quint8> histogram[2]; // bin major layout and per cell loops as before then texture layout and block kernels
+    std::vector<quint32> pixels(nbLevels * 8192);
+    std::vector<int> levels(8192);
+
+    qDebug() << "MainBench::testSpectrumHistogram: run test. AVX2:" << CPUFeatures::hasAVX2();
+
+    for (unsigned int i = 0; i < sizeof(fftSizes)/sizeof(fftSizes[0]); i++)
+    {
+        unsigned int fftSize = fftSizes[i];
+        uint32_t nbFrames = std::max(1U, m_parser.getNbSamples() / fftSize);
+        qint64 nsecs[2] = {0, 0};
+        histogram[0].assign(nbLevels * fftSize, 0);
+        histogram[1].assign(nbLevels * fftSize, 0);
+
+        for (uint32_t r = 0; r < m_parser.getRepetition(); r++)
+        {
+            timer.start();
+
+            for (uint32_t j = 0; j < nbFrames; j++)
+            {
+                quint8 *b = histogram[0].data();
+
+                for (unsigned int k = 0; k < nbLevels * fftSize; k++, b++) {
+                    *b = *b > decay ? *b - decay : 0;
+                }
+
+                for (unsigned int k = 0; k < fftSize; k++)
+                {
+                    int v = (int) ((spectrum[k] - referenceLevel) * 100.0 / powerRange + 100.0);
+
+                    if ((v >= 0) && (v <= 99))
+                    {
+                        b = histogram[0].data() + k * nbLevels + v;
+                        *b = *b + stroke <= 239 ? *b + stroke : 239;
+                    }
+                }
+
+                for (unsigned int y = 0; y < nbLevels; y++)
+                {
+                    const quint8 *bs = histogram[0].data() + y;
+                    quint32 *pix = pixels.data() + (nbLevels - 1 - y) * fftSize;
+
+                    for (unsigned int x = 0; x < fftSize; x++, bs += nbLevels) {
+                        pix[x] = palette[*bs];
+                    }
+                }
+            }
+
+            nsecs[0] += timer.nsecsElapsed();
+            timer.start();
+
+            for (uint32_t j = 0; j < nbFrames; j++)
+            {
+                SpectrumHistogram::decay(histogram[1].data(), nbLevels * fftSize, decay);
+                SpectrumHistogram::stroke(histogram[1].data(), spectrum.data(), fftSize, referenceLevel, powerRange, stroke);
+                SpectrumHistogram::colorize(histogram[1].data(), pixels.data(), nbLevels * fftSize, palette);
+            }
+
+            SpectrumHistogram::maxLevels(histogram[1].data(), levels.data(), fftSize);
+            nsecs[1] += timer.nsecsElapsed();
+        }
+
+        unsigned int nbDiffs = 0;
+
+        for (unsigned int k = 0; k < fftSize; k++)
+        {
+            for (unsigned int v = 0; v < nbLevels; v++) {
+                nbDiffs += histogram[0][k * nbLevels + v] != histogram[1][(nbLevels - 1 - v) * fftSize + k] ? 1 : 0;
+            }
+        }
+
+        quint64 nbBins = (quint64) nbFrames * fftSize * m_parser.getRepetition();
+        QString prefix = QString("MainBench::testSpectrumHistogram: FFT %1").arg(fftSize);
+        printResults(prefix + " per cell", nsecs[0], nbBins);
+        printResults(prefix + " block", nsecs[1], nbBins);
+        qDebug() << "MainBench::testSpectrumHistogram: FFT" << fftSize << "differences:" << nbDiffs;
+    }
+}
+
+/** Compares the triggers and the final comparator state of the per sample and block runs. Returns the number of mismatches. */
+static int checkScopeTrigger(const std::vector<uint32_t> triggers[2], const BenchTriggerCondition conditions[2],
+    unsigned int testCase, uint32_t holdoff, unsigned int edge)
+{
+    int nbMismatches = 0;
+
+    if (triggers[0] != triggers[1])
+    {
+        unsigned int k = 0;
+
+        while ((k < triggers[0].size()) && (k < triggers[1].size()) && (triggers[0][k] == triggers[1][k])) {
+            k++;
+        }
+
+        qWarning("MainBench::testScopeTrigger: mismatch: case %u holdoff %u edge %u: %u per sample triggers for %u block triggers. First difference at trigger %u: %d / %d",
+            testCase, holdoff, edge, (unsigned int) triggers[0].size(), (unsigned int) triggers[1].size(), k,
+            k < triggers[0].size() ? (int) triggers[0][k] : -1,
+            k < triggers[1].size() ? (int) triggers[1][k] : -1);
+        nbMismatches++;
+    }
+
+    if ((conditions[0].m_prevCondition != conditions[1].m_prevCondition)
+     || (conditions[0].m_trues != conditions[1].m_trues)
+     || (conditions[0].m_falses != conditions[1].m_falses))
+    {
+        qWarning("MainBench::testScopeTrigger: mismatch: case %u holdoff %u edge %u: comparator state %d/%u/%u per sample %d/%u/%u block",
+            testCase, holdoff, edge,
+            conditions[0].m_prevCondition ? 1 : 0, conditions[0].m_trues, conditions[0].m_falses,
+            conditions[1].m_prevCondition ? 1 : 0, conditions[1].m_trues, conditions[1].m_falses);
+        nbMismatches++;
+    }
+
+    return nbMismatches;
+}
+
+void MainBench::testScopeTrigger()
+{
+    struct TestCase
+    {
+        Projector::ProjectionType m_projectionType;
+        Real m_level;
+    };
+
+    // levels as in the trigger settings. Magnitude levels are for a magnitude of 0.3
+    static const TestCase testCases[] = {
+        {Projector::ProjectionReal, 0.1f},
+        {Projector::ProjectionImag, -0.1f},
+        {Projector::ProjectionMagSq, 0.09f},
+        {Projector::ProjectionMagLin, -0.7f},
+        {Projector::ProjectionMagDB, 1.0f - 0.1046f}
+    };
+    static const uint32_t holdoffs[] = {1, 16};
+    const unsigned int nbHoldoffs = sizeof(holdoffs)/sizeof(holdoffs[0]);
+    const unsigned int nbEdges = 3; // positive, negative, both
+    const float scale = SDR_RX_SCALEF;
+    QElapsedTimer timer;
+
+    qDebug() << "MainBench::testScopeTrigger: create test data";
+
+    // long runs on each side of the levels with noisy crossings and some samples right on the levels
+    uint32_t nbSamples = std::max(2U, m_parser.getNbSamples());
+    SampleVector samples(nbSamples);
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+
+    for (uint32_t i = 0; i < nbSamples; i++)
+    {
+        float mag = 0.3f + 0.25f * sinf((2.0f * M_PI * i) / 997.0f) + 0.01f * my_rand();
+        float phase = M_PI * my_rand();
+        samples[i].m_real = (FixReal) (mag * cosf(phase) * scale);
+        samples[i].m_imag = (FixReal) (mag * sinf(phase) * scale);
+    }
+
+    for (uint32_t i = 0; i < nbSamples; i += 101) {
+        samples[i].m_real = (FixReal) (0.1f * scale);
+    }
+
+    qDebug() << "MainBench::testScopeTrigger: run test. AVX2:" << CPUFeatures::hasAVX2();
+    int nbMismatches = 0;
+
+    for (unsigned int i = 0; i < sizeof(testCases)/sizeof(testCases[0]); i++)
+    {
+        qint64 nsecs[2] = {0, 0};
+
+        for (unsigned int h = 0; h < nbHoldoffs; h++)
+        {
+            for (unsigned int e = 0; e < nbEdges; e++)
+            {
+                for (uint32_t r = 0; r < m_parser.getRepetition(); r++)
+                {
+                    BenchTriggerCondition conditions[2] = {
+                        BenchTriggerCondition(testCases[i].m_projectionType, testCases[i].m_level, holdoffs[h], e == 2, e == 0),
+                        BenchTriggerCondition(testCases[i].m_projectionType, testCases[i].m_level, holdoffs[h], e == 2, e == 0)
+                    };
+                    ScopeTriggerComparator<BenchTriggerCondition> comparators[2];
+                    std::vector<uint32_t> triggers[2];
+
+                    // per sample comparison
+                    timer.start();
+
+                    for (uint32_t k = 0; k < nbSamples; k++)
+                    {
+                        if (comparators[0].triggered(samples[k], conditions[0])) {
+                            triggers[0].push_back(k);
+                        }
+                    }
+
+                    nsecs[0] += timer.nsecsElapsed();
+
+                    // block search then per sample comparison like ScopeVis::processTrace
+                    timer.start();
+
+                    for (uint32_t k = 0; k < nbSamples; k++)
+                    {
+                        k += comparators[1].skippable(&samples[k], nbSamples - k, conditions[1]);
+
+                        if (k == nbSamples) {
+                            break;
+                        }
+
+                        if (comparators[1].triggered(samples[k], conditions[1])) {
+                            triggers[1].push_back(k);
+                        }
+                    }
+
+                    nsecs[1] += timer.nsecsElapsed();
+
+                    if (r == 0) {
+                        nbMismatches += checkScopeTrigger(triggers, conditions, i, holdoffs[h], e);
+                    }
+                }
+            }
+        }
+
+        quint64 nbTotal = (quint64) nbSamples * m_parser.getRepetition() * nbHoldoffs * nbEdges;
+        QString prefix = QString("MainBench::testScopeTrigger: projection %1").arg((int) testCases[i].m_projectionType);
+        printResults(prefix + " per sample", nsecs[0], nbTotal);
+        printResults(prefix + " block", nsecs[1], nbTotal);
+    }
+
+    qDebug() << "MainBench::testScopeTrigger: output check mismatches:" << nbMismatches;
+}
+
+qint64 MainBench::transferSampleSinkFifo(bool lockFree, const SampleVector& block)
+{
+    SampleSinkFifo fifo(SampleSinkFifo::getSizePolicy(2000000));
+    fifo.setLockFree(lockFree);
+    quint64 nbTotal = (quint64) m_parser.getNbSamples() * m_parser.getRepetition();
+    QElapsedTimer timer;
+    timer.start();
+
+    // consumer side as in the channel basebands handleData()
+    std::thread reader([&fifo, nbTotal]() {
+        quint64 nbRead = 0;
+
+        while (nbRead < nbTotal)
+        {
+            SampleVector::iterator part1begin;
+            SampleVector::iterator part1end;
+            SampleVector::iterator part2begin;
+            SampleVector::iterator part2end;
+
+            unsigned int count = fifo.readBegin(fifo.fill(), &part1begin, &part1end, &part2begin, &part2end);
+            fifo.readCommit(count);
+            nbRead += count;
+        }
+    });
+
+    // producer side as in DSPDeviceSourceEngine::work()
+    quint64 nbWritten = 0;
+
+    while (nbWritten < nbTotal)
+    {
+        if (fifo.size() - fifo.fill() >= block.size()) {
+            nbWritten += fifo.write(block.begin(), block.end());
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    reader.join();
+    return timer.nsecsElapsed();
+}
+
 void MainBench::decimateII(const qint16* buf, int len)
 {
     SampleVector::iterator it = m_convertBuffer.begin();
@@ -399,10 +1607,80 @@ void MainBench::decimateFF(const float *buf, int len)
     }
 }
 
-void MainBench::printResults(const QString& prefix, qint64 nsecs)
+void MainBench::printResults(const QString& prefix, qint64 nsecs, quint64 nbSamples)
 {
-    double ratekSs = (m_parser.getNbSamples()*m_parser.getRepetition() / (double) nsecs) * 1e6;
+    if (nbSamples == 0) {
+        nbSamples = (quint64) m_parser.getNbSamples() * m_parser.getRepetition();
+    }
+
+    double ratekSs = (nbSamples / (double) nsecs) * 1e6;
+    double nsPerSample = nsecs / (double) nbSamples;
     QDebug info = qInfo();
     info.noquote();
-    info << tr("%1: ran test in %L2 ns - sample rate: %3 kS/s").arg(prefix).arg(nsecs).arg(ratekSs);
+    info << tr("%1: ran test in %L2 ns - sample rate: %3 kS/s - %4 ns/sample").arg(prefix).arg(nsecs).arg(ratekSs).arg(nsPerSample);
+
+    QJsonObject result;
+    result.insert("test", m_testStr);
+    result.insert("name", prefix);
+    result.insert("samples", (double) nbSamples);
+    result.insert("nsecs", (double) nsecs);
+    result.insert("samplesPerSecond", ratekSs * 1e3);
+    result.insert("nsPerSample", nsPerSample);
+    m_jsonResults.append(result);
+}
+
+void MainBench::writeJsonResults()
+{
+    QJsonObject build;
+    build.insert("qtVersion", QString(qVersion()));
+    build.insert("sampleBits", SDR_RX_SAMP_SZ);
+#if defined(USE_AVX2)
+    build.insert("simd", QString("AVX2"));
+#elif defined(USE_SSE4_1)
+    build.insert("simd", QString("SSE4.1"));
+#elif defined(USE_SSSE3)
+    build.insert("simd", QString("SSSE3"));
+#elif defined(USE_SSE2)
+    build.insert("simd", QString("SSE2"));
+#elif defined(USE_NEON)
+    build.insert("simd", QString("NEON"));
+#else
+    build.insert("simd", QString("none"));
+#endif
+#ifdef USE_FFTW
+    build.insert("fft", QString("fftw"));
+#else
+    build.insert("fft", QString("kiss"));
+#endif
+
+    QJsonObject host;
+    host.insert("name", QSysInfo::machineHostName());
+    host.insert("cpuArchitecture", QSysInfo::currentCpuArchitecture());
+    host.insert("os", QSysInfo::prettyProductName());
+    host.insert("simd", QString(CPUFeatures::getLevelName(CPUFeatures::getDetectedLevel())));
+    host.insert("simdKernels", QString(CPUFeatures::getLevelName(CPUFeatures::getLevel()))); // can be lowered with SDRANGEL_SIMD
+
+    QJsonObject parameters;
+    parameters.insert("test", m_parser.getTestStr());
+    parameters.insert("nbSamples", (double) m_parser.getNbSamples());
+    parameters.insert("repetition", (double) m_parser.getRepetition());
+    parameters.insert("log2Factor", (double) m_parser.getLog2Factor());
+
+    QJsonObject report;
+    report.insert("date", QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+    report.insert("build", build);
+    report.insert("host", host);
+    report.insert("parameters", parameters);
+    report.insert("results", m_jsonResults);
+
+    QFile file(m_parser.getJsonFileName());
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning("MainBench::writeJsonResults: cannot open %s", qPrintable(m_parser.getJsonFileName()));
+        return;
+    }
+
+    file.write(QJsonDocument(report).toJson());
+    qInfo("MainBench::writeJsonResults: results written to %s", qPrintable(m_parser.getJsonFileName()));
 }
@@ -21,6 +21,7 @@
 #define SDRBENCH_MAINBENCH_H_
 
 #include <QObject>
+#include <QJsonArray>
 #include <random>
 #include <functional>
 
@@ -30,6 +31,8 @@
 #include "dsp/decimatorsff.h"
 #include "parserbench.h"
 
+class FFTEngine;
+
 namespace qtwebapp {
     class LoggerWithFile;
 }
@@ -53,13 +56,34 @@ private:
     void testDecimateFI();
     void testDecimateFF();
     void testAMBE();
+    void testSampleSinkFifo();
+    void testChannelizer();
+    void testPFBChannelizer();
+    void testInterpolator();
+    void testUpChannelizer();
+    void testFFTFilter();
+    void testFFTEngine();
+    void testNCO();
+    void testAGC();
+    void testDiscriminators();
+    void testFifos();
+    void testIQCodec();
+    void testDecimateBlockII();
+    void testSpectrumPower();
+    void testSpectrumHistogram();
+    void testScopeTrigger();
+    void runTest(ParserBench::TestType testType);
     void decimateII(const qint16 *buf, int len);
     void decimateInfII(const qint16 *buf, int len);
     void decimateSupII(const qint16 *buf, int len);
     void decimateIF(const qint16 *buf, int len);
     void decimateFI(const float *buf, int len);
     void decimateFF(const float *buf, int len);
-    void printResults(const QString& prefix, qint64 nsecs);
+    qint64 transferSampleSinkFifo(bool lockFree, const SampleVector& block);
+    qint64 resampleInterpolator(bool buffer, int inputRate, int outputRate, const ComplexVector& in);
+    qint64 transformFFTEngine(FFTEngine *engine, int fftSize, quint64& nbSamples);
+    void printResults(const QString& prefix, qint64 nsecs, quint64 nbSamples = 0); //!< nbSamples 0 defaults to samples times repetitions
+    void writeJsonResults();
 
     static MainBench *m_instance;
     qtwebapp::LoggerWithFile *m_logger;
@@ -67,6 +91,8 @@ private:
     std::mt19937 m_generator;
     std::uniform_real_distribution<float> m_uniform_distribution_f;
     std::uniform_int_distribution<qint16> m_uniform_distribution_s16;
+    QString m_testStr;        //!< name of the test being run
+    QJsonArray m_jsonResults; //!< results of all tests run
 
 	Decimators<qint32, qint16, SDR_RX_SAMP_SZ, 12, true> m_decimatorsII;
 	DecimatorsIF<qint16, 12, true> m_decimatorsIF;
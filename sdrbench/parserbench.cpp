@@ -22,9 +22,41 @@
 
 #include "parserbench.h"
 
+static const struct
+{
+    const char *m_str;
+    ParserBench::TestType m_type;
+} testTypes[] = {
+    {"decimateii", ParserBench::TestDecimatorsII},
+    {"decimatefi", ParserBench::TestDecimatorsFI},
+    {"decimateff", ParserBench::TestDecimatorsFF},
+    {"decimateif", ParserBench::TestDecimatorsIF},
+    {"decimateinfii", ParserBench::TestDecimatorsInfII},
+    {"decimatesupii", ParserBench::TestDecimatorsSupII},
+    {"ambe", ParserBench::TestAMBE},
+    {"samplesinkfifo", ParserBench::TestSampleSinkFifo},
+    {"channelizer", ParserBench::TestChannelizer},
+    {"pfb", ParserBench::TestPFBChannelizer},
+    {"interpolator", ParserBench::TestInterpolator},
+    {"upchannelizer", ParserBench::TestUpChannelizer},
+    {"fftfilt", ParserBench::TestFFTFilter},
+    {"fft", ParserBench::TestFFTEngine},
+    {"nco", ParserBench::TestNCO},
+    {"agc", ParserBench::TestAGC},
+    {"discriminator", ParserBench::TestDiscriminators},
+    {"fifo", ParserBench::TestFifos},
+    {"iqcodec", ParserBench::TestIQCodec},
+    {"decimateblockii", ParserBench::TestDecimatorsBlockII},
+    {"spectrum", ParserBench::TestSpectrumPower},
+    {"histogram", ParserBench::TestSpectrumHistogram},
+    {"scopetrigger", ParserBench::TestScopeTrigger},
+    {"all", ParserBench::TestAll}
+};
+
 ParserBench::ParserBench() :
     m_testOption(QStringList() << "t" << "test",
-        "Test type: decimateii, decimatefi, decimateff, decimateif, decimateinfii, decimatesupii, ambe",
+        "Test type: decimateii, decimatefi, decimateff, decimateif, decimateinfii, decimatesupii, ambe, samplesinkfifo, channelizer, pfb, interpolator, "
+        "upchannelizer, fftfilt, fft, nco, agc, discriminator, fifo, iqcodec, decimateblockii, spectrum, histogram, scopetrigger, all (all but ambe)",
         "test",
         "decimateii"),
     m_nbSamplesOption(QStringList() << "n" << "nb-samples",
@@ -38,7 +70,11 @@ ParserBench::ParserBench() :
     m_log2FactorOption(QStringList() << "l" << "log2-factor",
         "Log2 factor for rate conversion.",
         "log2",
-        "2")
+        "2"),
+    m_jsonOption(QStringList() << "j" << "json",
+        "Write results as JSON to this file.",
+        "file",
+        "")
 {
     m_testStr = "decimateii";
     m_nbSamples = 1048576;
@@ -53,6 +89,7 @@ ParserBench::ParserBench() :
     m_parser.addOption(m_nbSamplesOption);
     m_parser.addOption(m_repetitionOption);
     m_parser.addOption(m_log2FactorOption);
+    m_parser.addOption(m_jsonOption);
 }
 
 ParserBench::~ParserBench()
@@ -111,23 +148,32 @@ void ParserBench::parse(const QCoreApplication& app)
     } else {
         qWarning() << "ParserBench::parse: repetilog2 factortion invalid. Defaulting to " << m_log2Factor;
     }
+
+    // JSON output file
+
+    m_jsonFileName = m_parser.value(m_jsonOption);
 }
 
 ParserBench::TestType ParserBench::getTestType() const
 {
-    if (m_testStr == "decimatefi") {
-        return TestDecimatorsFI;
-    } else if (m_testStr == "decimateff") {
-        return TestDecimatorsFF;
-    } else if (m_testStr == "decimateif") {
-        return TestDecimatorsIF;
-    } else if (m_testStr == "decimateinfii") {
-        return TestDecimatorsInfII;
-    } else if (m_testStr == "decimatesupii") {
-        return TestDecimatorsSupII;
-    } else if (m_testStr == "ambe") {
-        return TestAMBE;
-    } else {
-        return TestDecimatorsII;
+    for (unsigned int i = 0; i < sizeof(testTypes)/sizeof(testTypes[0]); i++)
+    {
+        if (m_testStr == testTypes[i].m_str) {
+            return testTypes[i].m_type;
+        }
     }
+
+    return TestDecimatorsII;
+}
+
+QString ParserBench::getTestStr(TestType testType)
+{
+    for (unsigned int i = 0; i < sizeof(testTypes)/sizeof(testTypes[0]); i++)
+    {
+        if (testType == testTypes[i].m_type) {
+            return testTypes[i].m_str;
+        }
+    }
+
+    return "decimateii";
 }
@@ -33,7 +33,24 @@ public:
         TestDecimatorsFF,
         TestDecimatorsInfII,
         TestDecimatorsSupII,
-        TestAMBE
+        TestAMBE,
+        TestSampleSinkFifo,
+        TestChannelizer,
+        TestPFBChannelizer,
+        TestInterpolator,
+        TestUpChannelizer,
+        TestFFTFilter,
+        TestFFTEngine,
+        TestNCO,
+        TestAGC,
+        TestDiscriminators,
+        TestFifos,
+        TestIQCodec,
+        TestDecimatorsBlockII,
+        TestSpectrumPower,
+        TestSpectrumHistogram,
+        TestScopeTrigger,
+        TestAll
     } TestType;
 
     ParserBench();
@@ -43,21 +60,25 @@ public:
 
     const QString& getTestStr() const { return m_testStr; }
     TestType getTestType() const;
+    static QString getTestStr(TestType testType);
     uint32_t getNbSamples() const { return m_nbSamples; }
     uint32_t getRepetition() const { return m_repetition; }
     uint32_t getLog2Factor() const { return m_log2Factor; }
+    const QString& getJsonFileName() const { return m_jsonFileName; }
 
 private:
     QString  m_testStr;
     uint32_t m_nbSamples;
     uint32_t m_repetition;
     uint32_t m_log2Factor;
+    QString  m_jsonFileName;
 
     QCommandLineParser m_parser;
     QCommandLineOption m_testOption;
     QCommandLineOption m_nbSamplesOption;
     QCommandLineOption m_repetitionOption;
     QCommandLineOption m_log2FactorOption;
+    QCommandLineOption m_jsonOption;
 };
 
 
@@ -38,18 +38,10 @@
 
 DeviceUISet::DeviceUISet(int tabIndex, DeviceSet *deviceSet, int deviceType, QTimer& timer)
 {
+    (void) deviceType;
     m_spectrum = new GLSpectrum;
-
-    if ((deviceType == 0) || (deviceType == 2)) // Single Rx or MIMO
-    {
-        m_spectrumVis = new SpectrumVis(SDR_RX_SCALEF);
-        m_spectrumVis->setGLSpectrum(m_spectrum);
-    }
-    else if (deviceType == 1) // Single Tx
-    {
-        m_spectrumVis = new SpectrumVis(SDR_TX_SCALEF);
-        m_spectrumVis->setGLSpectrum(m_spectrum);
-    }
+    m_spectrumVis = deviceSet->m_spectrumVis; // owned by the device set that outlives this
+    m_spectrumVis->setGLSpectrum(m_spectrum);
 
     m_spectrum->connectTimer(timer);
     m_spectrumGUI = new GLSpectrumGUI;
@@ -76,8 +68,9 @@ DeviceUISet::DeviceUISet(int tabIndex, DeviceSet *deviceSet, int deviceType, QTi
 DeviceUISet::~DeviceUISet()
 {
     delete m_channelWindow;
+    m_spectrumVis->setMessageQueueToGUI(nullptr);
+    m_spectrumVis->setGLSpectrum(nullptr);
     delete m_spectrumGUI;
-    delete m_spectrumVis;
     delete m_spectrum;
 }
 
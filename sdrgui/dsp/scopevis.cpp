@@ -34,6 +34,7 @@ MESSAGE_CLASS_DEFINITION(ScopeVis::MsgScopeVisNGChangeTrace, Message)
 MESSAGE_CLASS_DEFINITION(ScopeVis::MsgScopeVisNGRemoveTrace, Message)
 MESSAGE_CLASS_DEFINITION(ScopeVis::MsgScopeVisNGMoveTrace, Message)
 MESSAGE_CLASS_DEFINITION(ScopeVis::MsgScopeVisNGFocusOnTrace, Message)
+MESSAGE_CLASS_DEFINITION(ScopeVis::MsgScopeVisNGTimeDisplay, Message)
 MESSAGE_CLASS_DEFINITION(ScopeVis::MsgScopeVisNGOneShot, Message)
 MESSAGE_CLASS_DEFINITION(ScopeVis::MsgScopeVisNGMemoryTrace, Message)
 
@@ -63,7 +64,9 @@ ScopeVis::ScopeVis(GLScope* glScope) :
     m_maxTraceDelay(0),
     m_triggerOneShot(false),
     m_triggerWaitForReset(false),
-    m_currentTraceMemoryIndex(0)
+    m_currentTraceMemoryIndex(0),
+    m_envelopeDecimation(1),
+    m_timeDisplay(true)
 {
     setObjectName("ScopeVis");
     m_traceDiscreteMemory.resize(m_traceChunkDefaultSize); // arbitrary
@@ -170,6 +173,12 @@ void ScopeVis::focusOnTrace(uint32_t traceIndex)
     getInputMessageQueue()->push(cmd);
 }
 
+void ScopeVis::setTimeDisplay(bool timeDisplay)
+{
+    Message* cmd = MsgScopeVisNGTimeDisplay::create(timeDisplay);
+    getInputMessageQueue()->push(cmd);
+}
+
 void ScopeVis::addTrigger(const TriggerData& triggerData)
 {
     Message* cmd = MsgScopeVisNGAddTrigger::create(triggerData);
@@ -288,6 +297,7 @@ void ScopeVis::processMemoryTrace()
         SampleVector::const_iterator mbegin = mend - m_traceSize;
         SampleVector::const_iterator mbegin_tb = mbegin - m_maxTraceDelay;
         m_nbSamples = m_traceSize + m_maxTraceDelay;
+        updateEnvelopeDecimation();
 
         processTraces(mbegin_tb, mbegin, true); // traceback
         processTraces(mbegin, mend, false);
@@ -354,6 +364,12 @@ void ScopeVis::processTrace(const SampleVector::const_iterator& cbegin, const Sa
                 }
             }
 
+            begin += m_triggerComparator.skippable(&(*begin), end - begin, *triggerCondition); // block search of the next possible trigger
+
+            if (begin == end) {
+                break;
+            }
+
             if (m_triggerComparator.triggered(*begin, *triggerCondition)) // matched the current trigger
             {
                 if (triggerCondition->m_triggerData.m_triggerDelay > 0)
@@ -398,6 +414,7 @@ void ScopeVis::processTrace(const SampleVector::const_iterator& cbegin, const Sa
             // if trace time is 1s or more the display is progressive so we have to clear it first
 
             float traceTime = ((float) m_traceSize) / m_sampleRate;
+            updateEnvelopeDecimation();
 
             if (traceTime >= 1.0f) {
                 initTraceBuffers();
@@ -490,6 +507,7 @@ int ScopeVis::processTraces(const SampleVector::const_iterator& cbegin, const Sa
     SampleVector::const_iterator begin(cbegin);
     uint32_t shift = (m_timeOfsProMill / 1000.0) * m_traceSize;
     uint32_t length = m_traceSize / m_timeBase;
+    uint32_t windowEnd = std::min(shift + length, m_traceSize); // end of displayed samples
 
     while ((begin < end) && (m_nbSamples > 0))
     {
@@ -597,9 +615,55 @@ int ScopeVis::processTraces(const SampleVector::const_iterator& cbegin, const Sa
                     v = -1.0f;
                 }
 
-                (*itTrace)[2*traceCount]
-                           = traceCount - shift;   // display x
-                (*itTrace)[2*traceCount + 1] = v;  // display y
+                if (m_envelopeDecimation == 1)
+                {
+                    (*itTrace)[2*traceCount]
+                               = traceCount - shift;   // display x
+                    (*itTrace)[2*traceCount + 1] = v;  // display y
+                }
+                else if ((traceCount >= shift) && (traceCount < windowEnd)) // min and max envelope per display column
+                {
+                    TraceControl *traceControl = *itCtl;
+                    uint32_t x = traceCount - shift;
+
+                    if ((traceControl->m_envelopeFill == 0) || (x == 0)) // start of column
+                    {
+                        traceControl->m_envelopeMin = v;
+                        traceControl->m_envelopeMax = v;
+                        traceControl->m_envelopeMaxFirst = false;
+                        traceControl->m_envelopeFill = 0;
+                    }
+                    else if (v < traceControl->m_envelopeMin)
+                    {
+                        traceControl->m_envelopeMin = v;
+                        traceControl->m_envelopeMaxFirst = true;
+                    }
+                    else if (v > traceControl->m_envelopeMax)
+                    {
+                        traceControl->m_envelopeMax = v;
+                        traceControl->m_envelopeMaxFirst = false;
+                    }
+
+                    traceControl->m_envelopeFill++;
+
+                    if ((traceControl->m_envelopeFill == m_envelopeDecimation) || (traceCount == windowEnd - 1)) // end of column
+                    {
+                        uint32_t column = x / m_envelopeDecimation;
+                        uint32_t index = shift + 2*column; // the column pair of points
+
+                        if (index + 1 < m_traceSize)
+                        {
+                            float *point = &(*itTrace)[2*index];
+                            point[0] = column * m_envelopeDecimation; // display x
+                            point[1] = traceControl->m_envelopeMaxFirst ? traceControl->m_envelopeMax : traceControl->m_envelopeMin;
+                            point[2] = point[0];
+                            point[3] = traceControl->m_envelopeMaxFirst ? traceControl->m_envelopeMin : traceControl->m_envelopeMax;
+                        }
+
+                        traceControl->m_envelopeFill = 0;
+                    }
+                }
+
                 traceCount++;
             }
         }
@@ -611,7 +675,7 @@ int ScopeVis::processTraces(const SampleVector::const_iterator& cbegin, const Sa
     float traceTime = ((float) m_traceSize) / m_sampleRate;
 
     if (traceTime >= 1.0f) { // display continuously if trace time is 1 second or more
-        m_glScope->newTraces(m_traces.m_traces, m_traces.currentBufferIndex(), &m_traces.m_projectionTypes);
+        m_glScope->newTraces(m_traces.m_traces, m_traces.currentBufferIndex(), &m_traces.m_projectionTypes, m_envelopeDecimation);
     }
 
     if (m_nbSamples == 0) // finished
@@ -620,7 +684,7 @@ int ScopeVis::processTraces(const SampleVector::const_iterator& cbegin, const Sa
         if (traceTime < 1.0f)
         {
             if (m_glScope->getProcessingTraceIndex().load() < 0) {
-                m_glScope->newTraces(m_traces.m_traces, m_traces.currentBufferIndex(), &m_traces.m_projectionTypes);
+                m_glScope->newTraces(m_traces.m_traces, m_traces.currentBufferIndex(), &m_traces.m_projectionTypes, m_envelopeDecimation);
             }
         }
 
@@ -860,6 +924,19 @@ bool ScopeVis::handleMessage(const Message& message)
 
         return true;
     }
+    else if (MsgScopeVisNGTimeDisplay::match(message))
+    {
+        QMutexLocker configLocker(&m_mutex);
+        MsgScopeVisNGTimeDisplay& conf = (MsgScopeVisNGTimeDisplay&) message;
+        m_timeDisplay = conf.getTimeDisplay();
+        qDebug() << "ScopeVis::handleMessage: MsgScopeVisNGTimeDisplay: " << m_timeDisplay;
+
+        if ((m_glScope) && (m_currentTraceMemoryIndex > 0)) {
+            processMemoryTrace();
+        }
+
+        return true;
+    }
     else if (MsgScopeVisNGOneShot::match(message))
     {
         MsgScopeVisNGOneShot& conf = (MsgScopeVisNGOneShot&) message;
@@ -969,14 +1046,31 @@ void ScopeVis::initTraceBuffers()
     {
         for (unsigned int i = 0; i < m_traceSize; i++)
         {
-            (*it0)[2*i] = (i - shift); // display x
-            (*it0)[2*i + 1] = 0.0f;    // display y
-            (*it1)[2*i] = (i - shift); // display x
-            (*it1)[2*i + 1] = 0.0f;    // display y
+            float x = (i - shift);
+
+            if ((m_envelopeDecimation > 1) && ((int) i >= shift)) { // envelope columns pairs of points
+                x = ((i - shift) / 2) * m_envelopeDecimation;
+            }
+
+            (*it0)[2*i] = x;        // display x
+            (*it0)[2*i + 1] = 0.0f; // display y
+            (*it1)[2*i] = x;        // display x
+            (*it1)[2*i + 1] = 0.0f; // display y
         }
     }
 }
 
+void ScopeVis::updateEnvelopeDecimation()
+{
+    uint32_t length = m_traceSize / m_timeBase;
+
+    if (m_timeDisplay && (length > 2*m_envelopeNbColumns)) {
+        m_envelopeDecimation = (length + m_envelopeNbColumns - 1) / m_envelopeNbColumns;
+    } else {
+        m_envelopeDecimation = 1;
+    }
+}
+
 void ScopeVis::computeDisplayTriggerLevels()
 {
     std::vector<TraceData>::iterator itData = m_traces.m_tracesData.begin();
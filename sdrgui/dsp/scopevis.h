@@ -33,6 +33,7 @@
 #include "dsp/dsptypes.h"
 #include "dsp/basebandsamplesink.h"
 #include "dsp/projector.h"
+#include "dsp/scopetriggercomparator.h"
 #include "export.h"
 #include "util/message.h"
 #include "util/doublebuffer.h"
@@ -168,6 +169,7 @@ public:
     void moveTrigger(uint32_t triggerIndex, bool upElseDown);
     void focusOnTrigger(uint32_t triggerIndex);
     void setOneShot(bool oneShot);
+    void setTimeDisplay(bool timeDisplay); //!< GLScope displays traces versus time (X or Y only)
     void setMemoryIndex(uint32_t memoryIndex);
     void setTraceChunkSize(uint32_t chunkSize) { m_traceChunkSize = chunkSize; }
     uint32_t getTraceChunkSize() const { return m_traceChunkSize; }
@@ -515,6 +517,27 @@ private:
         {}
     };
 
+    // ---------------------------------------------
+    class MsgScopeVisNGTimeDisplay : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        static MsgScopeVisNGTimeDisplay* create(
+                bool timeDisplay)
+        {
+            return new MsgScopeVisNGTimeDisplay(timeDisplay);
+        }
+
+        bool getTimeDisplay() const { return m_timeDisplay; }
+
+    private:
+        bool m_timeDisplay;
+
+        MsgScopeVisNGTimeDisplay(bool timeDisplay) :
+            m_timeDisplay(timeDisplay)
+        {}
+    };
+
     // ---------------------------------------------
     class MsgScopeVisNGOneShot : public Message {
         MESSAGE_CLASS_DECLARATION
@@ -844,6 +867,10 @@ private:
         double m_maxPow;          //!< Maximum power over the current trace for MagDB overlay display
         double m_sumPow;          //!< Cumulative power over the current trace for MagDB overlay display
         int m_nbPow;              //!< Number of power samples over the current trace for MagDB overlay display
+        uint32_t m_envelopeFill;  //!< Number of samples in the current envelope column
+        float m_envelopeMin;      //!< Minimum of the current envelope column
+        float m_envelopeMax;      //!< Maximum of the current envelope column
+        bool m_envelopeMaxFirst;  //!< Maximum comes before minimum in the current envelope column
 
         TraceControl() : m_projector(Projector::ProjectionReal)
         {
@@ -870,6 +897,10 @@ private:
             m_maxPow = 0.0f;
             m_sumPow = 0.0f;
             m_nbPow = 0;
+            m_envelopeFill = 0;
+            m_envelopeMin = 0.0f;
+            m_envelopeMax = 0.0f;
+            m_envelopeMaxFirst = false;
         }
     };
 
@@ -1039,95 +1070,7 @@ private:
         float *m_x1;
     };
 
-    class TriggerComparator
-    {
-    public:
-        TriggerComparator() : m_level(0), m_reset(true)
-        {
-            computeLevels();
-        }
-
-        bool triggered(const Sample& s, TriggerCondition& triggerCondition)
-        {
-            if (triggerCondition.m_triggerData.m_triggerLevel != m_level)
-            {
-                m_level = triggerCondition.m_triggerData.m_triggerLevel;
-                computeLevels();
-            }
-
-            bool condition, trigger;
-
-            if (triggerCondition.m_projector.getProjectionType() == Projector::ProjectionMagDB) {
-                condition = triggerCondition.m_projector.run(s) > m_levelPowerDB;
-            } else if (triggerCondition.m_projector.getProjectionType() == Projector::ProjectionMagLin) {
-                condition = triggerCondition.m_projector.run(s) > m_levelPowerLin;
-            } else {
-                condition = triggerCondition.m_projector.run(s) > m_level;
-            }
-
-            if (condition)
-            {
-                if (triggerCondition.m_trues < triggerCondition.m_triggerData.m_triggerHoldoff) {
-                    condition = false;
-                    triggerCondition.m_trues++;
-                } else {
-                    triggerCondition.m_falses = 0;
-                }
-            }
-            else
-            {
-                if (triggerCondition.m_falses < triggerCondition.m_triggerData.m_triggerHoldoff) {
-                    condition = true;
-                    triggerCondition.m_falses++;
-                } else {
-                    triggerCondition.m_trues = 0;
-                }
-            }
-
-            if (m_reset)
-            {
-                triggerCondition.m_prevCondition = condition;
-                m_reset = false;
-                return false;
-            }
-
-            if (triggerCondition.m_triggerData.m_triggerBothEdges) {
-                trigger = triggerCondition.m_prevCondition ? !condition : condition; // This is a XOR between bools
-            } else if (triggerCondition.m_triggerData.m_triggerPositiveEdge) {
-                trigger = !triggerCondition.m_prevCondition && condition;
-            } else {
-                trigger = triggerCondition.m_prevCondition && !condition;
-            }
-
-//            if (trigger) {
-//                qDebug("ScopeVis::triggered: %s/%s %f/%f",
-//                        triggerCondition.m_prevCondition ? "T" : "F",
-//                        condition ? "T" : "F",
-//                        triggerCondition.m_projector->run(s),
-//                        triggerCondition.m_triggerData.m_triggerLevel);
-//            }
-
-            triggerCondition.m_prevCondition = condition;
-            return trigger;
-        }
-
-        void reset()
-        {
-            m_reset = true;
-        }
-
-    private:
-        void computeLevels()
-        {
-            m_levelPowerLin = m_level + 1.0f;
-            m_levelPowerDB = (100.0f * (m_level - 1.0f));
-        }
-
-        Real m_level;
-        Real m_levelPowerDB;
-        Real m_levelPowerLin;
-        bool m_reset;
-    };
+    typedef ScopeTriggerComparator<TriggerCondition> TriggerComparator;
 
     GLScope* m_glScope;
     uint32_t m_preTriggerDelay;                    //!< Pre-trigger delay in number of samples
@@ -1157,6 +1100,9 @@ private:
     bool m_triggerOneShot;                         //!< True when one shot mode is active
     bool m_triggerWaitForReset;                    //!< In one shot mode suspended until reset by UI
     uint32_t m_currentTraceMemoryIndex;            //!< The current index of trace in memory (0: current)
+    uint32_t m_envelopeDecimation;                 //!< Samples per column of min/max envelope traces (1: full rate traces)
+    bool m_timeDisplay;                            //!< GLScope displays traces versus time so envelope traces can be used
+    static const uint32_t m_envelopeNbColumns = 2048; //!< Maximum number of envelope columns (at least the display width in pixels)
 
     /**
      * Moves on to the next trigger if any or increments trigger count if in repeat mode
@@ -1192,6 +1138,14 @@ private:
      */
     void initTraceBuffers();
 
+    /**
+     * Decide on envelope traces at the start of a trace
+     * - when the displayed part of the trace has many more samples than display columns the traces are
+     *   made of min/max pairs per column (GLScope draws them as vertical segments)
+     * - XY and polar displays pair the samples of traces so they always get full rate traces
+     */
+    void updateEnvelopeDecimation();
+
     /**
      * Calculate trigger levels on display
      * - every time a trigger condition focus changes TBD
@@ -55,6 +55,7 @@ GLScope::GLScope(QWidget *parent) : QGLWidget(parent),
     m_traceSize(0),
     m_traceModulo(0),
     m_timeBase(1),
+    m_envelopeDecimation(1),
     m_timeOffset(0),
     m_focusedTraceIndex(0),
     m_displayGridIntensity(10),
@@ -125,7 +126,7 @@ void GLScope::setTraces(std::vector<ScopeVis::TraceData> *tracesData, std::vecto
     m_traces = traces;
 }
 
-void GLScope::newTraces(std::vector<float *> *traces, int traceIndex, std::vector<Projector::ProjectionType> *projectionTypes)
+void GLScope::newTraces(std::vector<float *> *traces, int traceIndex, std::vector<Projector::ProjectionType> *projectionTypes, uint32_t envelopeDecimation)
 {
     if (traces->size() > 0)
     {
@@ -138,6 +139,7 @@ void GLScope::newTraces(std::vector<float *> *traces, int traceIndex, std::vecto
             m_processingTraceIndex.store(traceIndex);
             m_traces = &traces[traceIndex];
             m_projectionTypes = projectionTypes;
+            m_envelopeDecimation = envelopeDecimation;
         }
 
         m_mutex.unlock();
@@ -349,6 +351,8 @@ void GLScope::paintGL()
 
                 if (end - start < 2) {
                     start--;
+                } else if (m_envelopeDecimation > 1) { // min and max pair per column
+                    end = start + 2 * ((end - start + m_envelopeDecimation - 1) / m_envelopeDecimation);
                 }
 
                 float rectX = m_glScopeRect1.x();
@@ -428,6 +432,8 @@ void GLScope::paintGL()
 
             if (end - start < 2) {
                 start--;
+            } else if (m_envelopeDecimation > 1) { // min and max pair per column
+                end = start + 2 * ((end - start + m_envelopeDecimation - 1) / m_envelopeDecimation);
             }
 
             for (unsigned int i = 1; i < m_traces->size(); i++)
@@ -640,7 +646,7 @@ void GLScope::paintGL()
         }
 
         // paint all traces
-        if (m_traceSize > 0)
+        if ((m_traceSize > 0) && (m_envelopeDecimation == 1)) // XY pairs need full rate traces
         {
             int start = (m_timeOfsProMill / 1000.0) * m_traceSize;
             int end = std::min(start + m_traceSize / m_timeBase, m_traceSize);
@@ -737,7 +743,7 @@ void GLScope::paintGL()
 
         // paint polar traces
 
-        if (m_traceSize > 0)
+        if ((m_traceSize > 0) && (m_envelopeDecimation == 1)) // XY pairs need full rate traces
         {
             int start = (m_timeOfsProMill / 1000.0) * m_traceSize;
             int end = std::min(start + m_traceSize / m_timeBase, m_traceSize);
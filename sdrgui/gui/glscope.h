@@ -58,7 +58,7 @@ public:
     void disconnectTimer();
 
     void setTraces(std::vector<ScopeVis::TraceData>* tracesData, std::vector<float *>* traces);
-    void newTraces(std::vector<float *>* traces, int traceIndex, std::vector<Projector::ProjectionType>* projectionTypes);
+    void newTraces(std::vector<float *>* traces, int traceIndex, std::vector<Projector::ProjectionType>* projectionTypes, uint32_t envelopeDecimation = 1);
 
     int getSampleRate() const { return m_sampleRate; }
     int getTraceSize() const { return m_traceSize; }
@@ -156,6 +156,7 @@ private:
     int m_traceSize;
     int m_traceModulo; //!< ineffective if <2
     int m_timeBase;
+    uint32_t m_envelopeDecimation; //!< Samples per column of min/max pairs in the current traces (1: full rate traces)
     int m_timeOffset;
     uint32_t m_focusedTraceIndex;
 
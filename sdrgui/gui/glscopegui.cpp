@@ -84,6 +84,7 @@ void GLScopeGUI::setBuddies(MessageQueue* messageQueue, ScopeVis* scopeVis, GLSc
     ui->verticalXY->setEnabled(false);
     ui->polar->setEnabled(false);
     m_glScope->setDisplayMode(GLScope::DisplayX);
+    m_scopeVis->setTimeDisplay(true);
 
     // initialize trigger combo
     ui->trigPos->setChecked(true);
@@ -253,6 +254,7 @@ bool GLScopeGUI::deserialize(const QByteArray& data)
         ui->traceMode->setCurrentIndex(0);
         d.readS32(1, &intValue, (int) GLScope::DisplayX);
         m_glScope->setDisplayMode((GLScope::DisplayMode) intValue);
+        m_scopeVis->setTimeDisplay((m_glScope->getDisplayMode() == GLScope::DisplayX) || (m_glScope->getDisplayMode() == GLScope::DisplayY));
 
         ui->onlyX->setChecked(false);
         ui->onlyY->setChecked(false);
@@ -454,6 +456,7 @@ void GLScopeGUI::on_onlyX_toggled(bool checked)
         ui->verticalXY->setChecked(false);
         ui->polar->setChecked(false);
         m_glScope->setDisplayMode(GLScope::DisplayX);
+        m_scopeVis->setTimeDisplay(true);
     }
     else
     {
@@ -472,6 +475,7 @@ void GLScopeGUI::on_onlyY_toggled(bool checked)
         ui->verticalXY->setChecked(false);
         ui->polar->setChecked(false);
         m_glScope->setDisplayMode(GLScope::DisplayY);
+        m_scopeVis->setTimeDisplay(true);
     }
     else
     {
@@ -490,6 +494,7 @@ void GLScopeGUI::on_horizontalXY_toggled(bool checked)
         ui->verticalXY->setChecked(false);
         ui->polar->setChecked(false);
         m_glScope->setDisplayMode(GLScope::DisplayXYH);
+        m_scopeVis->setTimeDisplay(false);
     }
     else
     {
@@ -508,6 +513,7 @@ void GLScopeGUI::on_verticalXY_toggled(bool checked)
         ui->horizontalXY->setChecked(false);
         ui->polar->setChecked(false);
         m_glScope->setDisplayMode(GLScope::DisplayXYV);
+        m_scopeVis->setTimeDisplay(false);
     }
     else
     {
@@ -526,6 +532,7 @@ void GLScopeGUI::on_polar_toggled(bool checked)
         ui->horizontalXY->setChecked(false);
         ui->verticalXY->setChecked(false);
         m_glScope->setDisplayMode(GLScope::DisplayPol);
+        m_scopeVis->setTimeDisplay(false);
     }
     else
     {
@@ -644,6 +651,7 @@ void GLScopeGUI::on_traceDel_clicked(bool checked)
             ui->verticalXY->setEnabled(false);
             ui->polar->setEnabled(false);
             m_glScope->setDisplayMode(GLScope::DisplayX);
+            m_scopeVis->setTimeDisplay(true);
         }
 
         m_scopeVis->removeTrace(ui->trace->value());
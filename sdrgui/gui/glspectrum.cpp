@@ -16,16 +16,13 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
-#if 0 //def USE_SSE2
-#include <emmintrin.h>
-#endif
-
 #include <QMouseEvent>
 #include <QOpenGLShaderProgram>
 #include <QOpenGLFunctions>
 #include <QPainter>
 #include <QFontDatabase>
 #include "gui/glspectrum.h"
+#include "dsp/spectrumhistogram.h"
 #include "util/messagequeue.h"
 
 #include <QDebug>
@@ -53,7 +50,6 @@ GLSpectrum::GLSpectrum(QWidget* parent) :
 	m_displayTraceIntensity(50),
 	m_invertedWaterfall(false),
 	m_displayMaxHold(false),
-	m_currentSpectrum(nullptr),
 	m_displayCurrent(false),
     m_leftMargin(0),
     m_rightMargin(0),
@@ -71,13 +67,15 @@ GLSpectrum::GLSpectrum(QWidget* parent) :
     m_lsbDisplay(false),
     m_histogramBuffer(nullptr),
     m_histogram(nullptr),
+    m_histogramChanged(false),
     m_displayHistogram(true),
-    m_displayChanged(false),
     m_displaySourceOrSink(true),
     m_displayStreamIndex(0),
     m_matrixLoc(0),
     m_colorLoc(0),
-    m_messageQueueToGUI(nullptr)
+    m_messageQueueToGUI(nullptr),
+    m_frameQueue(m_waterfallBufferHeight), // up to a waterfall buffer of lines per paint (50 ms tick) as with direct updates
+    m_nbDroppedFrames(0)
 {
 	setAutoFillBackground(false);
 	setAttribute(Qt::WA_OpaquePaintEvent, true);
@@ -400,25 +398,35 @@ void GLSpectrum::removeChannelMarker(ChannelMarker* channelMarker)
 
 void GLSpectrum::newSpectrum(const std::vector<Real>& spectrum, int fftSize)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	// DSP thread: the frame is queued without locking the display. It is dropped if the GUI lags.
+	m_frameQueue.push(spectrum, fftSize);
+}
 
-	m_displayChanged = true;
+void GLSpectrum::processFrames()
+{
+	SpectrumFrameQueue::Frame *frame;
 
-	if (m_changesPending)
-    {
-		m_fftSize = fftSize;
-		return;
-	}
+	while ((frame = m_frameQueue.front()) != nullptr)
+	{
+		if (frame->m_fftSize != m_fftSize)
+		{
+			m_fftSize = frame->m_fftSize;
+			applyChanges();
+		}
 
-	if (fftSize != m_fftSize)
-    {
-		m_fftSize = fftSize;
-		m_changesPending = true;
-		return;
+		updateWaterfall(frame->m_spectrum);
+		updateHistogram(frame->m_spectrum);
+		m_currentSpectrum.swap(frame->m_spectrum); // keep the frame for the current spectrum line display without copy
+		m_frameQueue.pop();
 	}
 
-	updateWaterfall(spectrum);
-	updateHistogram(spectrum);
+	unsigned int nbDropped = m_frameQueue.getNbDropped();
+
+	if (nbDropped != m_nbDroppedFrames)
+	{
+		qWarning("GLSpectrum::processFrames: %u frames dropped (%u in total)", nbDropped - m_nbDroppedFrames, nbDropped);
+		m_nbDroppedFrames = nbDropped;
+	}
 }
 
 void GLSpectrum::updateWaterfall(const std::vector<Real>& spectrum)
@@ -426,135 +434,26 @@ void GLSpectrum::updateWaterfall(const std::vector<Real>& spectrum)
 	if (m_waterfallBufferPos < m_waterfallBuffer->height())
     {
 		quint32* pix = (quint32*)m_waterfallBuffer->scanLine(m_waterfallBufferPos);
-
-		for (int i = 0; i < m_fftSize; i++)
-        {
-			int v = (int)((spectrum[i] - m_referenceLevel) * 2.4 * 100.0 / m_powerRange + 240.0);
-
-            if (v > 239) {
-				v = 239;
-            } else if (v < 0) {
-				v = 0;
-            }
-
-			*pix++ = m_waterfallPalette[(int)v];
-		}
-
+		SpectrumHistogram::waterfallLine(spectrum.data(), pix, m_fftSize, m_referenceLevel, m_powerRange, m_waterfallPalette);
 		m_waterfallBufferPos++;
 	}
 }
 
 void GLSpectrum::updateHistogram(const std::vector<Real>& spectrum)
 {
-	quint8* b = m_histogram;
-	int fftMulSize = 100 * m_fftSize;
-
 	if ((m_displayHistogram || m_displayMaxHold) && (m_decay != 0))
 	{
 		m_decayDivisorCount--;
 
 		if ((m_decay > 1) || (m_decayDivisorCount <= 0))
 		{
-			for (int i = 0; i < fftMulSize; i++)
-			{
-				if (*b > m_decay) {
-					*b = *b - m_decay;
-				} else {
-				    *b = 0;
-				}
-
-				b++;
-			}
-
+			SpectrumHistogram::decay(m_histogram, SpectrumHistogram::m_nbLevels * m_fftSize, m_decay);
 			m_decayDivisorCount = m_decayDivisor;
 		}
 	}
 
-	m_currentSpectrum = &spectrum; // Store spectrum for current spectrum line display
-
-#if 0 //def USE_SSE2
-    if(m_decay >= 0) { // normal
-        const __m128 refl = {m_referenceLevel, m_referenceLevel, m_referenceLevel, m_referenceLevel};
-        const __m128 power = {m_powerRange, m_powerRange, m_powerRange, m_powerRange};
-        const __m128 mul = {100.0f, 100.0f, 100.0f, 100.0f};
-
-        for(int i = 0; i < m_fftSize; i += 4) {
-            __m128 abc = _mm_loadu_ps (&spectrum[i]);
-            abc = _mm_sub_ps(abc, refl);
-            abc = _mm_mul_ps(abc, mul);
-            abc = _mm_div_ps(abc, power);
-            abc =  _mm_add_ps(abc, mul);
-            __m128i result = _mm_cvtps_epi32(abc);
-
-            for(int j = 0; j < 4; j++) {
-                int v = ((int*)&result)[j];
-                if((v >= 0) && (v <= 99)) {
-                    b = m_histogram + (i + j) * 100 + v;
-                    if(*b < 220)
-                        *b += m_histogramStroke; // was 4
-                    else if(*b < 239)
-                        *b += 1;
-                }
-            }
-        }
-    } else { // draw double pixels
-        int add = -m_decay * 4;
-        const __m128 refl = {m_referenceLevel, m_referenceLevel, m_referenceLevel, m_referenceLevel};
-        const __m128 power = {m_powerRange, m_powerRange, m_powerRange, m_powerRange};
-        const __m128 mul = {100.0f, 100.0f, 100.0f, 100.0f};
-
-        for(int i = 0; i < m_fftSize; i += 4) {
-            __m128 abc = _mm_loadu_ps (&spectrum[i]);
-            abc = _mm_sub_ps(abc, refl);
-            abc = _mm_mul_ps(abc, mul);
-            abc = _mm_div_ps(abc, power);
-            abc =  _mm_add_ps(abc, mul);
-            __m128i result = _mm_cvtps_epi32(abc);
-
-            for(int j = 0; j < 4; j++) {
-                int v = ((int*)&result)[j];
-                if((v >= 1) && (v <= 98)) {
-                    b = m_histogram + (i + j) * 100 + v;
-                    if(b[-1] < 220)
-                        b[-1] += add;
-                    else if(b[-1] < 239)
-                        b[-1] += 1;
-                    if(b[0] < 220)
-                        b[0] += add;
-                    else if(b[0] < 239)
-                        b[0] += 1;
-                    if(b[1] < 220)
-                        b[1] += add;
-                    else if(b[1] < 239)
-                        b[1] += 1;
-                } else if((v >= 0) && (v <= 99)) {
-                    b = m_histogram + (i + j) * 100 + v;
-                    if(*b < 220)
-                        *b += add;
-                    else if(*b < 239)
-                        *b += 1;
-                }
-            }
-        }
-    }
-#else
-    for (int i = 0; i < m_fftSize; i++)
-    {
-        int v = (int)((spectrum[i] - m_referenceLevel) * 100.0 / m_powerRange + 100.0);
-
-        if ((v >= 0) && (v <= 99))
-        {
-            b = m_histogram + i * 100 + v;
-
-            // capping to 239 as palette values are [0..239]
-            if (*b + m_histogramStroke <= 239) {
-                *b += m_histogramStroke; // was 4
-            } else {
-                *b = 239;
-            }
-        }
-    }
-#endif
+	SpectrumHistogram::stroke(m_histogram, spectrum.data(), m_fftSize, m_referenceLevel, m_powerRange, m_histogramStroke);
+	m_histogramChanged = true;
 }
 
 void GLSpectrum::initializeGL()
@@ -608,6 +507,7 @@ void GLSpectrum::clearSpectrumHistogram()
 	}
 
 	memset(m_histogram, 0x00, 100 * m_fftSize);
+	m_histogramChanged = true;
 
 	m_mutex.unlock();
 	update();
@@ -625,6 +525,8 @@ void GLSpectrum::paintGL()
 		m_changesPending = false;
 	}
 
+	processFrames();
+
 	if (m_fftSize <= 0)
 	{
 		m_mutex.unlock();
@@ -647,21 +549,25 @@ void GLSpectrum::paintGL()
 		    };
 
 
-			if (m_waterfallTexturePos + m_waterfallBufferPos < m_waterfallTextureHeight)
-			{
-				m_glShaderWaterfall.subTexture(0, m_waterfallTexturePos, m_fftSize, m_waterfallBufferPos,  m_waterfallBuffer->scanLine(0));
-				m_waterfallTexturePos += m_waterfallBufferPos;
-			}
-			else
+			// only the new lines are uploaded
+			if (m_waterfallBufferPos > 0)
 			{
-				int breakLine = m_waterfallTextureHeight - m_waterfallTexturePos;
-				int linesLeft = m_waterfallTexturePos + m_waterfallBufferPos - m_waterfallTextureHeight;
-				m_glShaderWaterfall.subTexture(0, m_waterfallTexturePos, m_fftSize, breakLine,  m_waterfallBuffer->scanLine(0));
-				m_glShaderWaterfall.subTexture(0, 0, m_fftSize, linesLeft,  m_waterfallBuffer->scanLine(breakLine));
-				m_waterfallTexturePos = linesLeft;
-			}
+				if (m_waterfallTexturePos + m_waterfallBufferPos < m_waterfallTextureHeight)
+				{
+					m_glShaderWaterfall.subTexture(0, m_waterfallTexturePos, m_fftSize, m_waterfallBufferPos,  m_waterfallBuffer->scanLine(0));
+					m_waterfallTexturePos += m_waterfallBufferPos;
+				}
+				else
+				{
+					int breakLine = m_waterfallTextureHeight - m_waterfallTexturePos;
+					int linesLeft = m_waterfallTexturePos + m_waterfallBufferPos - m_waterfallTextureHeight;
+					m_glShaderWaterfall.subTexture(0, m_waterfallTexturePos, m_fftSize, breakLine,  m_waterfallBuffer->scanLine(0));
+					m_glShaderWaterfall.subTexture(0, 0, m_fftSize, linesLeft,  m_waterfallBuffer->scanLine(breakLine));
+					m_waterfallTexturePos = linesLeft;
+				}
 
-			m_waterfallBufferPos = 0;
+				m_waterfallBufferPos = 0;
+			}
 
 			float prop_y = m_waterfallTexturePos / (m_waterfallTextureHeight - 1.0);
 			float off = 1.0 / (m_waterfallTextureHeight - 1.0);
@@ -728,23 +634,12 @@ void GLSpectrum::paintGL()
 		if (m_displayHistogram)
 		{
 			{
-				// import new lines into the texture
-				quint32* pix;
-				quint8* bs = m_histogram;
-
-				for (int y = 0; y < 100; y++)
+				// rebuild the texture only if the histogram has changed since the last upload
+				if (m_histogramChanged)
 				{
-					quint8* b = bs;
-					pix = (quint32*)m_histogramBuffer->scanLine(99 - y);
-
-					for (int x = 0; x < m_fftSize; x++)
-					{
-						*pix = m_histogramPalette[*b];
-						pix++;
-						b += 100;
-					}
-
-					bs++;
+					SpectrumHistogram::colorize(m_histogram, (quint32*)m_histogramBuffer->scanLine(0), 100 * m_fftSize, m_histogramPalette);
+					m_glShaderHistogram.subTexture(0, 0, m_fftSize, 100,  m_histogramBuffer->scanLine(0));
+					m_histogramChanged = false;
 				}
 
 				GLfloat vtx1[] = {
@@ -760,7 +655,6 @@ void GLSpectrum::paintGL()
 			    		0, 1
 			    };
 
-				m_glShaderHistogram.subTexture(0, 0, m_fftSize, 100,  m_histogramBuffer->scanLine(0));
 				m_glShaderHistogram.drawSurface(m_glHistogramBoxMatrix, tex1, vtx1, 4);
 			}
 		}
@@ -898,25 +792,19 @@ void GLSpectrum::paintGL()
 	// paint max hold lines on top of histogram
 	if (m_displayMaxHold)
 	{
-		if (m_maxHold.size() < (uint) m_fftSize) {
+		if (m_maxHold.size() < (uint) m_fftSize)
+		{
 		    m_maxHold.resize(m_fftSize);
+		    m_maxHoldLevels.resize(m_fftSize);
 		}
 
+		SpectrumHistogram::maxLevels(m_histogram, m_maxHoldLevels.data(), m_fftSize);
+
 		for (int i = 0; i < m_fftSize; i++)
 		{
-			int j;
-			quint8* bs = m_histogram + i * 100;
-
-			for (j = 99; j >= 0; j--)
-			{
-				if (bs[j] > 0) {
-				    break;
-				}
-			}
-
 			// m_referenceLevel : top
 			// m_referenceLevel - m_powerRange : bottom
-			m_maxHold[i] = ((j - 99) * m_powerRange) / 99.0 + m_referenceLevel;
+			m_maxHold[i] = ((m_maxHoldLevels[i] - 99) * m_powerRange) / 99.0 + m_referenceLevel;
 		}
 		{
 		    GLfloat *q3 = m_q3FFT.m_array;
@@ -941,7 +829,7 @@ void GLSpectrum::paintGL()
 	}
 
 	// paint current spectrum line on top of histogram
-	if ((m_displayCurrent) && m_currentSpectrum)
+	if ((m_displayCurrent) && (m_currentSpectrum.size() == (unsigned int) m_fftSize))
 	{
 		{
 			Real bottom = -m_powerRange;
@@ -949,7 +837,7 @@ void GLSpectrum::paintGL()
 
 			for (int i = 0; i < m_fftSize; i++)
 			{
-				Real v = (*m_currentSpectrum)[i] - m_referenceLevel;
+				Real v = m_currentSpectrum[i] - m_referenceLevel;
 
 				if (v > 0) {
 				    v = 0;
@@ -1852,6 +1740,7 @@ void GLSpectrum::applyChanges()
 
 		m_histogram = new quint8[100 * m_fftSize];
 		memset(m_histogram, 0x00, 100 * m_fftSize);
+		m_histogramChanged = true;
 
 		m_q3FFT.allocate(2*m_fftSize);
 	}
@@ -2243,9 +2132,7 @@ void GLSpectrum::leaveEvent(QEvent* event)
 
 void GLSpectrum::tick()
 {
-	if (m_displayChanged)
-    {
-		m_displayChanged = false;
+	if (m_frameQueue.fill() > 0) {
 		update();
 	}
 }
@@ -29,6 +29,7 @@
 #include <QMatrix4x4>
 #include <QGLWidget>
 #include "dsp/glspectruminterface.h"
+#include "dsp/spectrumframequeue.h"
 #include "gui/scaleengine.h"
 #include "gui/glshadersimple.h"
 #include "gui/glshadertextured.h"
@@ -257,8 +258,9 @@ private:
 	bool m_invertedWaterfall;
 
 	std::vector<Real> m_maxHold;
+	std::vector<int> m_maxHoldLevels;
 	bool m_displayMaxHold;
-	const std::vector<Real> *m_currentSpectrum;
+	std::vector<Real> m_currentSpectrum; //!< last frame taken from the queue
 	bool m_displayCurrent;
 
 	Real m_waterfallShare;
@@ -294,14 +296,14 @@ private:
 
 	QRgb m_histogramPalette[240];
 	QImage* m_histogramBuffer;
-	quint8* m_histogram; //!< Spectrum phosphor matrix of FFT width and PSD height scaled to 100. values [0..239]
+	quint8* m_histogram; //!< Spectrum phosphor matrix of FFT width and PSD height scaled to 100. values [0..239]. Texture layout (see SpectrumHistogram)
+	bool m_histogramChanged; //!< the histogram texture is rebuilt only when set
 	int m_decayDivisor;
 	int m_decayDivisorCount;
 	int m_histogramStroke;
 	QMatrix4x4 m_glHistogramSpectrumMatrix;
 	QMatrix4x4 m_glHistogramBoxMatrix;
 	bool m_displayHistogram;
-	bool m_displayChanged;
     bool m_displaySourceOrSink;
     int m_displayStreamIndex;
 
@@ -319,9 +321,12 @@ private:
 	IncrementalArray<GLfloat> m_q3FFT;
 
 	MessageQueue *m_messageQueueToGUI;
+	SpectrumFrameQueue m_frameQueue; //!< spectrum frames from the DSP thread consumed when painting
+	unsigned int m_nbDroppedFrames;  //!< frames dropped by the queue already reported
 
 	static const int m_waterfallBufferHeight = 256;
 
+	void processFrames();
 	void updateWaterfall(const std::vector<Real>& spectrum);
 	void updateHistogram(const std::vector<Real>& spectrum);
 
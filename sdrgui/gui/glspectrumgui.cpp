@@ -26,6 +26,8 @@
 #include "dsp/fftwindow.h"
 #include "dsp/spectrumvis.h"
 #include "gui/glspectrum.h"
+#include "gui/crightclickenabler.h"
+#include "gui/waterfallhistorydialog.h"
 #include "util/simpleserializer.h"
 #include "ui_glspectrumgui.h"
 
@@ -52,6 +54,9 @@ GLSpectrumGUI::GLSpectrumGUI(QWidget* parent) :
     // ui->levelRange->findChild<QLineEdit*>()->setStyleSheet("color: white; background-color: rgb(79, 79, 79); border: 1px solid gray; border-radius: 4px;");
     // ui->levelRange->setStyleSheet("background-color: rgb(79, 79, 79);");
 
+    CRightClickEnabler *waterfallHistoryRightClickEnabler = new CRightClickEnabler(ui->waterfallHistory);
+    connect(waterfallHistoryRightClickEnabler, SIGNAL(rightClick(const QPoint &)), this, SLOT(openWaterfallHistoryDialog(const QPoint &)));
+
 	connect(&m_messageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
     displaySettings();
 	setAveragingCombo();
@@ -107,6 +112,7 @@ void GLSpectrumGUI::displaySettings()
 	ui->decayDivisor->setSliderPosition(m_settings.m_decayDivisor);
 	ui->stroke->setSliderPosition(m_settings.m_histogramStroke);
 	ui->waterfall->setChecked(m_settings.m_displayWaterfall);
+    ui->waterfallHistory->setChecked(m_settings.m_waterfallHistory);
 	ui->maxHold->setChecked(m_settings.m_displayMaxHold);
 	ui->current->setChecked(m_settings.m_displayCurrent);
 	ui->histogram->setChecked(m_settings.m_displayHistogram);
@@ -203,6 +209,11 @@ void GLSpectrumGUI::applySettings()
             (FFTWindow::Function) m_settings.m_fftWindow,
             m_settings.m_linear
 		);
+        m_spectrumVis->configureWaterfallHistory(
+            m_settings.m_waterfallHistory,
+            m_settings.m_waterfallHistoryMemoryMB,
+            m_settings.m_waterfallHistorySpillDirectory
+        );
     }
 }
 
@@ -288,6 +299,22 @@ void GLSpectrumGUI::on_waterfall_toggled(bool checked)
     applySettings();
 }
 
+void GLSpectrumGUI::on_waterfallHistory_toggled(bool checked)
+{
+    m_settings.m_waterfallHistory = checked;
+    applySettings();
+}
+
+void GLSpectrumGUI::openWaterfallHistoryDialog(const QPoint& p)
+{
+    WaterfallHistoryDialog dialog(m_settings.m_waterfallHistoryMemoryMB, m_settings.m_waterfallHistorySpillDirectory, this);
+    dialog.move(p);
+
+    if (dialog.exec() == QDialog::Accepted) {
+        applySettings();
+    }
+}
+
 void GLSpectrumGUI::on_histogram_toggled(bool checked)
 {
 	m_settings.m_displayHistogram = checked;
@@ -95,6 +95,7 @@ private slots:
     void on_linscale_toggled(bool checked);
 
 	void on_waterfall_toggled(bool checked);
+    void on_waterfallHistory_toggled(bool checked);
 	void on_histogram_toggled(bool checked);
 	void on_maxHold_toggled(bool checked);
 	void on_current_toggled(bool checked);
@@ -102,6 +103,7 @@ private slots:
 	void on_grid_toggled(bool checked);
 	void on_clearSpectrum_clicked(bool checked);
     void on_freeze_toggled(bool checked);
+    void openWaterfallHistoryDialog(const QPoint& p);
 
 	void handleInputMessages();
 };
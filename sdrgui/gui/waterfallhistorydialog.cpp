@@ -0,0 +1,67 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Waterfall history memory and spill directory settings                         //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QFileDialog>
+
+#include "waterfallhistorydialog.h"
+#include "ui_waterfallhistorydialog.h"
+
+WaterfallHistoryDialog::WaterfallHistoryDialog(int& memoryMB, QString& spillDirectory, QWidget* parent) :
+    QDialog(parent),
+    ui(new Ui::WaterfallHistoryDialog),
+    m_memoryMB(memoryMB),
+    m_spillDirectory(spillDirectory)
+{
+    ui->setupUi(this);
+    ui->memoryMB->setValue(m_memoryMB);
+    ui->spillDirectory->setText(m_spillDirectory);
+}
+
+WaterfallHistoryDialog::~WaterfallHistoryDialog()
+{
+    delete ui;
+}
+
+void WaterfallHistoryDialog::accept()
+{
+    m_memoryMB = ui->memoryMB->value();
+    m_spillDirectory = ui->spillDirectory->text();
+    QDialog::accept();
+}
+
+void WaterfallHistoryDialog::on_showDirectoryDialog_clicked(bool checked)
+{
+    (void) checked;
+    QString directory = QFileDialog::getExistingDirectory(this,
+        tr("Waterfall history spill directory"), ui->spillDirectory->text(),
+        QFileDialog::ShowDirsOnly | QFileDialog::DontUseNativeDialog);
+
+    if (directory != "")
+    {
+        qDebug("WaterfallHistoryDialog::on_showDirectoryDialog_clicked: selected: %s", qPrintable(directory));
+        ui->spillDirectory->setText(directory);
+    }
+}
+
+void WaterfallHistoryDialog::on_clearDirectory_clicked(bool checked)
+{
+    (void) checked;
+    ui->spillDirectory->clear();
+}
@@ -0,0 +1,50 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Waterfall history memory and spill directory settings                         //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRGUI_GUI_WATERFALLHISTORYDIALOG_H_
+#define SDRGUI_GUI_WATERFALLHISTORYDIALOG_H_
+
+#include <QDialog>
+
+#include "export.h"
+
+namespace Ui {
+    class WaterfallHistoryDialog;
+}
+
+class SDRGUI_API WaterfallHistoryDialog : public QDialog {
+    Q_OBJECT
+
+public:
+    explicit WaterfallHistoryDialog(int& memoryMB, QString& spillDirectory, QWidget* parent = nullptr);
+    ~WaterfallHistoryDialog();
+
+private:
+    Ui::WaterfallHistoryDialog* ui;
+    int& m_memoryMB;
+    QString& m_spillDirectory;
+
+private slots:
+    void accept();
+    void on_showDirectoryDialog_clicked(bool checked);
+    void on_clearDirectory_clicked(bool checked);
+};
+
+#endif /* SDRGUI_GUI_WATERFALLHISTORYDIALOG_H_ */
@@ -25,6 +25,13 @@
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
 #include "dsp/dspdevicemimoengine.h"
+#include "dsp/devicesamplesource.h"
+#include "dsp/basebandsamplesink.h"
+#include "dsp/samplesinkfifo.h"
+#include "dsp/dspmetrics.h"
+#include "dsp/spectrumvis.h"
+#include "dsp/glspectrumsettings.h"
+#include "channel/channelapi.h"
 #include "device/deviceapi.h"
 #include "device/deviceset.h"
 #include "device/deviceenumerator.h"
@@ -34,6 +41,9 @@
 #include "webapi/webapiserver.h"
 #include "webapi/webapiadapter.h"
 
+#include "SWGDeviceSettings.h"
+#include "SWGTestSourceSettings.h"
+
 #include "mainparser.h"
 #include "mainserver.h"
 
@@ -79,6 +89,15 @@ MainServer::MainServer(qtwebapp::LoggerWithFile *logger, const MainParser& parse
 
     m_dspEngine->setMIMOSupport(parser.getMIMOSupport());
 
+    m_benchChannel = parser.getBenchChannel();
+    m_benchNbChannels = parser.getBenchNbChannels();
+    m_benchDuration = parser.getBenchDuration();
+    m_benchSampleRate = parser.getBenchSampleRate();
+
+    if (!m_benchChannel.isEmpty()) {
+        QTimer::singleShot(0, this, SLOT(startBenchmark()));
+    }
+
     qDebug() << "MainServer::MainServer: end";
 }
 
@@ -273,6 +292,7 @@ void MainServer::addSinkDevice()
     DeviceAPI *deviceAPI = new DeviceAPI(DeviceAPI::StreamSingleTx, deviceTabIndex, nullptr, dspDeviceSinkEngine, nullptr);
 
     m_mainCore->m_deviceSets.back()->m_deviceAPI = deviceAPI;
+    dspDeviceSinkEngine->addSpectrumSink(m_mainCore->m_deviceSets.back()->m_spectrumVis);
     QList<QString> channelNames;
 
     // create a file sink by default
@@ -319,6 +339,7 @@ void MainServer::addSourceDevice()
     DeviceAPI *deviceAPI = new DeviceAPI(DeviceAPI::StreamSingleRx, deviceTabIndex, dspDeviceSourceEngine, nullptr, nullptr);
 
     m_mainCore->m_deviceSets.back()->m_deviceAPI = deviceAPI;
+    dspDeviceSourceEngine->addSink(m_mainCore->m_deviceSets.back()->m_spectrumVis);
 
     // Create a file source instance by default
     int fileSourceDeviceIndex = DeviceEnumerator::instance()->getFileInputDeviceIndex();
@@ -349,6 +370,7 @@ void MainServer::removeLastDevice()
     {
         DSPDeviceSourceEngine *lastDeviceEngine = m_mainCore->m_deviceSets.back()->m_deviceSourceEngine;
         lastDeviceEngine->stopAcquistion();
+        lastDeviceEngine->removeSink(m_mainCore->m_deviceSets.back()->m_spectrumVis);
 
         // deletes old UI and input object
         m_mainCore->m_deviceSets.back()->freeChannels();      // destroys the channel instances
@@ -369,6 +391,7 @@ void MainServer::removeLastDevice()
     {
         DSPDeviceSinkEngine *lastDeviceEngine = m_mainCore->m_deviceSets.back()->m_deviceSinkEngine;
         lastDeviceEngine->stopGeneration();
+        lastDeviceEngine->removeSpectrumSink(m_mainCore->m_deviceSets.back()->m_spectrumVis);
 
         // deletes old UI and output object
         m_mainCore->m_deviceSets.back()->freeChannels();
@@ -649,6 +672,15 @@ void MainServer::loadPresetSettings(const Preset* preset, int tabIndex)
         DeviceSet *deviceSet = m_mainCore->m_deviceSets[tabIndex];
         deviceSet->m_deviceAPI->loadSamplingDeviceSettings(preset);
 
+        // there is no spectrum display so only the waterfall history is applied
+        GLSpectrumSettings spectrumSettings;
+        spectrumSettings.deserialize(preset->getSpectrumConfig());
+        deviceSet->m_spectrumVis->configureWaterfallHistory(
+            spectrumSettings.m_waterfallHistory,
+            spectrumSettings.m_waterfallHistoryMemoryMB,
+            spectrumSettings.m_waterfallHistorySpillDirectory
+        );
+
         if (deviceSet->m_deviceSourceEngine) { // source device
         	deviceSet->loadRxChannelSettings(preset, m_mainCore->m_pluginManager->getPluginAPI());
         } else if (deviceSet->m_deviceSinkEngine) { // sink device
@@ -669,6 +701,15 @@ void MainServer::savePresetSettings(Preset* preset, int tabIndex)
     //int currentSourceTabIndex = ui->tabInputsView->currentIndex();
     DeviceSet *deviceSet = m_mainCore->m_deviceSets[tabIndex];
 
+    // only the waterfall history of the spectrum settings is live in the server
+    GLSpectrumSettings spectrumSettings;
+    spectrumSettings.deserialize(preset->getSpectrumConfig());
+    WaterfallHistory::Settings historySettings = deviceSet->m_spectrumVis->getWaterfallHistory().getSettings();
+    spectrumSettings.m_waterfallHistory = historySettings.m_enabled;
+    spectrumSettings.m_waterfallHistoryMemoryMB = historySettings.m_maxMemoryBytes / (1024*1024);
+    spectrumSettings.m_waterfallHistorySpillDirectory = historySettings.m_spillDirectory;
+    preset->setSpectrumConfig(spectrumSettings.serialize());
+
     if (deviceSet->m_deviceSourceEngine) // source device
     {
         preset->clearChannels();
@@ -718,3 +759,141 @@ void MainServer::saveFeatureSetPresetSettings(FeatureSetPreset* preset, int feat
     preset->clearFeatures();
     featureSet->saveFeatureSetSettings(preset);
 }
+
+void MainServer::startBenchmark()
+{
+    int deviceIndex = DeviceEnumerator::instance()->getRxSamplingDeviceIndex("sdrangel.samplesource.testsource", 0);
+
+    if (deviceIndex < 0)
+    {
+        qCritical("MainServer::startBenchmark: test source plugin not found");
+        emit finished();
+        return;
+    }
+
+    PluginAPI::ChannelRegistrations *channelRegistrations = m_mainCore->m_pluginManager->getPluginAPI()->getRxChannelRegistrations();
+    int channelIndex = -1;
+
+    for (int i = 0; i < channelRegistrations->size(); i++)
+    {
+        if ((channelRegistrations->at(i).m_channelId == m_benchChannel) || (channelRegistrations->at(i).m_channelIdURI == m_benchChannel))
+        {
+            channelIndex = i;
+            break;
+        }
+    }
+
+    if (channelIndex < 0)
+    {
+        qCritical("MainServer::startBenchmark: Rx channel %s not found", qPrintable(m_benchChannel));
+        emit finished();
+        return;
+    }
+
+    qInfo("MainServer::startBenchmark: %d %s channels on a %d S/s test source for %d s",
+        m_benchNbChannels, qPrintable(m_benchChannel), m_benchSampleRate, m_benchDuration);
+
+    DSPMetrics::setEnabled(true); // channel CPU load is the time spent processing the FIFO contents
+
+    addSourceDevice();
+    int deviceSetIndex = m_mainCore->m_deviceSets.size() - 1;
+    changeSampleSource(deviceSetIndex, deviceIndex);
+    DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+
+    SWGSDRangel::SWGDeviceSettings deviceSettings;
+    deviceSettings.setTestSourceSettings(new SWGSDRangel::SWGTestSourceSettings());
+    deviceSettings.getTestSourceSettings()->setSampleRate(m_benchSampleRate);
+    deviceSettings.getTestSourceSettings()->setLog2Decim(0);
+    QStringList deviceSettingsKeys;
+    deviceSettingsKeys << "sampleRate" << "log2Decim";
+    QString errorMessage;
+    deviceSet->m_deviceAPI->getSampleSource()->webapiSettingsPutPatch(false, deviceSettingsKeys, deviceSettings, errorMessage);
+
+    for (int i = 0; i < m_benchNbChannels; i++) {
+        addChannel(deviceSetIndex, channelIndex);
+    }
+
+    if (!deviceSet->m_deviceAPI->startDeviceEngine())
+    {
+        qCritical("MainServer::startBenchmark: cannot start device engine");
+        emit finished();
+        return;
+    }
+
+    // leave one second for the pipeline to settle before measuring
+    QTimer::singleShot(1000, this, SLOT(measureBenchmark()));
+}
+
+void MainServer::measureBenchmark()
+{
+    getBenchmarkFifoStats(m_mainCore->m_deviceSets.back(), m_benchStartStats);
+    m_benchCPUStart = std::clock();
+    m_benchTimer.start();
+    QTimer::singleShot(m_benchDuration * 1000, this, SLOT(stopBenchmark()));
+}
+
+void MainServer::stopBenchmark()
+{
+    DeviceSet *deviceSet = m_mainCore->m_deviceSets.back();
+    std::vector<SampleFifoStats> stats;
+    getBenchmarkFifoStats(deviceSet, stats);
+    double elapsed = m_benchTimer.nsecsElapsed() / 1e9;
+    double cpu = (std::clock() - m_benchCPUStart) / (double) CLOCKS_PER_SEC; // all threads of the process
+    quint64 totalDropped = 0;
+
+    deviceSet->m_deviceAPI->stopDeviceEngine();
+
+    qInfo("MainServer::stopBenchmark: %d %s channels on a %d S/s test source for %.1f s",
+        m_benchNbChannels, qPrintable(m_benchChannel), m_benchSampleRate, elapsed);
+
+    for (unsigned int i = 0; (i < stats.size()) && (i < m_benchStartStats.size()); i++)
+    {
+        const SampleFifoStats& start = m_benchStartStats[i];
+        const SampleFifoStats& end = stats[i];
+        QString name = i < stats.size() - 1 ? QString("channel %1").arg(i) : QString("device");
+
+        if (end.m_size == 0)
+        {
+            qInfo("MainServer::stopBenchmark: %s: no FIFO statistics", qPrintable(name));
+            continue;
+        }
+
+        quint64 written = end.m_nbWritten - start.m_nbWritten;
+        quint64 dropped = end.m_nbDropped - start.m_nbDropped;
+        double busy = (end.m_readNsecs - start.m_readNsecs) / 1e9;
+        totalDropped += dropped;
+
+        qInfo("MainServer::stopBenchmark: %s: samples: %llu dropped: %llu (%.3f%%) FIFO high water: %u/%u (%.1f%%) CPU: %.1f%%",
+            qPrintable(name),
+            written,
+            dropped,
+            written + dropped == 0 ? 0.0 : (100.0 * dropped) / (written + dropped),
+            end.m_highWaterMark,
+            end.m_size,
+            (100.0 * end.m_highWaterMark) / end.m_size,
+            (100.0 * busy) / elapsed);
+    }
+
+    qInfo("MainServer::stopBenchmark: process CPU: %.1f%% dropped samples: %llu: %s",
+        (100.0 * cpu) / elapsed,
+        totalDropped,
+        totalDropped == 0 ? "sustained" : "NOT sustained");
+
+    emit finished();
+}
+
+void MainServer::getBenchmarkFifoStats(DeviceSet *deviceSet, std::vector<SampleFifoStats>& stats)
+{
+    stats.assign(deviceSet->getNumberOfChannels() + 1, SampleFifoStats());
+
+    for (int i = 0; i < deviceSet->getNumberOfChannels(); i++)
+    {
+        BasebandSampleSink *sink = dynamic_cast<BasebandSampleSink*>(deviceSet->getChannelAt(i));
+
+        if (sink) {
+            sink->getFifoStats(stats[i]);
+        }
+    }
+
+    deviceSet->m_deviceAPI->getSampleSource()->getSampleFifo()->getStats(stats.back());
+}
@@ -22,8 +22,13 @@
 
 #include <QObject>
 #include <QTimer>
+#include <QElapsedTimer>
+
+#include <ctime>
+#include <vector>
 
 #include "maincore.h"
+#include "dsp/samplefifostats.h"
 #include "settings/mainsettings.h"
 #include "util/messagequeue.h"
 #include "export.h"
@@ -88,6 +93,14 @@ private:
     WebAPIServer *m_apiServer;
     WebAPIAdapter *m_apiAdapter;
 
+    QString m_benchChannel;       //!< channel type of the pipeline benchmark. Empty if no benchmark.
+    int m_benchNbChannels;
+    int m_benchDuration;          //!< seconds
+    int m_benchSampleRate;
+    QElapsedTimer m_benchTimer;
+    std::clock_t m_benchCPUStart;
+    std::vector<SampleFifoStats> m_benchStartStats; //!< FIFO statistics of the channels then the device at measurement start
+
 	void loadSettings();
     void applySettings();
 	void loadPresetSettings(const Preset* preset, int tabIndex);
@@ -96,9 +109,13 @@ private:
 	void saveFeatureSetPresetSettings(FeatureSetPreset* preset, int featureSetIndex);
 
     bool handleMessage(const Message& cmd);
+    void getBenchmarkFifoStats(DeviceSet *deviceSet, std::vector<SampleFifoStats>& stats);
 
 private slots:
     void handleMessages();
+    void startBenchmark();
+    void measureBenchmark();
+    void stopBenchmark();
 };
 
 
@@ -0,0 +1,227 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGChannelMetrics.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGChannelMetrics::SWGChannelMetrics(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGChannelMetrics::SWGChannelMetrics() {
+    index = 0;
+    m_index_isSet = false;
+    channel_type = nullptr;
+    m_channel_type_isSet = false;
+    fifo = nullptr;
+    m_fifo_isSet = false;
+    message_queue_depth = 0;
+    m_message_queue_depth_isSet = false;
+    message_queue_high_water_mark = 0;
+    m_message_queue_high_water_mark_isSet = false;
+    squelch = 0;
+    m_squelch_isSet = false;
+}
+
+SWGChannelMetrics::~SWGChannelMetrics() {
+    this->cleanup();
+}
+
+void
+SWGChannelMetrics::init() {
+    index = 0;
+    m_index_isSet = false;
+    channel_type = new QString("");
+    m_channel_type_isSet = false;
+    fifo = new SWGFifoMetrics();
+    m_fifo_isSet = false;
+    message_queue_depth = 0;
+    m_message_queue_depth_isSet = false;
+    message_queue_high_water_mark = 0;
+    m_message_queue_high_water_mark_isSet = false;
+    squelch = 0;
+    m_squelch_isSet = false;
+}
+
+void
+SWGChannelMetrics::cleanup() {
+
+    if(channel_type != nullptr) { 
+        delete channel_type;
+    }
+    if(fifo != nullptr) { 
+        delete fifo;
+    }
+
+
+
+}
+
+SWGChannelMetrics*
+SWGChannelMetrics::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGChannelMetrics::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&index, pJson["index"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&channel_type, pJson["channelType"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&fifo, pJson["fifo"], "SWGFifoMetrics", "SWGFifoMetrics");
+    
+    ::SWGSDRangel::setValue(&message_queue_depth, pJson["messageQueueDepth"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&message_queue_high_water_mark, pJson["messageQueueHighWaterMark"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&squelch, pJson["squelch"], "qint32", "");
+    
+}
+
+QString
+SWGChannelMetrics::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGChannelMetrics::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_index_isSet){
+        obj->insert("index", QJsonValue(index));
+    }
+    if(channel_type != nullptr && *channel_type != QString("")){
+        toJsonValue(QString("channelType"), channel_type, obj, QString("QString"));
+    }
+    if((fifo != nullptr) && (fifo->isSet())){
+        toJsonValue(QString("fifo"), fifo, obj, QString("SWGFifoMetrics"));
+    }
+    if(m_message_queue_depth_isSet){
+        obj->insert("messageQueueDepth", QJsonValue(message_queue_depth));
+    }
+    if(m_message_queue_high_water_mark_isSet){
+        obj->insert("messageQueueHighWaterMark", QJsonValue(message_queue_high_water_mark));
+    }
+    if(m_squelch_isSet){
+        obj->insert("squelch", QJsonValue(squelch));
+    }
+
+    return obj;
+}
+
+qint32
+SWGChannelMetrics::getIndex() {
+    return index;
+}
+void
+SWGChannelMetrics::setIndex(qint32 index) {
+    this->index = index;
+    this->m_index_isSet = true;
+}
+
+QString*
+SWGChannelMetrics::getChannelType() {
+    return channel_type;
+}
+void
+SWGChannelMetrics::setChannelType(QString* channel_type) {
+    this->channel_type = channel_type;
+    this->m_channel_type_isSet = true;
+}
+
+SWGFifoMetrics*
+SWGChannelMetrics::getFifo() {
+    return fifo;
+}
+void
+SWGChannelMetrics::setFifo(SWGFifoMetrics* fifo) {
+    this->fifo = fifo;
+    this->m_fifo_isSet = true;
+}
+
+qint32
+SWGChannelMetrics::getMessageQueueDepth() {
+    return message_queue_depth;
+}
+void
+SWGChannelMetrics::setMessageQueueDepth(qint32 message_queue_depth) {
+    this->message_queue_depth = message_queue_depth;
+    this->m_message_queue_depth_isSet = true;
+}
+
+qint32
+SWGChannelMetrics::getMessageQueueHighWaterMark() {
+    return message_queue_high_water_mark;
+}
+void
+SWGChannelMetrics::setMessageQueueHighWaterMark(qint32 message_queue_high_water_mark) {
+    this->message_queue_high_water_mark = message_queue_high_water_mark;
+    this->m_message_queue_high_water_mark_isSet = true;
+}
+
+qint32
+SWGChannelMetrics::getSquelch() {
+    return squelch;
+}
+void
+SWGChannelMetrics::setSquelch(qint32 squelch) {
+    this->squelch = squelch;
+    this->m_squelch_isSet = true;
+}
+
+
+bool
+SWGChannelMetrics::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(channel_type && *channel_type != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(fifo && fifo->isSet()){
+            isObjectUpdated = true; break;
+        }
+        if(m_message_queue_depth_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_message_queue_high_water_mark_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_squelch_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
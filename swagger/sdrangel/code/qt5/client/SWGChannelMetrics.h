@@ -0,0 +1,90 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGChannelMetrics.h
+ *
+ * Processing metrics of a channel
+ */
+
+#ifndef SWGChannelMetrics_H_
+#define SWGChannelMetrics_H_
+
+#include <QJsonObject>
+
+
+#include "SWGFifoMetrics.h"
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGChannelMetrics: public SWGObject {
+public:
+    SWGChannelMetrics();
+    SWGChannelMetrics(QString* json);
+    virtual ~SWGChannelMetrics();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGChannelMetrics* fromJson(QString &jsonString) override;
+
+    qint32 getIndex();
+    void setIndex(qint32 index);
+
+    QString* getChannelType();
+    void setChannelType(QString* channel_type);
+
+    SWGFifoMetrics* getFifo();
+    void setFifo(SWGFifoMetrics* fifo);
+
+    qint32 getMessageQueueDepth();
+    void setMessageQueueDepth(qint32 message_queue_depth);
+
+    qint32 getMessageQueueHighWaterMark();
+    void setMessageQueueHighWaterMark(qint32 message_queue_high_water_mark);
+
+    qint32 getSquelch();
+    void setSquelch(qint32 squelch);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 index;
+    bool m_index_isSet;
+
+    QString* channel_type;
+    bool m_channel_type_isSet;
+
+    SWGFifoMetrics* fifo;
+    bool m_fifo_isSet;
+
+    qint32 message_queue_depth;
+    bool m_message_queue_depth_isSet;
+
+    qint32 message_queue_high_water_mark;
+    bool m_message_queue_high_water_mark_isSet;
+
+    qint32 squelch;
+    bool m_squelch_isSet;
+
+};
+
+}
+
+#endif /* SWGChannelMetrics_H_ */
@@ -0,0 +1,231 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGDeviceSetMetrics.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGDeviceSetMetrics::SWGDeviceSetMetrics(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGDeviceSetMetrics::SWGDeviceSetMetrics() {
+    metrics_enabled = 0;
+    m_metrics_enabled_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    device_fifo = nullptr;
+    m_device_fifo_isSet = false;
+    message_queue_depth = 0;
+    m_message_queue_depth_isSet = false;
+    message_queue_high_water_mark = 0;
+    m_message_queue_high_water_mark_isSet = false;
+    channels = nullptr;
+    m_channels_isSet = false;
+}
+
+SWGDeviceSetMetrics::~SWGDeviceSetMetrics() {
+    this->cleanup();
+}
+
+void
+SWGDeviceSetMetrics::init() {
+    metrics_enabled = 0;
+    m_metrics_enabled_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    device_fifo = new SWGFifoMetrics();
+    m_device_fifo_isSet = false;
+    message_queue_depth = 0;
+    m_message_queue_depth_isSet = false;
+    message_queue_high_water_mark = 0;
+    m_message_queue_high_water_mark_isSet = false;
+    channels = new QList<SWGChannelMetrics*>();
+    m_channels_isSet = false;
+}
+
+void
+SWGDeviceSetMetrics::cleanup() {
+
+
+    if(device_fifo != nullptr) { 
+        delete device_fifo;
+    }
+
+
+    if(channels != nullptr) { 
+        auto arr = channels;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete channels;
+    }
+}
+
+SWGDeviceSetMetrics*
+SWGDeviceSetMetrics::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGDeviceSetMetrics::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&metrics_enabled, pJson["metricsEnabled"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&sample_rate, pJson["sampleRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&device_fifo, pJson["deviceFifo"], "SWGFifoMetrics", "SWGFifoMetrics");
+    
+    ::SWGSDRangel::setValue(&message_queue_depth, pJson["messageQueueDepth"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&message_queue_high_water_mark, pJson["messageQueueHighWaterMark"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&channels, pJson["channels"], "QList", "SWGChannelMetrics");
+}
+
+QString
+SWGDeviceSetMetrics::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGDeviceSetMetrics::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_metrics_enabled_isSet){
+        obj->insert("metricsEnabled", QJsonValue(metrics_enabled));
+    }
+    if(m_sample_rate_isSet){
+        obj->insert("sampleRate", QJsonValue(sample_rate));
+    }
+    if((device_fifo != nullptr) && (device_fifo->isSet())){
+        toJsonValue(QString("deviceFifo"), device_fifo, obj, QString("SWGFifoMetrics"));
+    }
+    if(m_message_queue_depth_isSet){
+        obj->insert("messageQueueDepth", QJsonValue(message_queue_depth));
+    }
+    if(m_message_queue_high_water_mark_isSet){
+        obj->insert("messageQueueHighWaterMark", QJsonValue(message_queue_high_water_mark));
+    }
+    if(channels && channels->size() > 0){
+        toJsonArray((QList<void*>*)channels, obj, "channels", "SWGChannelMetrics");
+    }
+
+    return obj;
+}
+
+qint32
+SWGDeviceSetMetrics::getMetricsEnabled() {
+    return metrics_enabled;
+}
+void
+SWGDeviceSetMetrics::setMetricsEnabled(qint32 metrics_enabled) {
+    this->metrics_enabled = metrics_enabled;
+    this->m_metrics_enabled_isSet = true;
+}
+
+qint32
+SWGDeviceSetMetrics::getSampleRate() {
+    return sample_rate;
+}
+void
+SWGDeviceSetMetrics::setSampleRate(qint32 sample_rate) {
+    this->sample_rate = sample_rate;
+    this->m_sample_rate_isSet = true;
+}
+
+SWGFifoMetrics*
+SWGDeviceSetMetrics::getDeviceFifo() {
+    return device_fifo;
+}
+void
+SWGDeviceSetMetrics::setDeviceFifo(SWGFifoMetrics* device_fifo) {
+    this->device_fifo = device_fifo;
+    this->m_device_fifo_isSet = true;
+}
+
+qint32
+SWGDeviceSetMetrics::getMessageQueueDepth() {
+    return message_queue_depth;
+}
+void
+SWGDeviceSetMetrics::setMessageQueueDepth(qint32 message_queue_depth) {
+    this->message_queue_depth = message_queue_depth;
+    this->m_message_queue_depth_isSet = true;
+}
+
+qint32
+SWGDeviceSetMetrics::getMessageQueueHighWaterMark() {
+    return message_queue_high_water_mark;
+}
+void
+SWGDeviceSetMetrics::setMessageQueueHighWaterMark(qint32 message_queue_high_water_mark) {
+    this->message_queue_high_water_mark = message_queue_high_water_mark;
+    this->m_message_queue_high_water_mark_isSet = true;
+}
+
+QList<SWGChannelMetrics*>*
+SWGDeviceSetMetrics::getChannels() {
+    return channels;
+}
+void
+SWGDeviceSetMetrics::setChannels(QList<SWGChannelMetrics*>* channels) {
+    this->channels = channels;
+    this->m_channels_isSet = true;
+}
+
+
+bool
+SWGDeviceSetMetrics::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_metrics_enabled_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_sample_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(device_fifo && device_fifo->isSet()){
+            isObjectUpdated = true; break;
+        }
+        if(m_message_queue_depth_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_message_queue_high_water_mark_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(channels && (channels->size() > 0)){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,91 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGDeviceSetMetrics.h
+ *
+ * Processing metrics of a device set and its channels
+ */
+
+#ifndef SWGDeviceSetMetrics_H_
+#define SWGDeviceSetMetrics_H_
+
+#include <QJsonObject>
+
+
+#include "SWGChannelMetrics.h"
+#include "SWGFifoMetrics.h"
+#include <QList>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGDeviceSetMetrics: public SWGObject {
+public:
+    SWGDeviceSetMetrics();
+    SWGDeviceSetMetrics(QString* json);
+    virtual ~SWGDeviceSetMetrics();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGDeviceSetMetrics* fromJson(QString &jsonString) override;
+
+    qint32 getMetricsEnabled();
+    void setMetricsEnabled(qint32 metrics_enabled);
+
+    qint32 getSampleRate();
+    void setSampleRate(qint32 sample_rate);
+
+    SWGFifoMetrics* getDeviceFifo();
+    void setDeviceFifo(SWGFifoMetrics* device_fifo);
+
+    qint32 getMessageQueueDepth();
+    void setMessageQueueDepth(qint32 message_queue_depth);
+
+    qint32 getMessageQueueHighWaterMark();
+    void setMessageQueueHighWaterMark(qint32 message_queue_high_water_mark);
+
+    QList<SWGChannelMetrics*>* getChannels();
+    void setChannels(QList<SWGChannelMetrics*>* channels);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 metrics_enabled;
+    bool m_metrics_enabled_isSet;
+
+    qint32 sample_rate;
+    bool m_sample_rate_isSet;
+
+    SWGFifoMetrics* device_fifo;
+    bool m_device_fifo_isSet;
+
+    qint32 message_queue_depth;
+    bool m_message_queue_depth_isSet;
+
+    qint32 message_queue_high_water_mark;
+    bool m_message_queue_high_water_mark_isSet;
+
+    QList<SWGChannelMetrics*>* channels;
+    bool m_channels_isSet;
+
+};
+
+}
+
+#endif /* SWGDeviceSetMetrics_H_ */
@@ -0,0 +1,269 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGFifoMetrics.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGFifoMetrics::SWGFifoMetrics(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGFifoMetrics::SWGFifoMetrics() {
+    size = 0;
+    m_size_isSet = false;
+    fill = 0;
+    m_fill_isSet = false;
+    high_water_mark = 0;
+    m_high_water_mark_isSet = false;
+    nb_written = 0L;
+    m_nb_written_isSet = false;
+    nb_dropped = 0L;
+    m_nb_dropped_isSet = false;
+    nb_overflows = 0L;
+    m_nb_overflows_isSet = false;
+    nb_read = 0L;
+    m_nb_read_isSet = false;
+    processing_time = 0L;
+    m_processing_time_isSet = false;
+}
+
+SWGFifoMetrics::~SWGFifoMetrics() {
+    this->cleanup();
+}
+
+void
+SWGFifoMetrics::init() {
+    size = 0;
+    m_size_isSet = false;
+    fill = 0;
+    m_fill_isSet = false;
+    high_water_mark = 0;
+    m_high_water_mark_isSet = false;
+    nb_written = 0L;
+    m_nb_written_isSet = false;
+    nb_dropped = 0L;
+    m_nb_dropped_isSet = false;
+    nb_overflows = 0L;
+    m_nb_overflows_isSet = false;
+    nb_read = 0L;
+    m_nb_read_isSet = false;
+    processing_time = 0L;
+    m_processing_time_isSet = false;
+}
+
+void
+SWGFifoMetrics::cleanup() {
+
+
+
+
+
+
+
+
+}
+
+SWGFifoMetrics*
+SWGFifoMetrics::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGFifoMetrics::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&size, pJson["size"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fill, pJson["fill"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&high_water_mark, pJson["highWaterMark"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nb_written, pJson["nbWritten"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&nb_dropped, pJson["nbDropped"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&nb_overflows, pJson["nbOverflows"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&nb_read, pJson["nbRead"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&processing_time, pJson["processingTime"], "qint64", "");
+    
+}
+
+QString
+SWGFifoMetrics::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGFifoMetrics::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_size_isSet){
+        obj->insert("size", QJsonValue(size));
+    }
+    if(m_fill_isSet){
+        obj->insert("fill", QJsonValue(fill));
+    }
+    if(m_high_water_mark_isSet){
+        obj->insert("highWaterMark", QJsonValue(high_water_mark));
+    }
+    if(m_nb_written_isSet){
+        obj->insert("nbWritten", QJsonValue(nb_written));
+    }
+    if(m_nb_dropped_isSet){
+        obj->insert("nbDropped", QJsonValue(nb_dropped));
+    }
+    if(m_nb_overflows_isSet){
+        obj->insert("nbOverflows", QJsonValue(nb_overflows));
+    }
+    if(m_nb_read_isSet){
+        obj->insert("nbRead", QJsonValue(nb_read));
+    }
+    if(m_processing_time_isSet){
+        obj->insert("processingTime", QJsonValue(processing_time));
+    }
+
+    return obj;
+}
+
+qint32
+SWGFifoMetrics::getSize() {
+    return size;
+}
+void
+SWGFifoMetrics::setSize(qint32 size) {
+    this->size = size;
+    this->m_size_isSet = true;
+}
+
+qint32
+SWGFifoMetrics::getFill() {
+    return fill;
+}
+void
+SWGFifoMetrics::setFill(qint32 fill) {
+    this->fill = fill;
+    this->m_fill_isSet = true;
+}
+
+qint32
+SWGFifoMetrics::getHighWaterMark() {
+    return high_water_mark;
+}
+void
+SWGFifoMetrics::setHighWaterMark(qint32 high_water_mark) {
+    this->high_water_mark = high_water_mark;
+    this->m_high_water_mark_isSet = true;
+}
+
+qint64
+SWGFifoMetrics::getNbWritten() {
+    return nb_written;
+}
+void
+SWGFifoMetrics::setNbWritten(qint64 nb_written) {
+    this->nb_written = nb_written;
+    this->m_nb_written_isSet = true;
+}
+
+qint64
+SWGFifoMetrics::getNbDropped() {
+    return nb_dropped;
+}
+void
+SWGFifoMetrics::setNbDropped(qint64 nb_dropped) {
+    this->nb_dropped = nb_dropped;
+    this->m_nb_dropped_isSet = true;
+}
+
+qint64
+SWGFifoMetrics::getNbOverflows() {
+    return nb_overflows;
+}
+void
+SWGFifoMetrics::setNbOverflows(qint64 nb_overflows) {
+    this->nb_overflows = nb_overflows;
+    this->m_nb_overflows_isSet = true;
+}
+
+qint64
+SWGFifoMetrics::getNbRead() {
+    return nb_read;
+}
+void
+SWGFifoMetrics::setNbRead(qint64 nb_read) {
+    this->nb_read = nb_read;
+    this->m_nb_read_isSet = true;
+}
+
+qint64
+SWGFifoMetrics::getProcessingTime() {
+    return processing_time;
+}
+void
+SWGFifoMetrics::setProcessingTime(qint64 processing_time) {
+    this->processing_time = processing_time;
+    this->m_processing_time_isSet = true;
+}
+
+
+bool
+SWGFifoMetrics::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_size_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fill_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_high_water_mark_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_nb_written_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_nb_dropped_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_nb_overflows_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_nb_read_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_processing_time_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,100 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGFifoMetrics.h
+ *
+ * Sample FIFO counters. Counters are cumulative since the FIFO was sized or its reader was attached
+ */
+
+#ifndef SWGFifoMetrics_H_
+#define SWGFifoMetrics_H_
+
+#include <QJsonObject>
+
+
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGFifoMetrics: public SWGObject {
+public:
+    SWGFifoMetrics();
+    SWGFifoMetrics(QString* json);
+    virtual ~SWGFifoMetrics();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGFifoMetrics* fromJson(QString &jsonString) override;
+
+    qint32 getSize();
+    void setSize(qint32 size);
+
+    qint32 getFill();
+    void setFill(qint32 fill);
+
+    qint32 getHighWaterMark();
+    void setHighWaterMark(qint32 high_water_mark);
+
+    qint64 getNbWritten();
+    void setNbWritten(qint64 nb_written);
+
+    qint64 getNbDropped();
+    void setNbDropped(qint64 nb_dropped);
+
+    qint64 getNbOverflows();
+    void setNbOverflows(qint64 nb_overflows);
+
+    qint64 getNbRead();
+    void setNbRead(qint64 nb_read);
+
+    qint64 getProcessingTime();
+    void setProcessingTime(qint64 processing_time);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 size;
+    bool m_size_isSet;
+
+    qint32 fill;
+    bool m_fill_isSet;
+
+    qint32 high_water_mark;
+    bool m_high_water_mark_isSet;
+
+    qint64 nb_written;
+    bool m_nb_written_isSet;
+
+    qint64 nb_dropped;
+    bool m_nb_dropped_isSet;
+
+    qint64 nb_overflows;
+    bool m_nb_overflows_isSet;
+
+    qint64 nb_read;
+    bool m_nb_read_isSet;
+
+    qint64 processing_time;
+    bool m_processing_time_isSet;
+
+};
+
+}
+
+#endif /* SWGFifoMetrics_H_ */
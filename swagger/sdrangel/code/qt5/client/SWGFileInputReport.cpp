@@ -34,6 +34,8 @@ SWGFileInputReport::SWGFileInputReport() {
     m_sample_rate_isSet = false;
     sample_size = 0;
     m_sample_size_isSet = false;
+    speed_factor = 0.0f;
+    m_speed_factor_isSet = false;
     absolute_time = nullptr;
     m_absolute_time_isSet = false;
     elapsed_time = nullptr;
@@ -54,6 +56,8 @@ SWGFileInputReport::init() {
     m_sample_rate_isSet = false;
     sample_size = 0;
     m_sample_size_isSet = false;
+    speed_factor = 0.0f;
+    m_speed_factor_isSet = false;
     absolute_time = new QString("");
     m_absolute_time_isSet = false;
     elapsed_time = new QString("");
@@ -97,6 +101,8 @@ SWGFileInputReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&sample_size, pJson["sampleSize"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&speed_factor, pJson["speedFactor"], "float", "");
+    
     ::SWGSDRangel::setValue(&absolute_time, pJson["absoluteTime"], "QString", "QString");
     
     ::SWGSDRangel::setValue(&elapsed_time, pJson["elapsedTime"], "QString", "QString");
@@ -128,6 +134,9 @@ SWGFileInputReport::asJsonObject() {
     if(m_sample_size_isSet){
         obj->insert("sampleSize", QJsonValue(sample_size));
     }
+    if(m_speed_factor_isSet){
+        obj->insert("speedFactor", QJsonValue(speed_factor));
+    }
     if(absolute_time != nullptr && *absolute_time != QString("")){
         toJsonValue(QString("absoluteTime"), absolute_time, obj, QString("QString"));
     }
@@ -171,6 +180,16 @@ SWGFileInputReport::setSampleSize(qint32 sample_size) {
     this->m_sample_size_isSet = true;
 }
 
+float
+SWGFileInputReport::getSpeedFactor() {
+    return speed_factor;
+}
+void
+SWGFileInputReport::setSpeedFactor(float speed_factor) {
+    this->speed_factor = speed_factor;
+    this->m_speed_factor_isSet = true;
+}
+
 QString*
 SWGFileInputReport::getAbsoluteTime() {
     return absolute_time;
@@ -215,6 +234,9 @@ SWGFileInputReport::isSet(){
         if(m_sample_size_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_speed_factor_isSet){
+            isObjectUpdated = true; break;
+        }
         if(absolute_time && *absolute_time != QString("")){
             isObjectUpdated = true; break;
         }
@@ -51,6 +51,9 @@ public:
     qint32 getSampleSize();
     void setSampleSize(qint32 sample_size);
 
+    float getSpeedFactor();
+    void setSpeedFactor(float speed_factor);
+
     QString* getAbsoluteTime();
     void setAbsoluteTime(QString* absolute_time);
 
@@ -73,6 +76,9 @@ private:
     qint32 sample_size;
     bool m_sample_size_isSet;
 
+    float speed_factor;
+    bool m_speed_factor_isSet;
+
     QString* absolute_time;
     bool m_absolute_time_isSet;
 
@@ -30,6 +30,8 @@ SWGFileSinkActions::SWGFileSinkActions(QString* json) {
 SWGFileSinkActions::SWGFileSinkActions() {
     record = 0;
     m_record_isSet = false;
+    trigger = 0;
+    m_trigger_isSet = false;
 }
 
 SWGFileSinkActions::~SWGFileSinkActions() {
@@ -40,6 +42,8 @@ void
 SWGFileSinkActions::init() {
     record = 0;
     m_record_isSet = false;
+    trigger = 0;
+    m_trigger_isSet = false;
 }
 
 void
@@ -60,6 +64,8 @@ void
 SWGFileSinkActions::fromJsonObject(QJsonObject &pJson) {
     ::SWGSDRangel::setValue(&record, pJson["record"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&trigger, pJson["trigger"], "qint32", "");
+    
 }
 
 QString
@@ -79,6 +85,9 @@ SWGFileSinkActions::asJsonObject() {
     if(m_record_isSet){
         obj->insert("record", QJsonValue(record));
     }
+    if(m_trigger_isSet){
+        obj->insert("trigger", QJsonValue(trigger));
+    }
 
     return obj;
 }
@@ -93,6 +102,16 @@ SWGFileSinkActions::setRecord(qint32 record) {
     this->m_record_isSet = true;
 }
 
+qint32
+SWGFileSinkActions::getTrigger() {
+    return trigger;
+}
+void
+SWGFileSinkActions::setTrigger(qint32 trigger) {
+    this->trigger = trigger;
+    this->m_trigger_isSet = true;
+}
+
 
 bool
 SWGFileSinkActions::isSet(){
@@ -101,6 +120,9 @@ SWGFileSinkActions::isSet(){
         if(m_record_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_trigger_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
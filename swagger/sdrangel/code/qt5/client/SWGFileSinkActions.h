@@ -44,6 +44,9 @@ public:
     qint32 getRecord();
     void setRecord(qint32 record);
 
+    qint32 getTrigger();
+    void setTrigger(qint32 trigger);
+
 
     virtual bool isSet() override;
 
@@ -51,6 +54,9 @@ private:
     qint32 record;
     bool m_record_isSet;
 
+    qint32 trigger;
+    bool m_trigger_isSet;
+
 };
 
 }
@@ -44,6 +44,8 @@ SWGFileSinkReport::SWGFileSinkReport() {
     m_record_size_isSet = false;
     record_captures = 0;
     m_record_captures_isSet = false;
+    dropped_buffers = 0;
+    m_dropped_buffers_isSet = false;
 }
 
 SWGFileSinkReport::~SWGFileSinkReport() {
@@ -68,6 +70,8 @@ SWGFileSinkReport::init() {
     m_record_size_isSet = false;
     record_captures = 0;
     m_record_captures_isSet = false;
+    dropped_buffers = 0;
+    m_dropped_buffers_isSet = false;
 }
 
 void
@@ -109,6 +113,8 @@ SWGFileSinkReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&record_captures, pJson["recordCaptures"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&dropped_buffers, pJson["droppedBuffers"], "qint32", "");
+    
 }
 
 QString
@@ -149,6 +155,9 @@ SWGFileSinkReport::asJsonObject() {
     if(m_record_captures_isSet){
         obj->insert("recordCaptures", QJsonValue(record_captures));
     }
+    if(m_dropped_buffers_isSet){
+        obj->insert("droppedBuffers", QJsonValue(dropped_buffers));
+    }
 
     return obj;
 }
@@ -233,6 +242,16 @@ SWGFileSinkReport::setRecordCaptures(qint32 record_captures) {
     this->m_record_captures_isSet = true;
 }
 
+qint32
+SWGFileSinkReport::getDroppedBuffers() {
+    return dropped_buffers;
+}
+void
+SWGFileSinkReport::setDroppedBuffers(qint32 dropped_buffers) {
+    this->dropped_buffers = dropped_buffers;
+    this->m_dropped_buffers_isSet = true;
+}
+
 
 bool
 SWGFileSinkReport::isSet(){
@@ -262,6 +281,9 @@ SWGFileSinkReport::isSet(){
         if(m_record_captures_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_dropped_buffers_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
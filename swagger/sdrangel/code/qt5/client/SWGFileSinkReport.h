@@ -65,6 +65,9 @@ public:
     qint32 getRecordCaptures();
     void setRecordCaptures(qint32 record_captures);
 
+    qint32 getDroppedBuffers();
+    void setDroppedBuffers(qint32 dropped_buffers);
+
 
     virtual bool isSet() override;
 
@@ -93,6 +96,9 @@ private:
     qint32 record_captures;
     bool m_record_captures_isSet;
 
+    qint32 dropped_buffers;
+    bool m_dropped_buffers_isSet;
+
 };
 
 }
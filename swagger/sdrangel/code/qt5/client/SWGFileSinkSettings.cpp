@@ -48,6 +48,20 @@ SWGFileSinkSettings::SWGFileSinkSettings() {
     m_squelch_post_record_time_isSet = false;
     squelch_recording_enable = 0;
     m_squelch_recording_enable_isSet = false;
+    squelch_channel_index = 0;
+    m_squelch_channel_index_isSet = false;
+    direct_io = 0;
+    m_direct_io_isSet = false;
+    preallocation = 0;
+    m_preallocation_isSet = false;
+    chunked_format = 0;
+    m_chunked_format_isSet = false;
+    compressed_format = 0;
+    m_compressed_format_isSet = false;
+    compression_bits = 0;
+    m_compression_bits_isSet = false;
+    sub_bands = nullptr;
+    m_sub_bands_isSet = false;
     stream_index = 0;
     m_stream_index_isSet = false;
     use_reverse_api = 0;
@@ -88,6 +102,20 @@ SWGFileSinkSettings::init() {
     m_squelch_post_record_time_isSet = false;
     squelch_recording_enable = 0;
     m_squelch_recording_enable_isSet = false;
+    squelch_channel_index = 0;
+    m_squelch_channel_index_isSet = false;
+    direct_io = 0;
+    m_direct_io_isSet = false;
+    preallocation = 0;
+    m_preallocation_isSet = false;
+    chunked_format = 0;
+    m_chunked_format_isSet = false;
+    compressed_format = 0;
+    m_compressed_format_isSet = false;
+    compression_bits = 0;
+    m_compression_bits_isSet = false;
+    sub_bands = new QList<SWGFileSinkSubBand*>();
+    m_sub_bands_isSet = false;
     stream_index = 0;
     m_stream_index_isSet = false;
     use_reverse_api = 0;
@@ -120,6 +148,15 @@ SWGFileSinkSettings::cleanup() {
 
 
 
+    if(sub_bands != nullptr) { 
+        auto arr = sub_bands;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete sub_bands;
+    }
+
+
     if(reverse_api_address != nullptr) { 
         delete reverse_api_address;
     }
@@ -159,6 +196,20 @@ SWGFileSinkSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&squelch_recording_enable, pJson["squelchRecordingEnable"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&squelch_channel_index, pJson["squelchChannelIndex"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&direct_io, pJson["directIO"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&preallocation, pJson["preallocation"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&chunked_format, pJson["chunkedFormat"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&compressed_format, pJson["compressedFormat"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&compression_bits, pJson["compressionBits"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&sub_bands, pJson["subBands"], "QList", "SWGFileSinkSubBand");
     ::SWGSDRangel::setValue(&stream_index, pJson["streamIndex"], "qint32", "");
     
     ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
@@ -217,6 +268,27 @@ SWGFileSinkSettings::asJsonObject() {
     if(m_squelch_recording_enable_isSet){
         obj->insert("squelchRecordingEnable", QJsonValue(squelch_recording_enable));
     }
+    if(m_squelch_channel_index_isSet){
+        obj->insert("squelchChannelIndex", QJsonValue(squelch_channel_index));
+    }
+    if(m_direct_io_isSet){
+        obj->insert("directIO", QJsonValue(direct_io));
+    }
+    if(m_preallocation_isSet){
+        obj->insert("preallocation", QJsonValue(preallocation));
+    }
+    if(m_chunked_format_isSet){
+        obj->insert("chunkedFormat", QJsonValue(chunked_format));
+    }
+    if(m_compressed_format_isSet){
+        obj->insert("compressedFormat", QJsonValue(compressed_format));
+    }
+    if(m_compression_bits_isSet){
+        obj->insert("compressionBits", QJsonValue(compression_bits));
+    }
+    if(sub_bands && sub_bands->size() > 0){
+        toJsonArray((QList<void*>*)sub_bands, obj, "subBands", "SWGFileSinkSubBand");
+    }
     if(m_stream_index_isSet){
         obj->insert("streamIndex", QJsonValue(stream_index));
     }
@@ -339,6 +411,76 @@ SWGFileSinkSettings::setSquelchRecordingEnable(qint32 squelch_recording_enable)
     this->m_squelch_recording_enable_isSet = true;
 }
 
+qint32
+SWGFileSinkSettings::getSquelchChannelIndex() {
+    return squelch_channel_index;
+}
+void
+SWGFileSinkSettings::setSquelchChannelIndex(qint32 squelch_channel_index) {
+    this->squelch_channel_index = squelch_channel_index;
+    this->m_squelch_channel_index_isSet = true;
+}
+
+qint32
+SWGFileSinkSettings::getDirectIo() {
+    return direct_io;
+}
+void
+SWGFileSinkSettings::setDirectIo(qint32 direct_io) {
+    this->direct_io = direct_io;
+    this->m_direct_io_isSet = true;
+}
+
+qint32
+SWGFileSinkSettings::getPreallocation() {
+    return preallocation;
+}
+void
+SWGFileSinkSettings::setPreallocation(qint32 preallocation) {
+    this->preallocation = preallocation;
+    this->m_preallocation_isSet = true;
+}
+
+qint32
+SWGFileSinkSettings::getChunkedFormat() {
+    return chunked_format;
+}
+void
+SWGFileSinkSettings::setChunkedFormat(qint32 chunked_format) {
+    this->chunked_format = chunked_format;
+    this->m_chunked_format_isSet = true;
+}
+
+qint32
+SWGFileSinkSettings::getCompressedFormat() {
+    return compressed_format;
+}
+void
+SWGFileSinkSettings::setCompressedFormat(qint32 compressed_format) {
+    this->compressed_format = compressed_format;
+    this->m_compressed_format_isSet = true;
+}
+
+qint32
+SWGFileSinkSettings::getCompressionBits() {
+    return compression_bits;
+}
+void
+SWGFileSinkSettings::setCompressionBits(qint32 compression_bits) {
+    this->compression_bits = compression_bits;
+    this->m_compression_bits_isSet = true;
+}
+
+QList<SWGFileSinkSubBand*>*
+SWGFileSinkSettings::getSubBands() {
+    return sub_bands;
+}
+void
+SWGFileSinkSettings::setSubBands(QList<SWGFileSinkSubBand*>* sub_bands) {
+    this->sub_bands = sub_bands;
+    this->m_sub_bands_isSet = true;
+}
+
 qint32
 SWGFileSinkSettings::getStreamIndex() {
     return stream_index;
@@ -434,6 +576,27 @@ SWGFileSinkSettings::isSet(){
         if(m_squelch_recording_enable_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_squelch_channel_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_direct_io_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_preallocation_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_chunked_format_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_compressed_format_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_compression_bits_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(sub_bands && (sub_bands->size() > 0)){
+            isObjectUpdated = true; break;
+        }
         if(m_stream_index_isSet){
             isObjectUpdated = true; break;
         }
@@ -22,6 +22,8 @@
 #include <QJsonObject>
 
 
+#include "SWGFileSinkSubBand.h"
+#include <QList>
 #include <QString>
 
 #include "SWGObject.h"
@@ -72,6 +74,27 @@ public:
     qint32 getSquelchRecordingEnable();
     void setSquelchRecordingEnable(qint32 squelch_recording_enable);
 
+    qint32 getSquelchChannelIndex();
+    void setSquelchChannelIndex(qint32 squelch_channel_index);
+
+    qint32 getDirectIo();
+    void setDirectIo(qint32 direct_io);
+
+    qint32 getPreallocation();
+    void setPreallocation(qint32 preallocation);
+
+    qint32 getChunkedFormat();
+    void setChunkedFormat(qint32 chunked_format);
+
+    qint32 getCompressedFormat();
+    void setCompressedFormat(qint32 compressed_format);
+
+    qint32 getCompressionBits();
+    void setCompressionBits(qint32 compression_bits);
+
+    QList<SWGFileSinkSubBand*>* getSubBands();
+    void setSubBands(QList<SWGFileSinkSubBand*>* sub_bands);
+
     qint32 getStreamIndex();
     void setStreamIndex(qint32 stream_index);
 
@@ -124,6 +147,27 @@ private:
     qint32 squelch_recording_enable;
     bool m_squelch_recording_enable_isSet;
 
+    qint32 squelch_channel_index;
+    bool m_squelch_channel_index_isSet;
+
+    qint32 direct_io;
+    bool m_direct_io_isSet;
+
+    qint32 preallocation;
+    bool m_preallocation_isSet;
+
+    qint32 chunked_format;
+    bool m_chunked_format_isSet;
+
+    qint32 compressed_format;
+    bool m_compressed_format_isSet;
+
+    qint32 compression_bits;
+    bool m_compression_bits_isSet;
+
+    QList<SWGFileSinkSubBand*>* sub_bands;
+    bool m_sub_bands_isSet;
+
     qint32 stream_index;
     bool m_stream_index_isSet;
 
@@ -70,6 +70,12 @@ SWGGLSpectrum::SWGGLSpectrum() {
     m_averaging_value_isSet = false;
     linear = 0;
     m_linear_isSet = false;
+    waterfall_history = 0;
+    m_waterfall_history_isSet = false;
+    waterfall_history_memory = 0;
+    m_waterfall_history_memory_isSet = false;
+    waterfall_history_spill_directory = nullptr;
+    m_waterfall_history_spill_directory_isSet = false;
 }
 
 SWGGLSpectrum::~SWGGLSpectrum() {
@@ -120,6 +126,12 @@ SWGGLSpectrum::init() {
     m_averaging_value_isSet = false;
     linear = 0;
     m_linear_isSet = false;
+    waterfall_history = 0;
+    m_waterfall_history_isSet = false;
+    waterfall_history_memory = 0;
+    m_waterfall_history_memory_isSet = false;
+    waterfall_history_spill_directory = new QString("");
+    m_waterfall_history_spill_directory_isSet = false;
 }
 
 void
@@ -145,6 +157,9 @@ SWGGLSpectrum::cleanup() {
 
 
 
+    if(waterfall_history_spill_directory != nullptr) { 
+        delete waterfall_history_spill_directory;
+    }
 }
 
 SWGGLSpectrum*
@@ -200,6 +215,12 @@ SWGGLSpectrum::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&linear, pJson["linear"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&waterfall_history, pJson["waterfallHistory"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&waterfall_history_memory, pJson["waterfallHistoryMemory"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&waterfall_history_spill_directory, pJson["waterfallHistorySpillDirectory"], "QString", "QString");
+    
 }
 
 QString
@@ -279,6 +300,15 @@ SWGGLSpectrum::asJsonObject() {
     if(m_linear_isSet){
         obj->insert("linear", QJsonValue(linear));
     }
+    if(m_waterfall_history_isSet){
+        obj->insert("waterfallHistory", QJsonValue(waterfall_history));
+    }
+    if(m_waterfall_history_memory_isSet){
+        obj->insert("waterfallHistoryMemory", QJsonValue(waterfall_history_memory));
+    }
+    if(waterfall_history_spill_directory != nullptr && *waterfall_history_spill_directory != QString("")){
+        toJsonValue(QString("waterfallHistorySpillDirectory"), waterfall_history_spill_directory, obj, QString("QString"));
+    }
 
     return obj;
 }
@@ -493,6 +523,36 @@ SWGGLSpectrum::setLinear(qint32 linear) {
     this->m_linear_isSet = true;
 }
 
+qint32
+SWGGLSpectrum::getWaterfallHistory() {
+    return waterfall_history;
+}
+void
+SWGGLSpectrum::setWaterfallHistory(qint32 waterfall_history) {
+    this->waterfall_history = waterfall_history;
+    this->m_waterfall_history_isSet = true;
+}
+
+qint32
+SWGGLSpectrum::getWaterfallHistoryMemory() {
+    return waterfall_history_memory;
+}
+void
+SWGGLSpectrum::setWaterfallHistoryMemory(qint32 waterfall_history_memory) {
+    this->waterfall_history_memory = waterfall_history_memory;
+    this->m_waterfall_history_memory_isSet = true;
+}
+
+QString*
+SWGGLSpectrum::getWaterfallHistorySpillDirectory() {
+    return waterfall_history_spill_directory;
+}
+void
+SWGGLSpectrum::setWaterfallHistorySpillDirectory(QString* waterfall_history_spill_directory) {
+    this->waterfall_history_spill_directory = waterfall_history_spill_directory;
+    this->m_waterfall_history_spill_directory_isSet = true;
+}
+
 
 bool
 SWGGLSpectrum::isSet(){
@@ -561,6 +621,15 @@ SWGGLSpectrum::isSet(){
         if(m_linear_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_waterfall_history_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_waterfall_history_memory_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(waterfall_history_spill_directory && *waterfall_history_spill_directory != QString("")){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -22,6 +22,7 @@
 #include <QJsonObject>
 
 
+#include <QString>
 
 #include "SWGObject.h"
 #include "export.h"
@@ -104,6 +105,15 @@ public:
     qint32 getLinear();
     void setLinear(qint32 linear);
 
+    qint32 getWaterfallHistory();
+    void setWaterfallHistory(qint32 waterfall_history);
+
+    qint32 getWaterfallHistoryMemory();
+    void setWaterfallHistoryMemory(qint32 waterfall_history_memory);
+
+    QString* getWaterfallHistorySpillDirectory();
+    void setWaterfallHistorySpillDirectory(QString* waterfall_history_spill_directory);
+
 
     virtual bool isSet() override;
 
@@ -171,6 +181,15 @@ private:
     qint32 linear;
     bool m_linear_isSet;
 
+    qint32 waterfall_history;
+    bool m_waterfall_history_isSet;
+
+    qint32 waterfall_history_memory;
+    bool m_waterfall_history_memory_isSet;
+
+    QString* waterfall_history_spill_directory;
+    bool m_waterfall_history_spill_directory_isSet;
+
 };
 
 }
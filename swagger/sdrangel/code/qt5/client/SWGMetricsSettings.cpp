@@ -0,0 +1,108 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGMetricsSettings.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGMetricsSettings::SWGMetricsSettings(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGMetricsSettings::SWGMetricsSettings() {
+    enabled = 0;
+    m_enabled_isSet = false;
+}
+
+SWGMetricsSettings::~SWGMetricsSettings() {
+    this->cleanup();
+}
+
+void
+SWGMetricsSettings::init() {
+    enabled = 0;
+    m_enabled_isSet = false;
+}
+
+void
+SWGMetricsSettings::cleanup() {
+
+}
+
+SWGMetricsSettings*
+SWGMetricsSettings::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGMetricsSettings::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&enabled, pJson["enabled"], "qint32", "");
+    
+}
+
+QString
+SWGMetricsSettings::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGMetricsSettings::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_enabled_isSet){
+        obj->insert("enabled", QJsonValue(enabled));
+    }
+
+    return obj;
+}
+
+qint32
+SWGMetricsSettings::getEnabled() {
+    return enabled;
+}
+void
+SWGMetricsSettings::setEnabled(qint32 enabled) {
+    this->enabled = enabled;
+    this->m_enabled_isSet = true;
+}
+
+
+bool
+SWGMetricsSettings::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_enabled_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
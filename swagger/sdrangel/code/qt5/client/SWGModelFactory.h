@@ -48,6 +48,7 @@
 #include "SWGChannelAnalyzerSettings.h"
 #include "SWGChannelConfig.h"
 #include "SWGChannelListItem.h"
+#include "SWGChannelMetrics.h"
 #include "SWGChannelReport.h"
 #include "SWGChannelSettings.h"
 #include "SWGChannelsDetail.h"
@@ -64,6 +65,7 @@
 #include "SWGDeviceReport.h"
 #include "SWGDeviceSet.h"
 #include "SWGDeviceSetList.h"
+#include "SWGDeviceSetMetrics.h"
 #include "SWGDeviceSettings.h"
 #include "SWGDeviceState.h"
 #include "SWGErrorResponse.h"
@@ -77,11 +79,13 @@
 #include "SWGFeatureSetList.h"
 #include "SWGFeatureSetPreset.h"
 #include "SWGFeatureSettings.h"
+#include "SWGFifoMetrics.h"
 #include "SWGFileInputReport.h"
 #include "SWGFileInputSettings.h"
 #include "SWGFileSinkActions.h"
 #include "SWGFileSinkReport.h"
 #include "SWGFileSinkSettings.h"
+#include "SWGFileSinkSubBand.h"
 #include "SWGFileSourceActions.h"
 #include "SWGFileSourceReport.h"
 #include "SWGFileSourceSettings.h"
@@ -125,6 +129,7 @@
 #include "SWGLocalSourceSettings.h"
 #include "SWGLocationInformation.h"
 #include "SWGLoggingInfo.h"
+#include "SWGMetricsSettings.h"
 #include "SWGNFMDemodReport.h"
 #include "SWGNFMDemodSettings.h"
 #include "SWGNFMModReport.h"
@@ -195,6 +200,8 @@
 #include "SWGWFMDemodSettings.h"
 #include "SWGWFMModReport.h"
 #include "SWGWFMModSettings.h"
+#include "SWGWaterfallHistorySettings.h"
+#include "SWGWaterfallHistoryWindow.h"
 #include "SWGXtrxInputReport.h"
 #include "SWGXtrxInputSettings.h"
 #include "SWGXtrxOutputReport.h"
@@ -305,6 +312,9 @@ namespace SWGSDRangel {
     if(QString("SWGChannelListItem").compare(type) == 0) {
       return new SWGChannelListItem();
     }
+    if(QString("SWGChannelMetrics").compare(type) == 0) {
+      return new SWGChannelMetrics();
+    }
     if(QString("SWGChannelReport").compare(type) == 0) {
       return new SWGChannelReport();
     }
@@ -353,6 +363,9 @@ namespace SWGSDRangel {
     if(QString("SWGDeviceSetList").compare(type) == 0) {
       return new SWGDeviceSetList();
     }
+    if(QString("SWGDeviceSetMetrics").compare(type) == 0) {
+      return new SWGDeviceSetMetrics();
+    }
     if(QString("SWGDeviceSettings").compare(type) == 0) {
       return new SWGDeviceSettings();
     }
@@ -392,6 +405,9 @@ namespace SWGSDRangel {
     if(QString("SWGFeatureSettings").compare(type) == 0) {
       return new SWGFeatureSettings();
     }
+    if(QString("SWGFifoMetrics").compare(type) == 0) {
+      return new SWGFifoMetrics();
+    }
     if(QString("SWGFileInputReport").compare(type) == 0) {
       return new SWGFileInputReport();
     }
@@ -407,6 +423,9 @@ namespace SWGSDRangel {
     if(QString("SWGFileSinkSettings").compare(type) == 0) {
       return new SWGFileSinkSettings();
     }
+    if(QString("SWGFileSinkSubBand").compare(type) == 0) {
+      return new SWGFileSinkSubBand();
+    }
     if(QString("SWGFileSourceActions").compare(type) == 0) {
       return new SWGFileSourceActions();
     }
@@ -536,6 +555,9 @@ namespace SWGSDRangel {
     if(QString("SWGLoggingInfo").compare(type) == 0) {
       return new SWGLoggingInfo();
     }
+    if(QString("SWGMetricsSettings").compare(type) == 0) {
+      return new SWGMetricsSettings();
+    }
     if(QString("SWGNFMDemodReport").compare(type) == 0) {
       return new SWGNFMDemodReport();
     }
@@ -746,6 +768,12 @@ namespace SWGSDRangel {
     if(QString("SWGWFMModSettings").compare(type) == 0) {
       return new SWGWFMModSettings();
     }
+    if(QString("SWGWaterfallHistorySettings").compare(type) == 0) {
+      return new SWGWaterfallHistorySettings();
+    }
+    if(QString("SWGWaterfallHistoryWindow").compare(type) == 0) {
+      return new SWGWaterfallHistoryWindow();
+    }
     if(QString("SWGXtrxInputReport").compare(type) == 0) {
       return new SWGXtrxInputReport();
     }
@@ -48,6 +48,8 @@ SWGSoapySDRInputSettings::SWGSoapySDRInputSettings() {
     m_transverter_delta_frequency_isSet = false;
     iq_order = 0;
     m_iq_order_isSet = false;
+    float_pipeline = 0;
+    m_float_pipeline_isSet = false;
     antenna = nullptr;
     m_antenna_isSet = false;
     bandwidth = 0;
@@ -108,6 +110,8 @@ SWGSoapySDRInputSettings::init() {
     m_transverter_delta_frequency_isSet = false;
     iq_order = 0;
     m_iq_order_isSet = false;
+    float_pipeline = 0;
+    m_float_pipeline_isSet = false;
     antenna = new QString("");
     m_antenna_isSet = false;
     bandwidth = 0;
@@ -235,6 +239,8 @@ SWGSoapySDRInputSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&iq_order, pJson["iqOrder"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&float_pipeline, pJson["floatPipeline"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&antenna, pJson["antenna"], "QString", "QString");
     
     ::SWGSDRangel::setValue(&bandwidth, pJson["bandwidth"], "qint32", "");
@@ -313,6 +319,9 @@ SWGSoapySDRInputSettings::asJsonObject() {
     if(m_iq_order_isSet){
         obj->insert("iqOrder", QJsonValue(iq_order));
     }
+    if(m_float_pipeline_isSet){
+        obj->insert("floatPipeline", QJsonValue(float_pipeline));
+    }
     if(antenna != nullptr && *antenna != QString("")){
         toJsonValue(QString("antenna"), antenna, obj, QString("QString"));
     }
@@ -465,6 +474,16 @@ SWGSoapySDRInputSettings::setIqOrder(qint32 iq_order) {
     this->m_iq_order_isSet = true;
 }
 
+qint32
+SWGSoapySDRInputSettings::getFloatPipeline() {
+    return float_pipeline;
+}
+void
+SWGSoapySDRInputSettings::setFloatPipeline(qint32 float_pipeline) {
+    this->float_pipeline = float_pipeline;
+    this->m_float_pipeline_isSet = true;
+}
+
 QString*
 SWGSoapySDRInputSettings::getAntenna() {
     return antenna;
@@ -660,6 +679,9 @@ SWGSoapySDRInputSettings::isSet(){
         if(m_iq_order_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_float_pipeline_isSet){
+            isObjectUpdated = true; break;
+        }
         if(antenna && *antenna != QString("")){
             isObjectUpdated = true; break;
         }
@@ -75,6 +75,9 @@ public:
     qint32 getIqOrder();
     void setIqOrder(qint32 iq_order);
 
+    qint32 getFloatPipeline();
+    void setFloatPipeline(qint32 float_pipeline);
+
     QString* getAntenna();
     void setAntenna(QString* antenna);
 
@@ -157,6 +160,9 @@ private:
     qint32 iq_order;
     bool m_iq_order_isSet;
 
+    qint32 float_pipeline;
+    bool m_float_pipeline_isSet;
+
     QString* antenna;
     bool m_antenna_isSet;
 
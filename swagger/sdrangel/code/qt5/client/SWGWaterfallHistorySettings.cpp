@@ -0,0 +1,224 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGWaterfallHistorySettings.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGWaterfallHistorySettings::SWGWaterfallHistorySettings(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGWaterfallHistorySettings::SWGWaterfallHistorySettings() {
+    enabled = 0;
+    m_enabled_isSet = false;
+    memory = 0;
+    m_memory_isSet = false;
+    spill_directory = nullptr;
+    m_spill_directory_isSet = false;
+    from_time = 0L;
+    m_from_time_isSet = false;
+    to_time = 0L;
+    m_to_time_isSet = false;
+    memory_usage = 0L;
+    m_memory_usage_isSet = false;
+}
+
+SWGWaterfallHistorySettings::~SWGWaterfallHistorySettings() {
+    this->cleanup();
+}
+
+void
+SWGWaterfallHistorySettings::init() {
+    enabled = 0;
+    m_enabled_isSet = false;
+    memory = 0;
+    m_memory_isSet = false;
+    spill_directory = new QString("");
+    m_spill_directory_isSet = false;
+    from_time = 0L;
+    m_from_time_isSet = false;
+    to_time = 0L;
+    m_to_time_isSet = false;
+    memory_usage = 0L;
+    m_memory_usage_isSet = false;
+}
+
+void
+SWGWaterfallHistorySettings::cleanup() {
+
+
+    if(spill_directory != nullptr) { 
+        delete spill_directory;
+    }
+
+
+
+}
+
+SWGWaterfallHistorySettings*
+SWGWaterfallHistorySettings::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGWaterfallHistorySettings::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&enabled, pJson["enabled"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&memory, pJson["memory"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&spill_directory, pJson["spillDirectory"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&from_time, pJson["fromTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&to_time, pJson["toTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&memory_usage, pJson["memoryUsage"], "qint64", "");
+}
+
+QString
+SWGWaterfallHistorySettings::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGWaterfallHistorySettings::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_enabled_isSet){
+        obj->insert("enabled", QJsonValue(enabled));
+    }
+    if(m_memory_isSet){
+        obj->insert("memory", QJsonValue(memory));
+    }
+    if(spill_directory != nullptr && *spill_directory != QString("")){
+        toJsonValue(QString("spillDirectory"), spill_directory, obj, QString("QString"));
+    }
+    if(m_from_time_isSet){
+        obj->insert("fromTime", QJsonValue(from_time));
+    }
+    if(m_to_time_isSet){
+        obj->insert("toTime", QJsonValue(to_time));
+    }
+    if(m_memory_usage_isSet){
+        obj->insert("memoryUsage", QJsonValue(memory_usage));
+    }
+
+    return obj;
+}
+
+qint32
+SWGWaterfallHistorySettings::getEnabled() {
+    return enabled;
+}
+void
+SWGWaterfallHistorySettings::setEnabled(qint32 enabled) {
+    this->enabled = enabled;
+    this->m_enabled_isSet = true;
+}
+
+qint32
+SWGWaterfallHistorySettings::getMemory() {
+    return memory;
+}
+void
+SWGWaterfallHistorySettings::setMemory(qint32 memory) {
+    this->memory = memory;
+    this->m_memory_isSet = true;
+}
+
+QString*
+SWGWaterfallHistorySettings::getSpillDirectory() {
+    return spill_directory;
+}
+void
+SWGWaterfallHistorySettings::setSpillDirectory(QString* spill_directory) {
+    this->spill_directory = spill_directory;
+    this->m_spill_directory_isSet = true;
+}
+
+qint64
+SWGWaterfallHistorySettings::getFromTime() {
+    return from_time;
+}
+void
+SWGWaterfallHistorySettings::setFromTime(qint64 from_time) {
+    this->from_time = from_time;
+    this->m_from_time_isSet = true;
+}
+
+qint64
+SWGWaterfallHistorySettings::getToTime() {
+    return to_time;
+}
+void
+SWGWaterfallHistorySettings::setToTime(qint64 to_time) {
+    this->to_time = to_time;
+    this->m_to_time_isSet = true;
+}
+
+qint64
+SWGWaterfallHistorySettings::getMemoryUsage() {
+    return memory_usage;
+}
+void
+SWGWaterfallHistorySettings::setMemoryUsage(qint64 memory_usage) {
+    this->memory_usage = memory_usage;
+    this->m_memory_usage_isSet = true;
+}
+
+
+bool
+SWGWaterfallHistorySettings::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_enabled_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_memory_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(spill_directory && *spill_directory != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_from_time_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_to_time_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_memory_usage_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,89 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGWaterfallHistorySettings.h
+ *
+ * Waterfall history of the device set main spectrum
+ */
+
+#ifndef SWGWaterfallHistorySettings_H_
+#define SWGWaterfallHistorySettings_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGWaterfallHistorySettings: public SWGObject {
+public:
+    SWGWaterfallHistorySettings();
+    SWGWaterfallHistorySettings(QString* json);
+    virtual ~SWGWaterfallHistorySettings();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGWaterfallHistorySettings* fromJson(QString &jsonString) override;
+
+    qint32 getEnabled();
+    void setEnabled(qint32 enabled);
+
+    qint32 getMemory();
+    void setMemory(qint32 memory);
+
+    QString* getSpillDirectory();
+    void setSpillDirectory(QString* spill_directory);
+
+    qint64 getFromTime();
+    void setFromTime(qint64 from_time);
+
+    qint64 getToTime();
+    void setToTime(qint64 to_time);
+
+    qint64 getMemoryUsage();
+    void setMemoryUsage(qint64 memory_usage);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 enabled;
+    bool m_enabled_isSet;
+
+    qint32 memory;
+    bool m_memory_isSet;
+
+    QString* spill_directory;
+    bool m_spill_directory_isSet;
+
+    qint64 from_time;
+    bool m_from_time_isSet;
+
+    qint64 to_time;
+    bool m_to_time_isSet;
+
+    qint64 memory_usage;
+    bool m_memory_usage_isSet;
+
+};
+
+}
+
+#endif /* SWGWaterfallHistorySettings_H_ */
@@ -0,0 +1,273 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGWaterfallHistoryWindow.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGWaterfallHistoryWindow::SWGWaterfallHistoryWindow(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGWaterfallHistoryWindow::SWGWaterfallHistoryWindow() {
+    nb_lines = 0;
+    m_nb_lines_isSet = false;
+    nb_bins = 0;
+    m_nb_bins_isSet = false;
+    start_frequency = 0L;
+    m_start_frequency_isSet = false;
+    end_frequency = 0L;
+    m_end_frequency_isSet = false;
+    offset = 0.0f;
+    m_offset_isSet = false;
+    scale = 0.0f;
+    m_scale_isSet = false;
+    timestamps = nullptr;
+    m_timestamps_isSet = false;
+    values = nullptr;
+    m_values_isSet = false;
+}
+
+SWGWaterfallHistoryWindow::~SWGWaterfallHistoryWindow() {
+    this->cleanup();
+}
+
+void
+SWGWaterfallHistoryWindow::init() {
+    nb_lines = 0;
+    m_nb_lines_isSet = false;
+    nb_bins = 0;
+    m_nb_bins_isSet = false;
+    start_frequency = 0L;
+    m_start_frequency_isSet = false;
+    end_frequency = 0L;
+    m_end_frequency_isSet = false;
+    offset = 0.0f;
+    m_offset_isSet = false;
+    scale = 0.0f;
+    m_scale_isSet = false;
+    timestamps = new QList<qint64>();
+    m_timestamps_isSet = false;
+    values = new QString("");
+    m_values_isSet = false;
+}
+
+void
+SWGWaterfallHistoryWindow::cleanup() {
+
+
+
+
+
+
+    if(timestamps != nullptr) { 
+        delete timestamps;
+    }
+    if(values != nullptr) { 
+        delete values;
+    }
+}
+
+SWGWaterfallHistoryWindow*
+SWGWaterfallHistoryWindow::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGWaterfallHistoryWindow::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&nb_lines, pJson["nbLines"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nb_bins, pJson["nbBins"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&start_frequency, pJson["startFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&end_frequency, pJson["endFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&offset, pJson["offset"], "float", "");
+    
+    ::SWGSDRangel::setValue(&scale, pJson["scale"], "float", "");
+    
+    
+    ::SWGSDRangel::setValue(&timestamps, pJson["timestamps"], "QList", "qint64");
+    
+    ::SWGSDRangel::setValue(&values, pJson["values"], "QString", "QString");
+}
+
+QString
+SWGWaterfallHistoryWindow::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGWaterfallHistoryWindow::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_nb_lines_isSet){
+        obj->insert("nbLines", QJsonValue(nb_lines));
+    }
+    if(m_nb_bins_isSet){
+        obj->insert("nbBins", QJsonValue(nb_bins));
+    }
+    if(m_start_frequency_isSet){
+        obj->insert("startFrequency", QJsonValue(start_frequency));
+    }
+    if(m_end_frequency_isSet){
+        obj->insert("endFrequency", QJsonValue(end_frequency));
+    }
+    if(m_offset_isSet){
+        obj->insert("offset", QJsonValue(offset));
+    }
+    if(m_scale_isSet){
+        obj->insert("scale", QJsonValue(scale));
+    }
+    if(timestamps && timestamps->size() > 0){
+        toJsonArray((QList<void*>*)timestamps, obj, "timestamps", "qint64");
+    }
+    if(values != nullptr && *values != QString("")){
+        toJsonValue(QString("values"), values, obj, QString("QString"));
+    }
+
+    return obj;
+}
+
+qint32
+SWGWaterfallHistoryWindow::getNbLines() {
+    return nb_lines;
+}
+void
+SWGWaterfallHistoryWindow::setNbLines(qint32 nb_lines) {
+    this->nb_lines = nb_lines;
+    this->m_nb_lines_isSet = true;
+}
+
+qint32
+SWGWaterfallHistoryWindow::getNbBins() {
+    return nb_bins;
+}
+void
+SWGWaterfallHistoryWindow::setNbBins(qint32 nb_bins) {
+    this->nb_bins = nb_bins;
+    this->m_nb_bins_isSet = true;
+}
+
+qint64
+SWGWaterfallHistoryWindow::getStartFrequency() {
+    return start_frequency;
+}
+void
+SWGWaterfallHistoryWindow::setStartFrequency(qint64 start_frequency) {
+    this->start_frequency = start_frequency;
+    this->m_start_frequency_isSet = true;
+}
+
+qint64
+SWGWaterfallHistoryWindow::getEndFrequency() {
+    return end_frequency;
+}
+void
+SWGWaterfallHistoryWindow::setEndFrequency(qint64 end_frequency) {
+    this->end_frequency = end_frequency;
+    this->m_end_frequency_isSet = true;
+}
+
+float
+SWGWaterfallHistoryWindow::getOffset() {
+    return offset;
+}
+void
+SWGWaterfallHistoryWindow::setOffset(float offset) {
+    this->offset = offset;
+    this->m_offset_isSet = true;
+}
+
+float
+SWGWaterfallHistoryWindow::getScale() {
+    return scale;
+}
+void
+SWGWaterfallHistoryWindow::setScale(float scale) {
+    this->scale = scale;
+    this->m_scale_isSet = true;
+}
+
+QList<qint64>*
+SWGWaterfallHistoryWindow::getTimestamps() {
+    return timestamps;
+}
+void
+SWGWaterfallHistoryWindow::setTimestamps(QList<qint64>* timestamps) {
+    this->timestamps = timestamps;
+    this->m_timestamps_isSet = true;
+}
+
+QString*
+SWGWaterfallHistoryWindow::getValues() {
+    return values;
+}
+void
+SWGWaterfallHistoryWindow::setValues(QString* values) {
+    this->values = values;
+    this->m_values_isSet = true;
+}
+
+
+bool
+SWGWaterfallHistoryWindow::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_nb_lines_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_nb_bins_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_start_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_end_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_offset_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_scale_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(timestamps && (timestamps->size() > 0)){
+            isObjectUpdated = true; break;
+        }
+        if(values && *values != QString("")){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,102 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGWaterfallHistoryWindow.h
+ *
+ * Time and frequency window of the waterfall history
+ */
+
+#ifndef SWGWaterfallHistoryWindow_H_
+#define SWGWaterfallHistoryWindow_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+#include <QList>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGWaterfallHistoryWindow: public SWGObject {
+public:
+    SWGWaterfallHistoryWindow();
+    SWGWaterfallHistoryWindow(QString* json);
+    virtual ~SWGWaterfallHistoryWindow();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGWaterfallHistoryWindow* fromJson(QString &jsonString) override;
+
+    qint32 getNbLines();
+    void setNbLines(qint32 nb_lines);
+
+    qint32 getNbBins();
+    void setNbBins(qint32 nb_bins);
+
+    qint64 getStartFrequency();
+    void setStartFrequency(qint64 start_frequency);
+
+    qint64 getEndFrequency();
+    void setEndFrequency(qint64 end_frequency);
+
+    float getOffset();
+    void setOffset(float offset);
+
+    float getScale();
+    void setScale(float scale);
+
+    QList<qint64>* getTimestamps();
+    void setTimestamps(QList<qint64>* timestamps);
+
+    QString* getValues();
+    void setValues(QString* values);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 nb_lines;
+    bool m_nb_lines_isSet;
+
+    qint32 nb_bins;
+    bool m_nb_bins_isSet;
+
+    qint64 start_frequency;
+    bool m_start_frequency_isSet;
+
+    qint64 end_frequency;
+    bool m_end_frequency_isSet;
+
+    float offset;
+    bool m_offset_isSet;
+
+    float scale;
+    bool m_scale_isSet;
+
+    QList<qint64>* timestamps;
+    bool m_timestamps_isSet;
+
+    QString* values;
+    bool m_values_isSet;
+
+};
+
+}
+
+#endif /* SWGWaterfallHistoryWindow_H_ */